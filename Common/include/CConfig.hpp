@@ -64,6 +64,7 @@ private:
   SU2_MPI::Comm SU2_Communicator; /*!< \brief MPI communicator of SU2.*/
   int rank, size;                 /*!< \brief MPI rank and size.*/
   bool base_config;
+  bool Instance_Copy;             /*!< \brief The configuration is a copy made by CopyInstance.*/
   unsigned short Kind_SU2;        /*!< \brief Kind of SU2 software component.*/
   unsigned short Ref_NonDim;      /*!< \brief Kind of non dimensionalization.*/
   unsigned short Ref_Inc_NonDim;  /*!< \brief Kind of non dimensionalization.*/
@@ -161,6 +162,7 @@ private:
   su2double **DV_Value;              /*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;     /*!< \brief Limiter coefficient */
   unsigned long LimiterIter;         /*!< \brief Freeze the value of the limiter after a number of iterations */
+  unsigned long LimiterFreezeIter;   /*!< \brief Stop recomputing the limiters after a number of iterations. */
   su2double AdjSharp_LimiterCoeff;   /*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   unsigned short Kind_Regime;        /*!< \brief Kind of adjoint function. */
@@ -424,6 +426,7 @@ private:
   Unst_CFL;                    /*!< \brief Unsteady CFL number. */
 
   bool ReorientElements;       /*!< \brief Flag for enabling element reorientation. */
+  bool Geometry_Cache;         /*!< \brief Flag for storing/reusing the preprocessed geometry between runs. */
   bool AddIndNeighbor;         /*!< \brief Include indirect neighbor in the agglomeration process. */
   unsigned short nDV,                  /*!< \brief Number of design variables. */
   nObj, nObjW;                         /*! \brief Number of objective functions. */
@@ -456,6 +459,12 @@ private:
   *MG_CorrecSmooth;                   /*!< \brief Multigrid Jacobi implicit smoothing of the correction. */
   su2double *LocationStations;        /*!< \brief Airfoil sections in wing slicing subroutine. */
   su2double *NacelleLocation;         /*!< \brief Definition of the nacelle location. */
+  bool FluidTable;                    /*!< \brief Flag for the tabulated version of the fluid model. */
+  unsigned short FluidTable_nDensity, /*!< \brief Number of density points of the fluid table. */
+  FluidTable_nEnergy;                 /*!< \brief Number of energy points of the fluid table. */
+  su2double *FluidTable_DensityRange, /*!< \brief Density range of the fluid table. */
+  *FluidTable_TemperatureRange;       /*!< \brief Temperature range of the fluid table. */
+  string FluidTable_FileName;         /*!< \brief Name of the file that stores the fluid table. */
 
   unsigned short Kind_Solver,      /*!< \brief Kind of solver Euler, NS, Continuous adjoint, etc.  */
   Kind_MZSolver,                   /*!< \brief Kind of multizone solver.  */
@@ -529,6 +538,7 @@ private:
   Kind_BGS_RelaxMethod,         /*!< \brief Kind of relaxation method for Block Gauss Seidel method in FSI problems. */
   Kind_CHT_Coupling;            /*!< \brief Kind of coupling method used at CHT interfaces. */
   bool ReconstructionGradientRequired; /*!< \brief Enable or disable a second gradient calculation for upwind reconstruction only. */
+  bool LeastSquaresPrecomputed;        /*!< \brief Precompute the geometric weights of least-squares gradients. */
   bool LeastSquaresRequired;    /*!< \brief Enable or disable memory allocation for least-squares gradient methods. */
   bool Energy_Equation;         /*!< \brief Solve the energy equation for incompressible flows. */
 
@@ -573,6 +583,8 @@ private:
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Iter_FSI_Struc;    /*!< \brief Max iterations of the linear solver for FSI applications and structural solver. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  unsigned long Linear_Solver_Recycle_Dim;       /*!< \brief Dimension of the subspace recycled by FGCRODR between solves. */
+  unsigned long Jacobian_Lag_Iter;               /*!< \brief Max iterations with a lagged Jacobian and preconditioner (0 disables lagging). */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
@@ -729,7 +741,9 @@ private:
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
   bool CFL_Adapt;        /*!< \brief Adaptive CFL number. */
+  bool CFL_Adapt_Feedback; /*!< \brief Adapt the CFL number from the linear solver and nonlinear residual feedback. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
+  bool HB_Concurrent_Instances;  /*!< \brief Flag to iterate the harmonic balance time instances concurrently */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
   RefElemLength,         /*!< \brief Reference element length for computing the slope limiting epsilon. */
   RefSharpEdges,         /*!< \brief Reference coefficient for detecting sharp edges. */
@@ -739,6 +753,8 @@ private:
   *RefOriginMoment_Y,    /*!< \brief Y Origin for moment computation. */
   *RefOriginMoment_Z,    /*!< \brief Z Origin for moment computation. */
   *CFL_AdaptParam,       /*!< \brief Information about the CFL ramp. */
+  *CFL_AdaptFeedbackParam, /*!< \brief Divergence ratio and checkpoint frequency of the CFL feedback controller. */
+  *Jacobian_LagParam,    /*!< \brief Linear solver growth factor and residual ratio that refresh a lagged Jacobian. */
   *RelaxFactor_Giles,    /*!< \brief Information about the under relaxation factor for Giles BC. */
   *CFL,                  /*!< \brief CFL number. */
   *HTP_Axis,             /*!< \brief Location of the HTP axis. */
@@ -753,6 +769,7 @@ private:
   su2double* Mesh_Box_Offset;    /*!< \brief Array containing the offset from 0.0 in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
   string Mesh_FileName,          /*!< \brief Mesh input file. */
   Mesh_Out_FileName,             /*!< \brief Mesh output file. */
+  Geometry_Cache_FileName,       /*!< \brief Root name of the preprocessed geometry cache files. */
   Solution_FileName,             /*!< \brief Flow solution input file. */
   Solution_LinFileName,          /*!< \brief Linearized flow solution input file. */
   Solution_AdjFileName,          /*!< \brief Adjoint solution input file for drag functional. */
@@ -1000,6 +1017,9 @@ private:
   unsigned long Nonphys_Points,     /*!< \brief Current number of non-physical points in the solution. */
   Nonphys_Reconstr;                 /*!< \brief Current number of non-physical reconstructions for 2nd-order upwinding. */
   bool ParMETIS;                    /*!< \brief Boolean for activating ParMETIS mode (while testing). */
+  bool Halo_Shared_Memory;          /*!< \brief Exchange the halos of node-local neighbors through shared memory. */
+  unsigned short Kind_Partition_Weights; /*!< \brief Type of vertex weights of the graph partitioning. */
+  bool Wrt_Load_Imbalance;               /*!< \brief Report the measured load imbalance between the ranks. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint,                  /*!< \brief AD-based discrete adjoint mode. */
   FullTape;                              /*!< \brief Full tape mode for coupled discrete adjoints. */
@@ -1013,6 +1033,8 @@ private:
   *default_eng_cyl,            /*!< \brief Default engine box array for the COption class. */
   *default_eng_val,            /*!< \brief Default engine box array values for the COption class. */
   *default_cfl_adapt,          /*!< \brief Default CFL adapt param array for the COption class. */
+  *default_cfl_feedback,       /*!< \brief Default CFL feedback controller param array for the COption class. */
+  *default_jacobian_lag,       /*!< \brief Default Jacobian lagging param array for the COption class. */
   *default_jst_coeff,          /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   *default_ffd_coeff,          /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   *default_mixedout_coeff,     /*!< \brief Default default mixedout algorithm coefficients for the COption class. */
@@ -1046,6 +1068,7 @@ private:
   su2double FinalOutletPressure;        /*!< \brief Final outlet pressure if Ramp outlet pressure is activated. */
   su2double MonitorOutletPressure;      /*!< \brief Monitor outlet pressure if Ramp outlet pressure is activated. */
   su2double *default_body_force;        /*!< \brief Default body force vector for the COption class. */
+  su2double *default_fluid_table_range;  /*!< \brief Default (automatic) range of the fluid table. */
   su2double *default_nacelle_location;  /*!< \brief Location of the nacelle. */
   su2double *default_cp_polycoeffs;     /*!< \brief Array for specific heat polynomial coefficients. */
   su2double *default_mu_polycoeffs;     /*!< \brief Array for viscosity polynomial coefficients. */
@@ -1099,6 +1122,12 @@ private:
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  su2double *Probe_Coords;            /*!< \brief Coordinates of the flow probes (3 per probe). */
+  unsigned short nProbe_Coords;       /*!< \brief Number of probe coordinates. */
+  unsigned long ProbeWrtFreq;         /*!< \brief Interpolation frequency of the probes. */
+  su2double *Slice_Planes;            /*!< \brief Origin and normal of the slice planes (6 per plane). */
+  unsigned short nSlice_Planes;       /*!< \brief Number of slice plane values. */
+  unsigned long SliceWrtFreq;         /*!< \brief Writing frequency of the slices. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1248,6 +1277,14 @@ private:
 
   void addPythonOption(const string name);
 
+  /*!
+   * \brief Apply a function to the arrays of values that are computed during the iterations
+   *        (surface averages, engines, actuator disks...), and to their size.
+   * \param[in] func - Function with signature (su2double*& values, unsigned long size).
+   */
+  template<class F>
+  void ForEachRuntimeArray(F func);
+
 public:
 
   /*!
@@ -1280,6 +1317,14 @@ public:
    */
   ~CConfig(void);
 
+  /*!
+   * \brief Copy the configuration for a time instance that is iterated concurrently.
+   * \note The copy shares the options and the marker data with this configuration, but has its own
+   *       arrays of the values computed during the iterations. It must be deleted before this configuration.
+   * \return Pointer to the copy.
+   */
+  CConfig* CopyInstance() const;
+
   void SetnZone();
 
   void SetnDim();
@@ -1497,6 +1542,20 @@ public:
    */
   bool GetCFL_Adapt(void) const { return CFL_Adapt; }
 
+  /*!
+   * \brief Get whether the CFL adaption uses the linear solver and nonlinear residual feedback.
+   * \return <code>TRUE</code> if the feedback controller is used.
+   */
+  bool GetCFL_Adapt_Feedback(void) const { return CFL_Adapt_Feedback; }
+
+  /*!
+   * \brief Get the parameters of the CFL feedback controller.
+   * \param[in] val_index - 0: ratio of the residual to the one of the saved solution that triggers a restart,
+   *                        1: number of iterations between saves of the solution.
+   * \return Value of the parameter.
+   */
+  su2double GetCFL_AdaptFeedbackParam(unsigned short val_index) const { return CFL_AdaptFeedbackParam[val_index]; }
+
   /*!
    * \brief Get the values of the CFL adapation.
    * \return Value of CFL adapation
@@ -2219,6 +2278,12 @@ public:
    */
   unsigned long GetLimiterIter(void) const { return LimiterIter; }
 
+  /*!
+   * \brief Iteration after which the limiters are no longer recomputed, the last values are used instead.
+   * \return Number of iterations.
+   */
+  unsigned long GetLimiterFreezeIter(void) const { return LimiterFreezeIter; }
+
   /*!
    * \brief Get the value of sharp edge limiter.
    * \return Value of the sharp edge limiter coefficient.
@@ -2633,6 +2698,12 @@ public:
    */
   bool GetReorientElements(void) const { return ReorientElements; }
 
+  /*!
+   * \brief Get information about the preprocessed geometry cache.
+   * \return <code>TRUE</code> means that the partitioning, agglomeration and wall distance are stored and reused.
+   */
+  bool GetGeometry_Cache(void) const { return Geometry_Cache; }
+
   /*!
    * \brief Get the Courant Friedrich Levi number for unsteady simulations.
    * \return CFL number for unsteady simulations.
@@ -3662,6 +3733,44 @@ public:
    */
   su2double GetAcentric_Factor(void) const { return Acentric_Factor; }
 
+  /*!
+   * \brief Check if the fluid model is replaced by its tabulated version.
+   * \return <code>TRUE</code> if the fluid properties are interpolated from a table.
+   */
+  bool GetFluidTable(void) const { return FluidTable; }
+
+  /*!
+   * \brief Get the number of density points of the fluid table.
+   * \return Number of points in the (logarithmic) density direction.
+   */
+  unsigned short GetFluidTable_nDensity(void) const { return FluidTable_nDensity; }
+
+  /*!
+   * \brief Get the number of energy points of the fluid table.
+   * \return Number of points in the internal energy direction.
+   */
+  unsigned short GetFluidTable_nEnergy(void) const { return FluidTable_nEnergy; }
+
+  /*!
+   * \brief Get the density range of the fluid table.
+   * \param[in] val_index - 0 for the minimum, 1 for the maximum.
+   * \return Dimensional density, (0,0) selects a range around the free-stream.
+   */
+  su2double GetFluidTable_DensityRange(unsigned short val_index) const { return FluidTable_DensityRange[val_index]; }
+
+  /*!
+   * \brief Get the temperature range of the fluid table.
+   * \param[in] val_index - 0 for the minimum, 1 for the maximum.
+   * \return Dimensional temperature, (0,0) selects a range around the free-stream.
+   */
+  su2double GetFluidTable_TemperatureRange(unsigned short val_index) const { return FluidTable_TemperatureRange[val_index]; }
+
+  /*!
+   * \brief Get the name of the file that stores the fluid table.
+   * \return File name.
+   */
+  string GetFluidTable_FileName(void) const { return FluidTable_FileName; }
+
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -3864,6 +3973,12 @@ public:
    */
   bool GetReconstructionGradientRequired(void) { return ReconstructionGradientRequired; }
 
+  /*!
+   * \brief Get flag for whether the geometric weights of least-squares gradients are precomputed.
+   * \return <code>TRUE</code> if the weights are computed once (per grid update) and reused by all solvers.
+   */
+  bool GetLeastSquaresPrecomputed(void) const { return LeastSquaresPrecomputed; }
+
   /*!
    * \brief Get flag for whether a least-squares gradient method is being applied.
    * \return <code>TRUE</code> means that a least-squares gradient method is being applied.
@@ -3937,6 +4052,26 @@ public:
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get the dimension of the subspace recycled between linear solves (FGCRODR).
+   * \return Number of recycled vectors.
+   */
+  unsigned long GetLinear_Solver_Recycle_Dim(void) const { return Linear_Solver_Recycle_Dim; }
+
+  /*!
+   * \brief Get the maximum number of iterations that reuse (lag) the Jacobian and its preconditioner.
+   * \return Number of iterations, 0 if the Jacobian is assembled every iteration.
+   */
+  unsigned long GetJacobian_Lag_Iter(void) const { return Jacobian_Lag_Iter; }
+
+  /*!
+   * \brief Get the criteria that refresh a lagged Jacobian before JACOBIAN_LAG_ITER is reached.
+   * \param[in] val_index - 0: growth factor of the linear iterations (or residual) w.r.t. the first solve,
+   *                        1: ratio of the nonlinear residual to the one of the previous iteration.
+   * \return Value of the parameter.
+   */
+  su2double GetJacobian_LagParam(unsigned short val_index) const { return Jacobian_LagParam[val_index]; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
@@ -5227,6 +5362,12 @@ public:
    */
   string GetMesh_Out_FileName(void) const { return Mesh_Out_FileName; }
 
+  /*!
+   * \brief Get the root name of the preprocessed geometry cache files (one per rank and zone).
+   * \return Root name of the cache files.
+   */
+  string GetGeometry_Cache_FileName(void) const { return Geometry_Cache_FileName; }
+
   /*!
    * \brief Get the name of the file with the solution of the flow problem.
    * \return Name of the file with the solution of the flow problem.
@@ -5757,6 +5898,12 @@ public:
    */
   bool GetHB_Precondition(void) const { return HB_Precondition; }
 
+  /*!
+   * \brief Get if the harmonic balance time instances are iterated concurrently.
+   * \return yes or no to one thread and MPI communicator per time instance
+   */
+  bool GetHB_Concurrent_Instances(void) const { return HB_Concurrent_Instances; }
+
   /*!
    * \brief Get if we should update the motion origin.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -9157,6 +9304,62 @@ public:
    */
   unsigned short GetnVolumeOutputFiles() const { return nVolumeOutputFiles; }
 
+  /*!
+   * \brief Whether the halos of the neighbors on the same node are exchanged through shared memory windows.
+   */
+  bool GetHalo_Shared_Memory() const { return Halo_Shared_Memory; }
+
+  /*!
+   * \brief Get the type of vertex weights used to partition the grid.
+   */
+  unsigned short GetKind_Partition_Weights() const { return Kind_Partition_Weights; }
+
+  /*!
+   * \brief Whether the work of each rank is measured during the run and its imbalance reported at the end of it.
+   */
+  bool GetWrt_Load_Imbalance() const { return Wrt_Load_Imbalance; }
+
+  /*!
+   * \brief Get the number of flow probes.
+   */
+  unsigned short GetnProbes() const { return nProbe_Coords/3; }
+
+  /*!
+   * \brief Get the coordinates of a flow probe.
+   * \param[in] iProbe - Index of the probe.
+   * \return Pointer to the 3 coordinates of the probe.
+   */
+  const su2double* GetProbe_Coord(unsigned short iProbe) const { return &Probe_Coords[3*iProbe]; }
+
+  /*!
+   * \brief Get the iteration frequency at which the probes are interpolated.
+   */
+  unsigned long GetProbe_Wrt_Freq() const { return ProbeWrtFreq; }
+
+  /*!
+   * \brief Get the number of slice planes.
+   */
+  unsigned short GetnSlices() const { return nSlice_Planes/6; }
+
+  /*!
+   * \brief Get the origin of a slice plane.
+   * \param[in] iSlice - Index of the slice.
+   * \return Pointer to the 3 coordinates of the origin.
+   */
+  const su2double* GetSlice_Origin(unsigned short iSlice) const { return &Slice_Planes[6*iSlice]; }
+
+  /*!
+   * \brief Get the normal of a slice plane.
+   * \param[in] iSlice - Index of the slice.
+   * \return Pointer to the 3 components of the (not necessarily unit) normal.
+   */
+  const su2double* GetSlice_Normal(unsigned short iSlice) const { return &Slice_Planes[6*iSlice+3]; }
+
+  /*!
+   * \brief Get the iteration frequency at which the slices are written.
+   */
+  unsigned long GetSlice_Wrt_Freq() const { return SliceWrtFreq; }
+
   /*!
    * \brief Get the desired factorization frequency for PaStiX
    * \return Number of calls to 'Build' that trigger re-factorization.
@@ -45,6 +45,20 @@
  */
 class CBlasStructure {
 public:
+  /*!
+   * \brief Type of the matrix multiplication kernels that are specialized on
+            the number of columns of A, see gemm for the arguments.
+   */
+  typedef void (*GemmKernel)(const int M, const int N, const su2double *A,
+                             const su2double *B, su2double *C);
+
+  /*!
+   * \brief Largest number of columns of A for which a specialized kernel exists.
+            This covers the number of DOFs of the standard elements used in the
+            DG solver up to polynomial degree 4 in 2D and degree 3 in 3D.
+   */
+  static const int maxKFixedKernel = 64;
+
   /*!
    * \brief Constructor of the class. Initialize the constant member variables.
    */
@@ -69,6 +83,23 @@ public:
             const su2double *A, const su2double *B, su2double *C,
             CConfig *config);
 
+  /*!
+   * \brief Function, which carries out a dense matrix product with the library
+            (LIBXSMM, MKL or BLAS) or the blocked native implementation, i.e. without
+            the kernels that are specialized on K. See gemm for the arguments.
+   */
+  void gemm_generic(const int M,        const int N,        const int K,
+                    const su2double *A, const su2double *B, su2double *C);
+
+  /*!
+   * \brief Function, which returns the kernel that is specialized on the given K.
+   * \param[in] K - Number of columns of A and number of rows of B.
+   * \return Pointer to the kernel, NULL if no specialized kernel exists for K.
+   */
+  inline GemmKernel GetFixedKernel(const int K) const {
+    return ((K > 0) && (K <= maxKFixedKernel)) ? fixedKernels[K] : NULL;
+  }
+
   /*!
    * \brief Function, which carries out a dense matrix vector product
             y = A x. It is a limited version of the BLAS gemv functionality.
@@ -97,6 +128,8 @@ public:
 
 private:
 
+  GemmKernel fixedKernels[maxKFixedKernel+1]; /*!< \brief Kernels specialized on K, built once in the constructor. */
+
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
     /* Blocking parameters for the outer kernel.  We multiply mc x kc blocks of
      the matrix A with kc x nc panels of the matrix B (this approach is referred
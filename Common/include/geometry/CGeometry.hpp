@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../mpi_structure.hpp"
+#include "../omp_structure.hpp"
 
 #ifdef HAVE_METIS
 #include "metis.h"
@@ -163,17 +164,25 @@ protected:
   su2double **SpanAreaOut;               /*!< \brief Area at each span wise section for each turbomachinery marker.*/
   su2double **TurboRadiusIn;
   su2double **TurboRadiusOut;            /*!< \brief Radius at each span wise section for each turbomachinery marker*/
+  SU2_MPI::Comm turboComm[2] = {SU2_MPI::GetComm(), SU2_MPI::GetComm()}; /*!< \brief Communicators of the ranks with inflow/outflow turbo markers. */
+  bool turboCommSplit[2] = {false, false};                        /*!< \brief Whether the turbo communicators were created (and need to be freed). */
 
-  /*--- Sparsity patterns associated with the geometry. ---*/
+  /*--- Sparsity patterns associated with the geometry, shared (read-only) by all the
+   matrices of the grid, i.e. each distinct pattern is built once per multigrid level. ---*/
 
   CCompressedSparsePatternUL
   finiteVolumeCSRFill0,                  /*!< \brief 0-fill FVM sparsity. */
-  finiteVolumeCSRFillN,                  /*!< \brief N-fill FVM sparsity (e.g. for ILUn preconditioner). */
-  finiteElementCSRFill0,                 /*!< \brief 0-fill FEM sparsity. */
-  finiteElementCSRFillN;                 /*!< \brief N-fill FEM sparsity (e.g. for ILUn preconditioner). */
+  finiteElementCSRFill0;                 /*!< \brief 0-fill FEM sparsity. */
+
+  map<unsigned long, CCompressedSparsePatternUL>
+  finiteVolumeCSRFillN,                  /*!< \brief N-fill FVM sparsity for each level of fill (e.g. for ILUn preconditioner). */
+  finiteElementCSRFillN;                 /*!< \brief N-fill FEM sparsity for each level of fill (e.g. for ILUn preconditioner). */
 
   CEdgeToNonZeroMapUL edgeToCSRMap;      /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
 
+  map<const void*, set<const void*> >
+  sparsePatternUsers;                    /*!< \brief Distinct matrices using each N-fill pattern, to report the memory saved by sharing. */
+
   /*--- Edge and element colorings. ---*/
 
   CCompressedSparsePatternUL
@@ -182,6 +191,22 @@ protected:
   unsigned long edgeColorGroupSize = 1;  /*!< \brief Size of the edge groups within each color. */
   unsigned long elemColorGroupSize = 1;  /*!< \brief Size of the element groups within each color. */
 
+  /*--- Multigrid agglomeration. ---*/
+
+  CCompressedSparsePatternUL
+  childrenCV;                            /*!< \brief Children (fine grid points) of each control volume of a coarse grid. */
+
+  /*--- Least-squares gradients. ---*/
+
+  su2activematrix
+  lsqWeightsUnweighted,                  /*!< \brief Precomputed unweighted least-squares weights, nDim for each side of each edge. */
+  lsqWeightsWeighted;                    /*!< \brief Precomputed inverse-distance-weighted least-squares weights, same layout. */
+
+  /*--- MUSCL reconstruction and limiters. ---*/
+
+  su2activematrix
+  edgeHalfVectors;                       /*!< \brief Vector from the first node of each edge to its midpoint (nEdge x nDim). */
+
 public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -207,7 +232,6 @@ public:
 
   /*--- Data structures for point-to-point MPI communications. ---*/
 
-  int countPerPoint;                     /*!< \brief Maximum number of pieces of data sent per vertex in point-to-point comms. */
   int nP2PSend;                          /*!< \brief Number of sends during point-to-point comms. */
   int nP2PRecv;                          /*!< \brief Number of receives during point-to-point comms. */
   int *nPoint_P2PSend;                   /*!< \brief Data structure holding number of vertices for each send in point-to-point comms. */
@@ -218,16 +242,12 @@ public:
   map<int, int> P2PRecv2Neighbor;        /*!< \brief Data structure holding the reverse mapping of the ranks of the neighbors for point-to-point recv comms. */
   unsigned long *Local_Point_P2PSend;    /*!< \brief Data structure holding the local index of all vertices to be sent in point-to-point comms. */
   unsigned long *Local_Point_P2PRecv;    /*!< \brief Data structure holding the local index of all vertices to be received in point-to-point comms. */
-  su2double *bufD_P2PRecv;               /*!< \brief Data structure for su2double point-to-point receive. */
-  su2double *bufD_P2PSend;               /*!< \brief Data structure for su2double point-to-point send. */
-  unsigned short *bufS_P2PRecv;          /*!< \brief Data structure for unsigned long point-to-point receive. */
-  unsigned short *bufS_P2PSend;          /*!< \brief Data structure for unsigned long point-to-point send. */
-  SU2_MPI::Request *req_P2PSend;         /*!< \brief Data structure for point-to-point send requests. */
-  SU2_MPI::Request *req_P2PRecv;         /*!< \brief Data structure for point-to-point recv requests. */
+  bool sharedHalo = false;               /*!< \brief Whether the neighbors on the same node exchange su2double data through shared memory. */
+
+  passivedouble workTime = 0.0;          /*!< \brief Time spent by this rank in the spatial integration (WRT_LOAD_IMBALANCE). */
 
   /*--- Data structures for periodic communications. ---*/
 
-  int countPerPeriodicPoint;             /*!< \brief Maximum number of pieces of data sent per vertex in periodic comms. */
   int nPeriodicSend;                     /*!< \brief Number of sends during periodic comms. */
   int nPeriodicRecv;                     /*!< \brief Number of receives during periodic comms. */
   int *nPoint_PeriodicSend;              /*!< \brief Data structure holding number of vertices for each send in periodic comms. */
@@ -241,12 +261,46 @@ public:
   *Local_Point_PeriodicRecv,             /*!< \brief Data structure holding the local index of all vertices to be received in periodic comms. */
   *Local_Marker_PeriodicSend,            /*!< \brief Data structure holding the local index of the periodic marker for a particular vertex to be sent in periodic comms. */
   *Local_Marker_PeriodicRecv;            /*!< \brief Data structure holding the local index of the periodic marker for a particular vertex to be received in periodic comms. */
-  su2double *bufD_PeriodicRecv;          /*!< \brief Data structure for su2double periodic receive. */
-  su2double *bufD_PeriodicSend;          /*!< \brief Data structure for su2double periodic send. */
-  unsigned short *bufS_PeriodicRecv;     /*!< \brief Data structure for unsigned long periodic receive. */
-  unsigned short *bufS_PeriodicSend;     /*!< \brief Data structure for unsigned long periodic send. */
-  SU2_MPI::Request *req_PeriodicSend;    /*!< \brief Data structure for periodic send requests. */
-  SU2_MPI::Request *req_PeriodicRecv;    /*!< \brief Data structure for periodic recv requests. */
+
+  /*!
+   * \brief Buffers and requests of the point-to-point and periodic comms, i.e. the data that changes when
+   *        communicating. Time instances that share the geometry and iterate concurrently communicate at the
+   *        same time, each with its own MPI communicator (see SU2_MPI::SetThreadComm), hence they need their
+   *        own set. The set is selected by the communicator of the calling thread.
+   */
+  struct CCommBuffers {
+    SU2_MPI::Comm comm;                           /*!< \brief Communicator that uses this set. */
+
+    int countPerPoint = 0;                        /*!< \brief Maximum number of pieces of data sent per vertex in point-to-point comms. */
+    su2double *bufD_P2PRecv = nullptr;            /*!< \brief Data structure for su2double point-to-point receive. */
+    su2double *bufD_P2PSend = nullptr;            /*!< \brief Data structure for su2double point-to-point send. */
+    unsigned short *bufS_P2PRecv = nullptr;       /*!< \brief Data structure for unsigned long point-to-point receive. */
+    unsigned short *bufS_P2PSend = nullptr;       /*!< \brief Data structure for unsigned long point-to-point send. */
+    vector<SU2_MPI::Request> req_P2PSend;         /*!< \brief Data structure for point-to-point send requests. */
+    vector<SU2_MPI::Request> req_P2PRecv;         /*!< \brief Data structure for point-to-point recv requests. */
+    vector<SU2_MPI::Request> reqPersistent_P2PSend[4]; /*!< \brief Persistent send requests for each data type and direction of the point-to-point comms. */
+    vector<SU2_MPI::Request> reqPersistent_P2PRecv[4]; /*!< \brief Persistent recv requests for each data type and direction of the point-to-point comms. */
+
+    /*--- Data structures for the exchange of su2double data with the neighbors on the same node through shared memory. ---*/
+
+    bool sharedP2P = false;                       /*!< \brief Whether the receive buffer (bufD_P2PRecv) is a shared memory window of the node. */
+    SU2_MPI::Comm nodeComm;                       /*!< \brief Communicator of the ranks on the same node. */
+    SU2_MPI::Win winP2PRecv;                      /*!< \brief Shared memory window of the su2double receive buffers. */
+    vector<int> nodeRank_P2PSend;                 /*!< \brief Rank in the node of each send neighbor, -1 if it is on another node. */
+    vector<int> remoteOffset_P2PSend;             /*!< \brief Location (in points) of each send message in the receive buffer of the neighbor. */
+    vector<su2double*> remoteBuf_P2PSend;         /*!< \brief Receive buffer of each node-local send neighbor. */
+    vector<SU2_MPI::Request> reqShared_P2PReady;  /*!< \brief Persistent "ready to receive" sends to the node-local sources. */
+    vector<SU2_MPI::Request> reqShared_P2PWait;   /*!< \brief Persistent "ready to receive" recvs from the node-local destinations. */
+
+    int countPerPeriodicPoint = 0;                /*!< \brief Maximum number of pieces of data sent per vertex in periodic comms. */
+    su2double *bufD_PeriodicRecv = nullptr;       /*!< \brief Data structure for su2double periodic receive. */
+    su2double *bufD_PeriodicSend = nullptr;       /*!< \brief Data structure for su2double periodic send. */
+    unsigned short *bufS_PeriodicRecv = nullptr;  /*!< \brief Data structure for unsigned long periodic receive. */
+    unsigned short *bufS_PeriodicSend = nullptr;  /*!< \brief Data structure for unsigned long periodic send. */
+    vector<SU2_MPI::Request> req_PeriodicSend;    /*!< \brief Data structure for periodic send requests. */
+    vector<SU2_MPI::Request> req_PeriodicRecv;    /*!< \brief Data structure for periodic recv requests. */
+  };
+  vector<CCommBuffers*> commBuffers;             /*!< \brief Sets of comm buffers, one per communicator. */
 
   /*--- Mesh quality metrics. ---*/
 
@@ -305,6 +359,52 @@ public:
    */
   void PostP2PSends(CGeometry *geometry, CConfig *config, unsigned short commType, int val_iMessage, bool val_reverse);
 
+  /*!
+   * \brief Make the data written by node-local neighbors into the shared recv buffer visible to this rank.
+   * \note Call after a recv of the point-to-point comms completes and before the buffer is read.
+   * \param[in] commType    - Enumerated type for the quantity to be communicated.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   */
+  void SyncSharedP2PRecv(unsigned short commType, bool val_reverse);
+
+  /*!
+   * \brief Create the persistent requests of the point-to-point comms for a data type and direction.
+   * \note The requests are bound to the current communication buffers, they are freed (and created again
+   *       on first use) when the buffers are reallocated. Not used with AD types (not supported by the AD MPI wrapper).
+   * \param[in] commType    - Enumerated type for the quantity to be communicated.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   */
+  void InitPersistentP2PComms(unsigned short commType, bool val_reverse);
+
+  /*!
+   * \brief Free the persistent requests of the point-to-point comms.
+   */
+  void FreePersistentP2PComms();
+
+  /*!
+   * \brief Set up the exchange of su2double data with the neighbors on the same node through shared memory.
+   * \note The sender copies its message directly into the receive buffer of the neighbor (a shared memory window)
+   *       once the neighbor signals that the buffer is free, a zero-size message then signals that the data is
+   *       available. Only forward comms of su2double data use this path, the receive buffers are (re)allocated
+   *       collectively, which is the case since all ranks go through the same sequence of comms.
+   * \param[in] buf - Set of comm buffers.
+   */
+  void InitSharedP2PComms(CCommBuffers& buf);
+
+  /*!
+   * \brief Get the comm buffers of the communicator of the calling thread, they are created on first use.
+   * \note The first use of a communicator is collective and must happen outside of concurrent regions,
+   *       i.e. during the preprocessing of the time instance that uses it.
+   * \return Buffers and requests of the point-to-point and periodic comms.
+   */
+  CCommBuffers& GetCommBuffers();
+
+  /*!
+   * \brief Free the buffers and requests of a set of comm buffers.
+   * \param[in] buf - Set of comm buffers.
+   */
+  void FreeCommBuffers(CCommBuffers& buf);
+
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -429,6 +529,21 @@ public:
    */
   inline unsigned short GetnSpanWiseSections(unsigned short marker_flag) const { return nSpanWiseSections[marker_flag -1]; }
 
+  /*!
+   * \brief Create the communicator of the ranks that have a turbomachinery marker of a given kind.
+   * \note Collective over the communicator of SU2 (SU2_MPI::GetComm()), ranks without such a marker are grouped in a separate communicator.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] marker_flag - flag of the turbomachinery boundary.
+   */
+  void SetTurboComm(CConfig *config, unsigned short marker_flag);
+
+  /*!
+   * \brief Get the communicator over which the span wise averages of a kind of turbomachinery marker are reduced.
+   * \param[in] marker_flag - flag of the turbomachinery boundary.
+   * \return MPI communicator (the communicator of SU2 if SetTurboComm was not called).
+   */
+  inline SU2_MPI::Comm GetTurboComm(unsigned short marker_flag) const { return turboComm[marker_flag-1]; }
+
   /*!
    * \brief Get number of vertices.
    * \param[in] val_marker - Marker of the boundary.
@@ -1614,14 +1729,37 @@ public:
    */
   inline virtual void ComputeMeshQualityStatistics(CConfig *config) {}
 
+  /*!
+   * \brief Report the imbalance (max/mean-1) of the time spent by the ranks in the spatial integration.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ReportLoadImbalance(CConfig *config) const;
+
+  /*!
+   * \brief Add to the time spent by this rank in the spatial integration.
+   * \param[in] val_time - Elapsed time.
+   */
+  inline void AddWorkTime(passivedouble val_time) {
+    /*--- Concurrent time instances may share the geometry. ---*/
+    SU2_OMP(atomic)
+    workTime += val_time;
+  }
+
+  /*!
+   * \brief Get the time spent by this rank in the spatial integration.
+   */
+  inline passivedouble GetWorkTime() const { return workTime; }
+
   /*!
    * \brief Get the sparse pattern of "type" with given level of fill.
    * \note This method builds the pattern if that has not been done yet.
    * \param[in] type - Finite volume or finite element.
    * \param[in] fillLvl - Level of fill of the pattern.
+   * \param[in] user - Object (e.g. matrix) that keeps a reference to an N-fill pattern, each is counted once.
    * \return Reference to the sparse pattern.
    */
-  const CCompressedSparsePatternUL& GetSparsePattern(ConnectivityType type, unsigned long fillLvl);
+  const CCompressedSparsePatternUL& GetSparsePattern(ConnectivityType type, unsigned long fillLvl,
+                                                     const void* user = nullptr);
 
   /*!
    * \brief Get the edge to sparse pattern map.
@@ -1630,6 +1768,13 @@ public:
    */
   const CEdgeToNonZeroMapUL& GetEdgeToSparsePatternMap(void);
 
+  /*!
+   * \brief Get the memory saved by sharing the N-fill (e.g. ILUn) patterns between matrices.
+   * \note This is the memory the extra copies would use if each distinct user had its own.
+   * \return Memory saved, in bytes.
+   */
+  unsigned long GetSparsePatternMemorySaved(void) const;
+
   /*!
    * \brief Get the edge coloring.
    * \note This method computes the coloring if that has not been done yet.
@@ -1656,5 +1801,51 @@ public:
    */
   inline unsigned long GetElementColorGroupSize(void) const { return elemColorGroupSize; }
 
+  /*!
+   * \brief Get the map from the control volumes of an agglomerated grid to their children in the finer grid.
+   * \note The outer indices are coarse points and the inner indices fine points, the map is empty on MESH_0.
+   * \return Reference to the map.
+   */
+  inline const CCompressedSparsePatternUL& GetChildrenCV(void) const { return childrenCV; }
+
+  /*!
+   * \brief Set the map from the control volumes of an agglomerated grid to their children in the finer grid.
+   * \param[in] children - Map in CSR format, see GetChildrenCV.
+   */
+  inline void SetChildrenCV(CCompressedSparsePatternUL&& children) { childrenCV = std::move(children); }
+
+  /*!
+   * \brief Get the precomputed weights of least-squares gradients.
+   * \note The weights are computed by the gradient routines on first use and cleared
+   *       when the dual grid is updated (i.e. when the coordinates change).
+   * \param[in] weighted - Inverse-distance-weighted or unweighted least-squares.
+   * \return Reference to the weights (nEdge x 2*nDim), empty if they need to be computed.
+   */
+  inline su2activematrix& GetLeastSquaresWeights(bool weighted) {
+    return weighted? lsqWeightsWeighted : lsqWeightsUnweighted;
+  }
+
+  /*!
+   * \brief Discard the precomputed weights of least-squares gradients.
+   */
+  inline void ClearLeastSquaresWeights(void) {
+    lsqWeightsWeighted = su2activematrix();
+    lsqWeightsUnweighted = su2activematrix();
+  }
+
+  /*!
+   * \brief Compute the vectors from the first node of each edge to the edge midpoint.
+   * \note Called whenever the edge CG's are recomputed, i.e. when the coordinates change.
+   */
+  void SetEdgeHalfVectors(void);
+
+  /*!
+   * \brief Get the vector from the first node of an edge to its midpoint, i.e. 0.5*(x_j - x_i).
+   * \note The vector from the second node is the symmetric of this one.
+   * \param[in] iEdge - Edge index.
+   * \return Pointer to the nDim components.
+   */
+  inline const su2double* GetEdgeHalfVector(unsigned long iEdge) const { return edgeHalfVectors[iEdge]; }
+
 };
 
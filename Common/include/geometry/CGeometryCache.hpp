@@ -0,0 +1,133 @@
+/*!
+ * \file CGeometryCache.hpp
+ * \brief Headers of the class that stores preprocessed geometry data between runs.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CGeometry.hpp"
+
+/*!
+ * \class CGeometryCache
+ * \brief Per-rank binary cache of the results of the most expensive geometry preprocessing steps.
+ * \details The cache is keyed by a hash of the linearly partitioned mesh (coordinates and
+ *          connectivity), the number of ranks, and the options that influence the preprocessing.
+ *          When the key matches on all ranks, the graph partitioning (ParMETIS coloring), the
+ *          multigrid agglomeration and the wall distance are restored instead of recomputed.
+ *          Since the remaining preprocessing is deterministic, it reproduces the same dual grid.
+ */
+class CGeometryCache {
+private:
+  int rank, size;                 /*!< \brief MPI rank and size. */
+  string fileName;                /*!< \brief Name of the cache file of this rank. */
+  unsigned long long key;         /*!< \brief Hash of the mesh and of the relevant options. */
+  bool loaded;                    /*!< \brief True if a matching cache was loaded on all ranks. */
+
+  vector<unsigned long> coloring; /*!< \brief Partition of each point of the linear partition. */
+  vector<vector<unsigned long> > agglomeration; /*!< \brief Agglomeration of each coarse level. */
+  vector<passivedouble> wallDistance;           /*!< \brief Wall distance of the points of the final partition. */
+
+  /*!
+   * \brief Add a block of data to the key (64-bit FNV-1a hash).
+   * \param[in] data - Pointer to the data.
+   * \param[in] nBytes - Size of the data in bytes.
+   */
+  void HashData(const void *data, size_t nBytes);
+
+  /*!
+   * \brief Read the cache file of this rank, the data is only kept if the key matches.
+   * \param[in] nPointLinear - Number of points of the linearly partitioned geometry.
+   * \return True if the file exists, was created for the current key, and its sizes are consistent.
+   */
+  bool ReadFile(unsigned long nPointLinear);
+
+  /*!
+   * \brief Check the layout of the agglomeration of each level, and that the levels follow each other.
+   * \return True if the parent and children indices are within the coarse and fine grids.
+   */
+  bool CheckAgglomeration(void) const;
+
+public:
+  /*!
+   * \brief Constructor of the class, computes the key and tries to load a matching cache.
+   * \param[in] geometry - Linearly partitioned geometry, before the graph partitioning.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CGeometryCache(const CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Check whether a matching cache was loaded.
+   * \return True if the preprocessing steps can be restored from the cache.
+   */
+  inline bool IsLoaded(void) const { return loaded; }
+
+  /*!
+   * \brief Restore the graph partitioning of the linearly partitioned geometry.
+   * \param[in] geometry - Linearly partitioned geometry, its points are colored.
+   * \return True if the coloring was restored.
+   */
+  bool GetColoring(CGeometry *geometry) const;
+
+  /*!
+   * \brief Store the graph partitioning of the linearly partitioned geometry.
+   * \param[in] geometry - Linearly partitioned geometry, after the coloring.
+   */
+  void SetColoring(const CGeometry *geometry);
+
+  /*!
+   * \brief Restore the agglomeration of a multigrid level.
+   * \param[in] iMesh - Multigrid level.
+   * \param[in] fine_grid - Geometry of the fine level, its parent indices are set.
+   * \param[in] coarse_grid - Geometry of the coarse level, its points must already be allocated.
+   * \return True if the agglomeration was restored.
+   */
+  bool GetAgglomeration(unsigned short iMesh, CGeometry *fine_grid, CGeometry *coarse_grid) const;
+
+  /*!
+   * \brief Store the agglomeration of a multigrid level.
+   * \param[in] iMesh - Multigrid level.
+   * \param[in] fine_grid - Geometry of the fine level.
+   * \param[in] coarse_grid - Geometry of the coarse level.
+   */
+  void SetAgglomeration(unsigned short iMesh, const CGeometry *fine_grid, const CGeometry *coarse_grid);
+
+  /*!
+   * \brief Restore the wall distance of the fine grid.
+   * \param[in] geometry - Geometry of the fine grid.
+   * \return True if the wall distance was restored.
+   */
+  bool GetWallDistance(CGeometry *geometry) const;
+
+  /*!
+   * \brief Store the wall distance of the fine grid.
+   * \param[in] geometry - Geometry of the fine grid.
+   */
+  void SetWallDistance(const CGeometry *geometry);
+
+  /*!
+   * \brief Write the cache file of this rank.
+   */
+  void WriteFile(void) const;
+
+};
@@ -29,6 +29,8 @@
 
 #include "CGeometry.hpp"
 
+class CGeometryCache;
+
 /*!
  * \class CMultiGridGeometry
  * \brief Class for defining the multigrid geometry, the main delicated part is the
@@ -37,6 +39,15 @@
  */
 class CMultiGridGeometry final : public CGeometry {
 
+private:
+  /*!
+   * \brief Agglomerate the control volumes of the fine grid to create the coarse grid points.
+   * \note The children of each coarse control volume are then stored in compressed (CSR) format, see GetChildrenCV.
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetAgglomeration(CGeometry *fine_grid, CConfig *config);
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
@@ -50,9 +61,10 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] iMesh - Level of the multigrid.
-   * \param[in] iZone - Current zone in the mesh.
+   * \param[in] cache - Preprocessed geometry cache from which the agglomeration may be restored (optional).
    */
-  CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh);
+  CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh,
+                     const CGeometryCache *cache = NULL);
 
   /*!
    * \brief Destructor of the class.
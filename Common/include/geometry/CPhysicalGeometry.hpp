@@ -536,6 +536,29 @@ public:
    */
   void SetColorGrid_Parallel(CConfig *config) override;
 
+  /*!
+   * \brief Cost model of a point, the work of the residual and of the linear solver scales with the number of edges.
+   * \param[in] nNeighbor - Number of neighbors of the point.
+   * \param[in] boundaryCost - Sum of the cost of the boundary vertices of the point.
+   */
+  static passivedouble PointCost(unsigned long nNeighbor, passivedouble boundaryCost) {
+    return 1.0 + nNeighbor + boundaryCost;
+  }
+
+  /*!
+   * \brief Cost model of a boundary vertex, relative to the cost of an edge.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] markerTag - Name of the marker.
+   */
+  static passivedouble VertexCost(CConfig *config, const string& markerTag);
+
+  /*!
+   * \brief Vertex weights of the linearly partitioned points for the graph partitioning (PARTITION_WEIGHTS).
+   * \param[in] config - Definition of the particular problem.
+   * \return Weight of each point, from the cost model.
+   */
+  vector<passivedouble> GetPartitionWeights(CConfig *config);
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
@@ -59,8 +59,6 @@ private:
   su2double *GridVel;                 /*!< \brief Velocity of the grid for dynamic mesh cases. */
   su2double **GridVel_Grad;           /*!< \brief Gradient of the grid velocity for dynamic meshes. */
   unsigned long Parent_CV;            /*!< \brief Index of the parent control volume in the agglomeration process. */
-  unsigned short nChildren_CV;        /*!< \brief Number of children in the agglomeration process. */
-  vector<unsigned long> Children_CV;  /*!< \brief Index of the children control volumes in the agglomeration process. */
   bool Agglomerate_Indirect,          /*!< \brief This flag indicates if the indirect points can be agglomerated. */
   Agglomerate;                        /*!< \brief This flag indicates if the element has been agglomerated. */
   bool Move;                          /*!< \brief This flag indicates if the point is going to be move in the grid deformation process. */
@@ -556,29 +554,12 @@ public:
    */
   inline void SetParent_CV(unsigned long val_parent_CV) { Parent_CV = val_parent_CV; Agglomerate = true; }
 
-  /*!
-   * \brief Set the children control volumes of an agglomerated control volume.
-   * \param[in] val_nchildren_CV - Number of children.
-   * \param[in] val_children_CV - Index of the children control volume.
-   */
-  inline void SetChildren_CV(unsigned short val_nchildren_CV, unsigned long val_children_CV) {
-    if (Children_CV.size() <= val_nchildren_CV) Children_CV.resize(val_nchildren_CV+1);
-    Children_CV[val_nchildren_CV] = val_children_CV;
-  }
-
   /*!
    * \brief Get the parent control volume of an agglomerated control volume.
    * \return Index of the parent control volume.
    */
   inline unsigned long GetParent_CV(void) const { return Parent_CV; }
 
-  /*!
-   * \brief Get the children control volume of an agglomerated control volume.
-   * \param[in] val_nchildren_CV - Number of the children.
-   * \return Index of the parent control volume.
-   */
-  inline unsigned long GetChildren_CV(unsigned short val_nchildren_CV) const {  return Children_CV[val_nchildren_CV]; }
-
   /*!
    * \brief Get information about if a control volume has been agglomerated.
    * \return <code>TRUE</code> if the point has been agglomerated; otherwise <code>FALSE</code>.
@@ -597,18 +578,6 @@ public:
    */
   inline void SetAgglomerate_Indirect(bool val_agglomerate) { Agglomerate_Indirect = val_agglomerate; };
 
-  /*!
-   * \brief Get the number of children of an agglomerated control volume.
-   * \return Number of children control volume.
-   */
-  inline unsigned short GetnChildren_CV(void) const { return nChildren_CV; }
-
-  /*!
-   * \brief Set the number of children of an agglomerated control volume.
-   * \param[in] val_nchildren_CV - Number of children of the control volume.
-   */
-  inline void SetnChildren_CV(unsigned short val_nchildren_CV) {  nChildren_CV = val_nchildren_CV; }
-
   /*!
    * \brief Get the value of the summed coordinates for implicit smoothing.
    * \return Sum of coordinates at a point.
@@ -89,6 +89,7 @@ private:
   unsigned long nPointDomain;       /*!< \brief Number of points in the grid (excluding halos). */
   unsigned long nVar;               /*!< \brief Number of variables. */
   unsigned long nEqn;               /*!< \brief Number of equations. */
+  unsigned long blockSizeKernel;    /*!< \brief Block size of the specialized kernels (1 to 5), 0 for the generic ones. */
 
   ScalarType *matrix;               /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;                /*!< \brief Number of possible nonzero entries in the matrix. */
@@ -105,6 +106,8 @@ private:
 
   ScalarType *invM;                 /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
+  bool frozen;                      /*!< \brief The values (and preconditioner) are lagged, updates have no effect. */
+
   unsigned long nLinelet;                      /*!< \brief Number of Linelets in the system. */
   vector<bool> LineletBool;                    /*!< \brief Identify if a point belong to a Linelet. */
   vector<vector<unsigned long> > LineletPoint; /*!< \brief Linelet structure. */
@@ -293,40 +296,85 @@ private:
   inline void SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType *val_block);
 
   /*!
-   * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
-   * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
+   * \brief Performs the product of i-th row of a sparse matrix by a vector.
+   * \param[in] vec - Vector to be multiplied by the row of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
-   * \param[in] col_ub - Exclusive upper bound for column indices considered in multiplication.
-   * \param[out] prod - Result of the product U(A)*vec.
+   * \return Result of the product (stored at *prod_row_vector).
    */
-  inline void UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
-                           unsigned long col_ub, ScalarType *prod) const;
+  void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
 
   /*!
-   * \brief Performs the product of i-th row of the lower part of a sparse matrix by a vector.
-   * \param[in] vec - Vector to be multiplied by the lower part of the sparse matrix A.
-   * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
-   * \param[in] col_lb - Inclusive lower bound for column indices considered in multiplication.
-   * \param[out] prod - Result of the product L(A)*vec.
+   * \brief Block matrix-vector product, "alpha" and "beta" have the same meaning as in gemv_impl.
+   * \note For N > 0 the block size is known at compilation and the loops are unrolled,
+   *       for N = 0 the runtime size kernels (possibly MKL JIT) are used.
+   * \param[in] a - Block.
+   * \param[in] b - Vector.
+   * \param[in,out] c - Result.
    */
-  inline void LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
-                           unsigned long col_lb, ScalarType *prod) const;
+  template<unsigned long N, bool alpha, bool beta>
+  inline void BlockGemv(const ScalarType *a, const ScalarType *b, ScalarType *c) const;
 
   /*!
-   * \brief Performs the product of i-th row of the diagonal part of a sparse matrix by a vector.
-   * \param[in] vec - Vector to be multiplied by the diagonal part of the sparse matrix A.
-   * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
-   * \return prod Result of the product D(A)*vec (stored at *prod_row_vector).
+   * \brief Block matrix-matrix product, c = a*b, see BlockGemv for the meaning of N.
+   * \param[in] a - First block.
+   * \param[in] b - Second block.
+   * \param[out] c - Result.
    */
-  inline void DiagonalProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+  template<unsigned long N>
+  inline void BlockGemm(const ScalarType *a, const ScalarType *b, ScalarType *c) const;
 
   /*!
-   * \brief Performs the product of i-th row of a sparse matrix by a vector.
-   * \param[in] vec - Vector to be multiplied by the row of the sparse matrix A.
-   * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
-   * \return Result of the product (stored at *prod_row_vector).
+   * \brief Gaussian elimination with the (i,i) block, see BlockGemv for the meaning of N.
+   * \param[in] block_i - Index of the (i,i) diagonal block.
+   * \param[in,out] rhs - On entry the rhs, on exit the solution.
    */
-  void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+  template<unsigned long N>
+  inline void BlockGaussElimination(unsigned long block_i, ScalarType* rhs) const;
+
+  /*!
+   * \brief Thread-parallel sparse matrix-vector product (without communications) for block size N.
+   * \param[in] vec - Vector to be multiplied by the matrix.
+   * \param[out] prod - Result of the product.
+   */
+  template<unsigned long N>
+  void MatrixVectorProductKernel(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  /*!
+   * \brief Apply the Jacobi preconditioner (without communications) for block size N.
+   * \param[in] vec - Vector to be preconditioned.
+   * \param[out] prod - Result of the preconditioning.
+   */
+  template<unsigned long N>
+  void JacobiKernel(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  /*!
+   * \brief In-place incomplete LU factorization of the ILU matrix for block size N.
+   */
+  template<unsigned long N>
+  void ILUFactorizationKernel();
+
+  /*!
+   * \brief Forward and backward substitution of the ILU preconditioner (without communications) for block size N.
+   * \param[in] vec - Vector to be preconditioned.
+   * \param[out] prod - Result of the preconditioning.
+   */
+  template<unsigned long N>
+  void ILUSubstitutionKernel(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  /*!
+   * \brief Forward sweep of the LU-SGS preconditioner, (D+L).x* = b, for block size N.
+   * \param[in] vec - Right-hand-side, b.
+   * \param[out] prod - Result of the sweep, x*.
+   */
+  template<unsigned long N>
+  void LU_SGSForwardKernel(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  /*!
+   * \brief Backward sweep of the LU-SGS preconditioner, (D+U).x = D.x*, for block size N.
+   * \param[in,out] prod - On entry x*, on exit x.
+   */
+  template<unsigned long N>
+  void LU_SGSBackwardKernel(CSysVector<ScalarType> & prod) const;
 
 public:
 
@@ -353,6 +401,25 @@ public:
                   unsigned short nvar, unsigned short neqn,
                   bool EdgeConnect, CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Use the generic kernels instead of the ones specialized on the block size
+   *        (e.g. to compare them in SU2_BENCHMARK_SYSMATRIX), call after Initialize.
+   */
+  inline void SetGenericKernels(void) { blockSizeKernel = 0; }
+
+  /*!
+   * \brief Freeze (lag) the values of the matrix, while frozen the set/add/subtract/delete
+   *        methods have no effect and the preconditioner built from the matrix remains valid.
+   * \param[in] val_frozen - Freeze or release the matrix.
+   */
+  inline void SetFrozen(bool val_frozen) { frozen = val_frozen; }
+
+  /*!
+   * \brief Check if the values of the matrix are frozen.
+   * \return True if the matrix is not being assembled.
+   */
+  inline bool GetFrozen(void) const { return frozen; }
+
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
@@ -442,6 +509,8 @@ public:
   template<class OtherType>
   inline void SetBlock(unsigned long block_i, unsigned long block_j, OtherType **val_block) {
 
+    if (frozen) return;
+
     unsigned long iVar, jVar, index;
 
     for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
@@ -463,6 +532,8 @@ public:
   template<class OtherType>
   inline void SetBlock(unsigned long block_i, unsigned long block_j, const OtherType *val_block) {
 
+    if (frozen) return;
+
     unsigned long iVar, index;
 
     for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
@@ -485,6 +556,8 @@ public:
   inline void AddBlock(unsigned long block_i, unsigned long block_j,
                        OtherType alpha, const OtherType *val_block) {
 
+    if (frozen) return;
+
     unsigned long iVar, index;
 
     for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
@@ -505,6 +578,8 @@ public:
   template<class OtherType>
   inline void AddBlock(unsigned long block_i, unsigned long block_j, OtherType **val_block) {
 
+    if (frozen) return;
+
     unsigned long iVar, jVar, index;
 
     for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
@@ -526,6 +601,8 @@ public:
   template<class OtherType>
   inline void SubtractBlock(unsigned long block_i, unsigned long block_j, OtherType **val_block) {
 
+    if (frozen) return;
+
     unsigned long iVar, jVar, index;
 
     for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
@@ -552,6 +629,8 @@ public:
   inline void UpdateBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
                            OtherType **block_i, OtherType **block_j) {
 
+    if (frozen) return;
+
     ScalarType *bii = &matrix[dia_ptr[iPoint]*nVar*nEqn];
     ScalarType *bjj = &matrix[dia_ptr[jPoint]*nVar*nEqn];
     ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
@@ -578,6 +657,7 @@ public:
    */
   template<class OtherType>
   inline void AddVal2Diag(unsigned long block_i, OtherType val_matrix) {
+    if (frozen) return;
     for (auto iVar = 0ul; iVar < nVar; iVar++)
       matrix[dia_ptr[block_i]*nVar*nVar + iVar*(nVar+1)] += PassiveAssign<ScalarType,OtherType>(val_matrix);
   }
@@ -591,6 +671,8 @@ public:
   template<class OtherType>
   inline void SetVal2Diag(unsigned long block_i, OtherType val_matrix) {
 
+    if (frozen) return;
+
     unsigned long iVar, index = dia_ptr[block_i]*nVar*nVar;
 
     /*--- Clear entire block before setting its diagonal. ---*/
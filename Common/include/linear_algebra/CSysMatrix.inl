@@ -108,6 +108,30 @@ FORCEINLINE void gemm_impl(const unsigned long n, const T *a, const T *b, T *c)
   }
 }
 
+template<class T>
+FORCEINLINE void gauss_elimination_impl(const unsigned long n, T *a, T *b) {
+  /*--- Gaussian elimination without pivoting, "a" is overwritten and the solution is stored in "b". ---*/
+  unsigned long i, j, k;
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (i = 1; i < n; i++) {
+    for (j = 0; j < i; j++) {
+      T weight = a[i*n+j] / a[j*n+j];
+      for (k = j; k < n; k++)
+        a[i*n+k] -= weight * a[j*n+k];
+      b[i] -= weight * b[j];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (i = n; i > 0;) {
+    i--; // unsigned type
+    for (j = i+1; j < n; j++)
+      b[i] -= a[i*n+j] * b[j];
+    b[i] /= a[i*n+i];
+  }
+}
+
 #define __MATVECPROD_SIGNATURE__(TYPE,NAME) \
 FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector, TYPE *product) const
 
@@ -195,6 +219,48 @@ FORCEINLINE void CSysMatrix<su2double>::MatrixMatrixProduct(const su2double *mat
 #undef MATVECPROD_SIGNATURE
 #undef __MATVECPROD_SIGNATURE__
 
+/*---
+ The "Block" kernels below are used by the routines that are specialized for the block size.
+ When N is a compilation constant the loops of the *_impl functions are fully unrolled (and
+ vectorized where possible), the N = 0 fallback handles any size, using MKL if available.
+---*/
+
+template<class ScalarType>
+template<unsigned long N, bool alpha, bool beta>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockGemv(const ScalarType *a, const ScalarType *b, ScalarType *c) const {
+  if (N > 0) {
+    gemv_impl<ScalarType,alpha,beta,false>(N, a, b, c);
+  }
+  else {
+    if (!beta)      MatrixVectorProduct(a, b, c);
+    else if (alpha) MatrixVectorProductAdd(a, b, c);
+    else            MatrixVectorProductSub(a, b, c);
+  }
+}
+
+template<class ScalarType>
+template<unsigned long N>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockGemm(const ScalarType *a, const ScalarType *b, ScalarType *c) const {
+  if (N > 0) gemm_impl<ScalarType>(N, a, b, c);
+  else MatrixMatrixProduct(a, b, c);
+}
+
+template<class ScalarType>
+template<unsigned long N>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockGaussElimination(unsigned long block_i, ScalarType* rhs) const {
+  if (N > 0) {
+    /*--- Copy block, as the algorithm modifies the matrix ---*/
+    ScalarType block[MAXNVAR*MAXNVAR];
+    const ScalarType *diag = &matrix[dia_ptr[block_i]*N*N];
+    for (auto iVar = 0ul; iVar < N*N; ++iVar) block[iVar] = diag[iVar];
+
+    gauss_elimination_impl<ScalarType>(N, block, rhs);
+  }
+  else {
+    Gauss_Elimination(block_i, rhs);
+  }
+}
+
 template<class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, ScalarType* rhs, bool transposed) const {
 
@@ -224,38 +290,3 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned
 
   MatrixInverse(block, invBlock);
 }
-
-template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
-                                                      unsigned long col_ub, ScalarType *prod) const {
-  unsigned long iVar, index, col_j;
-
-  for (iVar = 0; iVar < nVar; iVar++) prod[iVar] = 0.0;
-
-  for (index = dia_ptr[row_i]+1; index < row_ptr[row_i+1]; index++) {
-    col_j = col_ind[index];
-    if (col_j < col_ub)
-      MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
-  }
-}
-
-template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
-                                                      unsigned long col_lb, ScalarType *prod) const {
-  unsigned long iVar, index, col_j;
-
-  for (iVar = 0; iVar < nVar; iVar++) prod[iVar] = 0.0;
-
-  for (index = row_ptr[row_i]; index < dia_ptr[row_i]; index++) {
-    col_j = col_ind[index];
-    if (col_j >= col_lb)
-      MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
-  }
-}
-
-template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<ScalarType> & vec,
-                                                         unsigned long row_i, ScalarType *prod) const {
-
-  MatrixVectorProduct(&matrix[dia_ptr[row_i]*nVar*nVar], &vec[row_i*nVar], prod);
-}
@@ -77,6 +77,9 @@ private:
   mutable bool bcg_ready;    /*!< \brief Indicate if memory used by BCGSTAB is allocated. */
   mutable bool gmres_ready;  /*!< \brief Indicate if memory used by FGMRES is allocated. */
   mutable bool smooth_ready; /*!< \brief Indicate if memory used by SMOOTHER is allocated. */
+  mutable bool pcg_ready;    /*!< \brief Indicate if memory used by pipelined CG is allocated. */
+  mutable bool pbcg_ready;   /*!< \brief Indicate if memory used by pipelined BCGSTAB is allocated. */
+  mutable bool gcrodr_ready; /*!< \brief Indicate if memory used by FGCRODR is allocated. */
 
   mutable VectorType r;      /*!< \brief Residual in CG and BCGSTAB. */
   mutable VectorType A_x;    /*!< \brief Result of matrix-vector product in CG and BCGSTAB. */
@@ -89,6 +92,26 @@ private:
   mutable vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  mutable vector<VectorType> PipeVec; /*!< \brief Work vectors of the pipelined CG and BCGSTAB. */
+
+  mutable vector<VectorType> RecV;    /*!< \brief Arnoldi basis of the FGCRODR cycles (orthogonal to RecC). */
+  mutable vector<VectorType> RecZ;    /*!< \brief Preconditioned Arnoldi basis of the FGCRODR cycles. */
+  mutable vector<VectorType> RecU;    /*!< \brief Subspace recycled by FGCRODR (preconditioned directions). */
+  mutable vector<VectorType> RecC;    /*!< \brief Orthonormal image of the recycled subspace, C = A*U. */
+  mutable vector<VectorType> RecTmp;  /*!< \brief Work vectors to update the recycled subspace. */
+  mutable unsigned long nRecycled;    /*!< \brief Number of valid vectors in the recycled subspace. */
+
+  mutable unsigned long recSolves[2]; /*!< \brief Number of FGCRODR solves without [0] and with [1] recycled subspace. */
+  mutable unsigned long recIters[2];  /*!< \brief Iterations of the FGCRODR solves without [0] and with [1] recycled subspace. */
+  mutable unsigned long recMatVecs[2];/*!< \brief Matrix-vector products of the FGCRODR solves without [0] and with [1] recycled subspace. */
+  mutable passivedouble recTime[2];   /*!< \brief Wall time of the FGCRODR solves without [0] and with [1] recycled subspace. */
+
+  enum { MAX_PIPE_DOTS = 5 };         /*!< \brief Max. number of dot products fused by the pipelined solvers. */
+  enum { DOT_BLOCK_SIZE = 1024 };     /*!< \brief Number of entries over which all fused dot products are done at once. */
+  mutable vector<ScalarType> dotLocal;  /*!< \brief Rank-local part of the fused dot products (shared by the threads). */
+  mutable vector<ScalarType> dotGlobal; /*!< \brief Result of the reduction of the fused dot products. */
+  mutable SU2_MPI::Request dotRequest;  /*!< \brief Request of the non-blocking reduction. */
+
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType* LinSysSol_ptr;        /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
@@ -162,6 +185,58 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w) const;
 
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with fused dot products and norm.
+   * \note One global reduction per call, a second (re-orthogonalization) pass is only
+   *       performed when the norm of the vector drops by more than 1/sqrt(2).
+   * \param[in] i - index indicating which vector is orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   */
+  void ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg,
+                            vector<VectorType> & w) const;
+
+  /*!
+   * \brief Eigen-decomposition of a small symmetric matrix (cyclic Jacobi method).
+   * \param[in] n - size of the matrix
+   * \param[in,out] A - on entry the matrix, on exit its eigenvalues are on the diagonal
+   * \param[out] V - eigenvectors (columns), V[i][j] is component i of vector j
+   */
+  static void SymmetricEigen(int n, vector<vector<ScalarType> > & A, vector<vector<ScalarType> > & V);
+
+  /*!
+   * \brief Select the new subspace recycled by FGCRODR at the end of a cycle.
+   * \note The Arnoldi relation of the cycle is A*[U Z] = [C V]*G, with G = [I B; 0 H]. The new
+   *       subspace is spanned by the right singular vectors of G associated with the smallest
+   *       singular values, i.e. the directions that A amplifies the least.
+   * \param[in] nRec - number of recycled vectors used in the cycle
+   * \param[in] nSteps - number of Arnoldi steps of the cycle
+   * \param[in] k - maximum dimension of the recycled subspace
+   * \param[in] B - projection of A*Z on C
+   * \param[in] H - (unrotated) upper Hessenberg matrix of the cycle
+   * \return Dimension of the new recycled subspace.
+   */
+  unsigned long UpdateRecycledSubspace(unsigned long nRec, unsigned long nSteps, unsigned long k,
+                                       const vector<vector<ScalarType> > & B,
+                                       const vector<vector<ScalarType> > & H) const;
+
+  /*!
+   * \brief Compute several dot products a[k].b[k] and start their (non-blocking) reduction across ranks.
+   * \note Must be called by all threads, the result is obtained with FinishDotProducts.
+   * \param[in] n - Number of dot products.
+   * \param[in] a - Pointers to the first vector of each product.
+   * \param[in] b - Pointers to the second vector of each product.
+   */
+  void StartDotProducts(unsigned long n, const VectorType* const* a, const VectorType* const* b) const;
+
+  /*!
+   * \brief Wait for the reduction started by StartDotProducts.
+   * \param[in] n - Number of dot products.
+   * \param[out] res - Values of the dot products (thread-local).
+   */
+  void FinishDotProducts(unsigned long n, ScalarType* res) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -244,10 +319,12 @@ public:
    * \param[out] residual - final normalized residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] classical_gs - Use classical (one reduction) instead of modified Gram-Schmidt.
    */
   unsigned long FGMRES_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
                                  const PrecondType & precond, ScalarType tol, unsigned long m,
-                                 ScalarType & residual, bool monitoring, CConfig *config) const;
+                                 ScalarType & residual, bool monitoring, CConfig *config,
+                                 bool classical_gs = false) const;
 
   /*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
@@ -265,6 +342,64 @@ public:
                                   const PrecondType & precond, ScalarType tol, unsigned long m,
                                   ScalarType & residual, bool monitoring, CConfig *config) const;
 
+  /*!
+   * \brief Pipelined Conjugate Gradient method (Ghysels and Vanroose), the three dot products
+   *        of an iteration are reduced at once, overlapped with the preconditioner and product.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedCG_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                      const PrecondType & precond, ScalarType tol, unsigned long m,
+                                      ScalarType & residual, bool monitoring, CConfig *config) const;
+
+  /*!
+   * \brief Pipelined BCGSTAB (Cools and Vanroose) with right preconditioning, two reductions
+   *        per iteration, each overlapped with a preconditioner application and product.
+   * \note The preconditioner must be a linear operator (i.e. not a Krylov method).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedBCGSTAB_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                           const PrecondType & precond, ScalarType tol, unsigned long m,
+                                           ScalarType & residual, bool monitoring, CConfig *config) const;
+
+  /*!
+   * \brief Flexible GCRO-DR, restarted FGMRES that deflates a subspace recycled between calls.
+   * \note The recycled subspace is kept by this object, it is re-orthonormalized at the start
+   *       of each call so that the matrix and preconditioner may change between calls, unless
+   *       the matrix is the same as in the previous call (e.g. lagged Jacobian).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[in] cycle - length of each cycle (recycled plus new vectors)
+   * \param[in] k - maximum dimension of the recycled subspace
+   * \param[in] sameMatrix - the matrix did not change since the last call, C = A*U is still valid
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long FGCRODR_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                  const PrecondType & precond, ScalarType tol, unsigned long m,
+                                  unsigned long cycle, unsigned long k, bool sameMatrix,
+                                  ScalarType & residual, bool monitoring, CConfig *config) const;
+
   /*!
    * \brief Generic smoother (modified Richardson iteration with preconditioner)
    * \param[in] b - the right hand size vector
@@ -309,4 +444,11 @@ public:
    */
   inline ScalarType GetResidual(void) const { return Residual; }
 
+  /*!
+   * \brief Print the average iterations, matrix-vector products, and wall time of the FGCRODR solves
+   *        with and without recycled subspace.
+   * \param[in] name - name of the system.
+   */
+  void WriteRecycleSummary(const string & name) const;
+
 };
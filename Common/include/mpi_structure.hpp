@@ -35,6 +35,7 @@
 
 #include "./datatype_structure.hpp"
 #include <stdlib.h>
+#include <ctime>
 #ifndef _MSC_VER
 #include <unistd.h>
 #else
@@ -102,6 +103,8 @@ protected:
   
   static int Rank, Size, MinRankError;
   static Comm currentComm;
+  static thread_local Comm threadComm;       /*!< \brief Communicator of the calling thread, see SetThreadComm. */
+  static thread_local bool threadCommInUse;  /*!< \brief Whether the calling thread overrides currentComm. */
   static bool winMinRankErrorInUse;
   static Win  winMinRankError;
   
@@ -115,6 +118,17 @@ public:
   
   static void SetComm(Comm NewComm);
 
+  /*!
+   * \brief Override the communicator returned by GetComm for the calling thread only, e.g. for the
+   *        concurrent harmonic balance instances, each communicator must span the ranks of SetComm.
+   */
+  static void SetThreadComm(Comm NewComm);
+
+  /*!
+   * \brief Remove the override of SetThreadComm, the calling thread uses the communicator of SetComm again.
+   */
+  static void ClearThreadComm();
+
   static void Error(std::string ErrorMsg, std::string FunctionName);
 
   static void Init(int *argc, char***argv);
@@ -131,7 +145,29 @@ public:
   
   static void Comm_size(Comm comm, int* size);
   
+  static void Comm_dup(Comm comm, Comm* newcomm);
+
+  static void Comm_split(Comm comm, int color, int key, Comm* newcomm);
+  
+  static void Comm_split_type(Comm comm, int split_type, int key, Comm* newcomm);
+
+  static void Comm_free(Comm* comm);
+  
+  static void Win_allocate_shared(size_t size, int disp_unit, Comm comm, void* baseptr, Win* win);
+
+  static void Win_shared_query(Win win, int rank, void* baseptr);
+
+  static void Win_lock_all(int assert, Win win);
+
+  static void Win_unlock_all(Win win);
+
+  static void Win_sync(Win win);
+
+  static void Win_free(Win* win);
+
   static void Barrier(Comm comm);
+
+  static double Wtime();
   
   static void Abort(Comm comm, int error);
 
@@ -143,6 +179,16 @@ public:
   static void Irecv(void *buf, int count, Datatype datatype, int source,
                     int tag, Comm comm, Request* request);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Startall(int count, Request* array_of_requests);
+
+  static void Request_free(Request* request);
+
   static void Wait(Request *request, Status *status);
 
   static void Waitall(int nrequests, Request *request, Status *status);
@@ -172,6 +218,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -337,6 +386,7 @@ public:
   typedef int Datatype;
   typedef int Request;
   typedef int Op;
+  typedef int Win;
   
   struct Status {
     int MPI_TAG;
@@ -347,6 +397,8 @@ public:
 private:
   static int Rank, Size;
   static Comm currentComm;
+  static thread_local Comm threadComm;
+  static thread_local bool threadCommInUse;
 
 public:
   static int GetRank();
@@ -356,6 +408,10 @@ public:
   static Comm GetComm();
   
   static void SetComm(Comm NewComm);
+
+  static void SetThreadComm(Comm NewComm);
+
+  static void ClearThreadComm();
   
   static void Error(std::string ErrorMsg, std::string FunctionName);
     
@@ -373,7 +429,15 @@ public:
   
   static void Comm_size(Comm comm, int* size);
   
+  static void Comm_dup(Comm comm, Comm* newcomm);
+
+  static void Comm_split(Comm comm, int color, int key, Comm* newcomm);
+  
+  static void Comm_free(Comm* comm);
+  
   static void Barrier(Comm comm);
+
+  static double Wtime();
   
   static void Abort(Comm comm, int error);
   
@@ -385,6 +449,16 @@ public:
   static void Irecv(void *buf, int count, Datatype datatype, int source,
                     int tag, Comm comm, Request* request);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Startall(int count, Request* array_of_requests);
+
+  static void Request_free(Request* request);
+
   static void Wait(Request *request, Status *status);
 
   static void Waitall(int nrequests, Request *request, Status *status);
@@ -412,6 +486,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -116,8 +116,17 @@ inline void CBaseMPIWrapper::SetComm(Comm newComm){
   winMinRankErrorInUse = true;
 }
 
+inline void CBaseMPIWrapper::SetThreadComm(Comm newComm){
+  threadComm = newComm;
+  threadCommInUse = true;
+}
+
+inline void CBaseMPIWrapper::ClearThreadComm(){
+  threadCommInUse = false;
+}
+
 inline CBaseMPIWrapper::Comm CBaseMPIWrapper::GetComm(){
-  return currentComm;
+  return threadCommInUse? threadComm : currentComm;
 }
 
 inline void CBaseMPIWrapper::Init(int *argc, char ***argv) {
@@ -158,6 +167,48 @@ inline void CBaseMPIWrapper::Comm_size(Comm comm, int *size){
   MPI_Comm_size(comm, size);
 }
 
+inline void CBaseMPIWrapper::Comm_dup(Comm comm, Comm* newcomm){
+  MPI_Comm_dup(comm, newcomm);
+}
+
+inline void CBaseMPIWrapper::Comm_split(Comm comm, int color, int key, Comm* newcomm){
+  MPI_Comm_split(comm, color, key, newcomm);
+}
+
+inline void CBaseMPIWrapper::Comm_split_type(Comm comm, int split_type, int key, Comm* newcomm){
+  MPI_Comm_split_type(comm, split_type, key, MPI_INFO_NULL, newcomm);
+}
+
+inline void CBaseMPIWrapper::Comm_free(Comm* comm){
+  MPI_Comm_free(comm);
+}
+
+inline void CBaseMPIWrapper::Win_allocate_shared(size_t size, int disp_unit, Comm comm, void* baseptr, Win* win){
+  MPI_Win_allocate_shared(size, disp_unit, MPI_INFO_NULL, comm, baseptr, win);
+}
+
+inline void CBaseMPIWrapper::Win_shared_query(Win win, int rank, void* baseptr){
+  MPI_Aint size;
+  int disp_unit;
+  MPI_Win_shared_query(win, rank, &size, &disp_unit, baseptr);
+}
+
+inline void CBaseMPIWrapper::Win_lock_all(int assert, Win win){
+  MPI_Win_lock_all(assert, win);
+}
+
+inline void CBaseMPIWrapper::Win_unlock_all(Win win){
+  MPI_Win_unlock_all(win);
+}
+
+inline void CBaseMPIWrapper::Win_sync(Win win){
+  MPI_Win_sync(win);
+}
+
+inline void CBaseMPIWrapper::Win_free(Win* win){
+  MPI_Win_free(win);
+}
+
 inline void CBaseMPIWrapper::Finalize(){
   if( winMinRankErrorInUse ) MPI_Win_free(&winMinRankError);
   MPI_Finalize();
@@ -167,6 +218,10 @@ inline void CBaseMPIWrapper::Barrier(Comm comm) {
   MPI_Barrier(comm);
 }
 
+inline double CBaseMPIWrapper::Wtime() {
+  return MPI_Wtime();
+}
+
 inline void CBaseMPIWrapper::Abort(Comm comm, int error) {
   MPI_Abort(comm, error);
 }
@@ -185,6 +240,24 @@ inline void CBaseMPIWrapper::Irecv(void *buf, int count, Datatype datatype,
   MPI_Irecv(buf,count,datatype,dest,tag,comm, request);
 }
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype,
+                                       int dest, int tag, Comm comm, Request *request) {
+  MPI_Send_init(buf,count,datatype,dest,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype,
+                                       int source, int tag, Comm comm, Request *request) {
+  MPI_Recv_init(buf,count,datatype,source,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Startall(int count, Request *array_of_requests) {
+  MPI_Startall(count,array_of_requests);
+}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {
+  MPI_Request_free(request);
+}
+
 inline void CBaseMPIWrapper::Wait(Request *request, Status *status) {
   MPI_Wait(request,status);
 }
@@ -231,6 +304,11 @@ inline void CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
 }
 
+inline void CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                    Datatype datatype, Op op, Comm comm, Request* request) {
+  MPI_Iallreduce(sendbuf,recvbuf,count,datatype,op,comm,request);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                                 void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm) {
   MPI_Gather(sendbuf,sendcnt,sendtype,recvbuf,recvcnt,recvtype,root,comm);
@@ -534,8 +612,17 @@ inline void CBaseMPIWrapper::SetComm(Comm newComm){
   currentComm = newComm;
 }
 
+inline void CBaseMPIWrapper::SetThreadComm(Comm newComm){
+  threadComm = newComm;
+  threadCommInUse = true;
+}
+
+inline void CBaseMPIWrapper::ClearThreadComm(){
+  threadCommInUse = false;
+}
+
 inline CBaseMPIWrapper::Comm CBaseMPIWrapper::GetComm(){
-  return currentComm;
+  return threadCommInUse? threadComm : currentComm;
 }
 
 inline void CBaseMPIWrapper::Init(int *argc, char ***argv) {}
@@ -548,12 +635,24 @@ inline void CBaseMPIWrapper::Buffer_detach(void *buffer, int *size) {}
 
 inline void CBaseMPIWrapper::Barrier(Comm comm) {}
 
+inline double CBaseMPIWrapper::Wtime() {return double(clock())/double(CLOCKS_PER_SEC);}
+
 inline void CBaseMPIWrapper::Abort(Comm comm, int error) {exit(EXIT_FAILURE);}
 
 inline void CBaseMPIWrapper::Comm_rank(Comm comm, int *rank) {*rank = 0;}
 
 inline void CBaseMPIWrapper::Comm_size(Comm comm, int *size) {*size = 1;}
 
+inline void CBaseMPIWrapper::Comm_dup(Comm comm, Comm* newcomm) {
+  /*--- Distinct values, so that the duplicates can still be told apart. ---*/
+  static Comm lastComm = 0;
+  *newcomm = ++lastComm;
+}
+
+inline void CBaseMPIWrapper::Comm_split(Comm comm, int color, int key, Comm* newcomm) {*newcomm = comm;}
+
+inline void CBaseMPIWrapper::Comm_free(Comm* comm) {}
+
 inline void CBaseMPIWrapper::Finalize(){}
 
 inline void CBaseMPIWrapper::Isend(void *buf, int count, Datatype datatype, int dest,
@@ -562,6 +661,16 @@ inline void CBaseMPIWrapper::Isend(void *buf, int count, Datatype datatype, int
 inline void CBaseMPIWrapper::Irecv(void *buf, int count, Datatype datatype, int source,
                                int tag, Comm comm, Request* request) {}
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype, int dest,
+                                       int tag, Comm comm, Request* request) {}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype, int source,
+                                       int tag, Comm comm, Request* request) {}
+
+inline void CBaseMPIWrapper::Startall(int count, Request* array_of_requests) {}
+
+inline void CBaseMPIWrapper::Request_free(Request* request) {}
+
 inline void CBaseMPIWrapper::Wait(Request *request, Status *status) {}
 
 inline void CBaseMPIWrapper::Waitall(int nrequests, Request *request, Status *status) {}
@@ -591,6 +700,11 @@ inline void  CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
    CopyData(sendbuf, recvbuf, count, datatype);
 }
 
+inline void  CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                     Datatype datatype, Op op, Comm comm, Request* request){
+   CopyData(sendbuf, recvbuf, count, datatype);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                    void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm){
   CopyData(sendbuf, recvbuf, sendcnt, sendtype);
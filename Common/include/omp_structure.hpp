@@ -81,7 +81,13 @@ inline constexpr int omp_get_thread_num(void) {return 0;}
 #endif
 
 /*--- Convenience macros (do not use excessive nesting of macros). ---*/
+#if !defined(HAVE_OMP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+/*--- The simd directive does not need the OpenMP runtime, compilers honor
+ *    it with -fopenmp-simd, which the build system adds when supported. ---*/
+#define SU2_OMP_SIMD PRAGMIZE(omp simd)
+#else
 #define SU2_OMP_SIMD SU2_OMP(simd)
+#endif
 
 #define SU2_OMP_MASTER SU2_OMP(master)
 #define SU2_OMP_BARRIER SU2_OMP(barrier)
@@ -96,6 +102,12 @@ inline constexpr int omp_get_thread_num(void) {return 0;}
 
 /*--- Convenience functions (e.g. to compute chunk sizes). ---*/
 
+/*!
+ * \brief Maximum chunk size of the parallel loops over points, classes with
+ *        lighter or heavier loops define their own (e.g. CSysVector).
+ */
+enum : size_t {OMP_MAX_SIZE = 512};
+
 /*!
  * \brief Integer division rounding up.
  */
@@ -1561,7 +1561,8 @@ enum ENUM_OUTPUT {
   STL_BINARY              = 16, /*!< \brief STL binary format for surface solution output. Not implemented yet. */
   PARAVIEW_XML            = 17, /*!< \brief Paraview XML with binary data format */
   SURFACE_PARAVIEW_XML    = 18, /*!< \brief Surface Paraview XML with binary data format */
-  PARAVIEW_MULTIBLOCK     = 19  /*!< \brief Paraview XML Multiblock */
+  PARAVIEW_MULTIBLOCK     = 19, /*!< \brief Paraview XML Multiblock */
+  PARAVIEW_PVTU           = 20  /*!< \brief Paraview XML with one unsorted piece per rank and a pvtu index */
 };
 static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("TECPLOT_ASCII", TECPLOT)
@@ -1577,6 +1578,7 @@ static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("PARAVIEW", PARAVIEW_XML)
   MakePair("SURFACE_PARAVIEW", SURFACE_PARAVIEW_XML)
   MakePair("PARAVIEW_MULTIBLOCK", PARAVIEW_MULTIBLOCK)
+  MakePair("PARAVIEW_PVTU", PARAVIEW_PVTU)
   MakePair("RESTART_ASCII", RESTART_ASCII)
   MakePair("RESTART", RESTART_BINARY)
   MakePair("CGNS", CGNS)
@@ -1762,6 +1764,10 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER = 8,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT = 9,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU = 10,           /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_CG = 11,        /*!< \brief Pipelined conjugate gradient, one non-blocking reduction per iteration. */
+  PIPELINED_BCGSTAB = 12,   /*!< \brief Pipelined BCGSTAB, two non-blocking reductions per iteration. */
+  FGMRES_CGS = 13,          /*!< \brief FGMRES with classical Gram-Schmidt, one fused reduction per iteration. */
+  FGCRODR = 14,             /*!< \brief Flexible GCRO-DR, restarted FGMRES that recycles a subspace between solves. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1774,6 +1780,10 @@ static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
+  MakePair("PIPELINED_CG", PIPELINED_CG)
+  MakePair("PIPELINED_BCGSTAB", PIPELINED_BCGSTAB)
+  MakePair("FGMRES_CGS", FGMRES_CGS)
+  MakePair("FGCRODR", FGCRODR)
 };
 
 /*!
@@ -2075,6 +2085,18 @@ static const MapType<string, COMM_LEVEL> Comm_Map = {
   MakePair("FULL",    COMM_FULL)
 };
 
+/*!
+ * \brief Vertex weights of the graph partitioning (FVM)
+ */
+enum ENUM_PARTITION_WEIGHTS {
+  NO_PARTITION_WEIGHTS   = 0,   /*!< \brief Uniform weights, i.e. balance the number of points. */
+  COST_MODEL_WEIGHTS     = 1    /*!< \brief Weights from a cost model (edges, boundary conditions, wall functions). */
+};
+static const MapType<string, ENUM_PARTITION_WEIGHTS> Partition_Weights_Map = {
+  MakePair("NONE",       NO_PARTITION_WEIGHTS)
+  MakePair("COST_MODEL", COST_MODEL_WEIGHTS)
+};
+
 /*
  * \brief Types of filter kernels, initially intended for structural topology optimization applications
  */
@@ -0,0 +1,160 @@
+/*!
+ * \file CReductionAccumulator.hpp
+ * \brief Batches many small global reductions into one per type of operation.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+#include <vector>
+
+/*!
+ * \class CReductionAccumulator
+ * \brief Gathers the addresses of scalars and arrays that need to be reduced across ranks,
+ *        and reduces them in place with one Allreduce per type of operation.
+ *
+ * The usage case is:
+ *   1 - Compute the rank-local values as usual.
+ *   2 - Register them via Add (the values must stay alive until the reduction completes).
+ *   3 - Call Reduce, or StartReduction and CompleteReduction to overlap the
+ *       communication with other work (the values must not be used in between).
+ *   4 - The registered variables now hold the global values, quantities derived from
+ *       them (e.g. ratios) must be computed after the reduction.
+ *
+ * \note The non-blocking reduction is not supported by the AD MPI wrapper, in those
+ *       builds StartReduction performs a blocking reduction.
+ */
+class CReductionAccumulator {
+public:
+  enum OPERATION {SUM = 0, MIN = 1, MAX = 2};
+
+private:
+  enum : int {NUM_OPERATIONS = 3};
+
+  struct CEntry {
+    su2double* values;
+    unsigned long size;
+  };
+
+  std::vector<CEntry> entries[NUM_OPERATIONS];      /*!< \brief Registered variables for each operation. */
+  std::vector<su2double> sendBuf[NUM_OPERATIONS];   /*!< \brief Packed local values. */
+  std::vector<su2double> recvBuf[NUM_OPERATIONS];   /*!< \brief Packed global values. */
+  SU2_MPI::Request request[NUM_OPERATIONS];         /*!< \brief Requests of the non-blocking reductions. */
+  bool pending = false;                             /*!< \brief Whether a reduction was started and not completed. */
+  SU2_MPI::Comm comm;                               /*!< \brief Communicator used for the reductions. */
+
+  static SU2_MPI::Op MPIOperation(int op) {
+    switch (op) {
+      case MIN: return MPI_MIN;
+      case MAX: return MPI_MAX;
+      default:  return MPI_SUM;
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor.
+   * \param[in] communicator - Communicator over which values are reduced.
+   */
+  CReductionAccumulator(SU2_MPI::Comm communicator = SU2_MPI::GetComm()) : comm(communicator) {}
+
+  /*!
+   * \brief Forget all registered variables (buffers are kept for reuse).
+   */
+  void Clear() {
+    for (int op = 0; op < NUM_OPERATIONS; ++op) entries[op].clear();
+  }
+
+  /*!
+   * \brief Register a scalar.
+   * \param[in,out] value - Local value on input, global value after the reduction.
+   * \param[in] op - Type of reduction.
+   */
+  void Add(su2double& value, OPERATION op = SUM) { Add(&value, 1, op); }
+
+  /*!
+   * \brief Register an array.
+   * \param[in,out] values - Local values on input, global values after the reduction.
+   * \param[in] size - Number of entries.
+   * \param[in] op - Type of reduction.
+   */
+  void Add(su2double* values, unsigned long size, OPERATION op = SUM) {
+    if (size > 0) entries[op].push_back({values, size});
+  }
+
+  /*!
+   * \brief Pack the local values and start one reduction per type of operation.
+   */
+  void StartReduction() {
+#ifdef HAVE_MPI
+    for (int op = 0; op < NUM_OPERATIONS; ++op) {
+      if (entries[op].empty()) continue;
+
+      auto& send = sendBuf[op];
+      send.clear();
+      for (const auto& entry : entries[op])
+        send.insert(send.end(), entry.values, entry.values+entry.size);
+      recvBuf[op].resize(send.size());
+
+#if !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+      SU2_MPI::Iallreduce(send.data(), recvBuf[op].data(), send.size(), MPI_DOUBLE,
+                          MPIOperation(op), comm, &request[op]);
+#else
+      SU2_MPI::Allreduce(send.data(), recvBuf[op].data(), send.size(), MPI_DOUBLE,
+                         MPIOperation(op), comm);
+#endif
+    }
+    pending = true;
+#endif
+  }
+
+  /*!
+   * \brief Wait for the reductions and copy the global values back to the registered variables.
+   */
+  void CompleteReduction() {
+    if (!pending) return;
+    pending = false;
+
+    for (int op = 0; op < NUM_OPERATIONS; ++op) {
+      if (entries[op].empty()) continue;
+
+#if !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+      SU2_MPI::Wait(&request[op], MPI_STATUS_IGNORE);
+#endif
+      const su2double* global = recvBuf[op].data();
+      for (const auto& entry : entries[op]) {
+        for (auto i = 0ul; i < entry.size; ++i) entry.values[i] = global[i];
+        global += entry.size;
+      }
+    }
+  }
+
+  /*!
+   * \brief Blocking reduction of all registered variables.
+   */
+  void Reduce() {
+    StartReduction();
+    CompleteReduction();
+  }
+};
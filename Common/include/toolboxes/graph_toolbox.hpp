@@ -117,6 +117,13 @@ public:
     return m_outerPtr.empty() || m_innerIdx.empty();
   }
 
+  /*!
+   * \return Memory used by the index arrays of the pattern, in bytes.
+   */
+  inline size_t getMemorySize() const {
+    return (m_outerPtr.size() + m_innerIdx.size() + m_diagPtr.size()) * sizeof(Index_t);
+  }
+
   /*!
    * \return Number of rows/columns.
    */
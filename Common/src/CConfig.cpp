@@ -763,6 +763,8 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
 
 void CConfig::SetPointersNull(void) {
 
+  Instance_Copy = false;
+
   Marker_CfgFile_GeoEval      = NULL;   Marker_All_GeoEval       = NULL;
   Marker_CfgFile_Monitoring   = NULL;   Marker_All_Monitoring    = NULL;
   Marker_CfgFile_Designing    = NULL;   Marker_All_Designing     = NULL;
@@ -899,6 +901,8 @@ void CConfig::SetPointersNull(void) {
 
   RefOriginMoment     = NULL;
   CFL_AdaptParam      = NULL;
+  CFL_AdaptFeedbackParam = NULL;
+  Jacobian_LagParam   = NULL;
   CFL                 = NULL;
   HTP_Axis = NULL;
   PlaneTag            = NULL;
@@ -917,6 +921,8 @@ void CConfig::SetPointersNull(void) {
   TimeIntegrationADER_DG    = NULL;
   WeightsIntegrationADER_DG = NULL;
   RK_Alpha_Step             = NULL;
+  Probe_Coords              = NULL;
+  Slice_Planes              = NULL;
   MG_CorrecSmooth           = NULL;
   MG_PreSmooth              = NULL;
   MG_PostSmooth             = NULL;
@@ -969,6 +975,8 @@ void CConfig::SetPointersNull(void) {
   default_eng_cyl            = NULL;
   default_eng_val            = NULL;
   default_cfl_adapt          = NULL;
+  default_cfl_feedback       = NULL;
+  default_jacobian_lag       = NULL;
   default_jst_coeff          = NULL;
   default_ffd_coeff          = NULL;
   default_mixedout_coeff     = NULL;
@@ -985,6 +993,7 @@ void CConfig::SetPointersNull(void) {
   default_inc_crit           = NULL;
   default_htp_axis           = NULL;
   default_body_force         = NULL;
+  default_fluid_table_range  = NULL;
   default_sineload_coeff     = NULL;
   default_nacelle_location   = NULL;
   default_wrt_freq           = NULL;
@@ -1086,6 +1095,8 @@ void CConfig::SetConfig_Options() {
   default_eng_cyl            = new su2double[7];
   default_eng_val            = new su2double[5];
   default_cfl_adapt          = new su2double[4];
+  default_cfl_feedback       = new su2double[2];
+  default_jacobian_lag       = new su2double[2];
   default_jst_coeff          = new su2double[2];
   default_ffd_coeff          = new su2double[3];
   default_mixedout_coeff     = new su2double[3];
@@ -1102,6 +1113,7 @@ void CConfig::SetConfig_Options() {
   default_inc_crit           = new su2double[3];
   default_htp_axis           = new su2double[2];
   default_body_force         = new su2double[3];
+  default_fluid_table_range  = new su2double[2];
   default_sineload_coeff     = new su2double[3];
   default_nacelle_location   = new su2double[5];
   default_wrt_freq           = new su2double[3];
@@ -1214,6 +1226,20 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the tabulated fluid model ---*/
+
+  /* DESCRIPTION: Tabulate the fluid model with bicubic interpolation, used for the h-s and P-s states */
+  addBoolOption("FLUID_TABLE", FluidTable, false);
+  /* DESCRIPTION: Number of points of the table in density (logarithmic spacing) and internal energy */
+  addUnsignedShortOption("FLUID_TABLE_NPOINTS_DENSITY", FluidTable_nDensity, 200);
+  addUnsignedShortOption("FLUID_TABLE_NPOINTS_ENERGY", FluidTable_nEnergy, 200);
+  /* DESCRIPTION: Density and temperature ranges of the table, (0,0) covers a range around the free-stream */
+  default_fluid_table_range[0] = 0.0; default_fluid_table_range[1] = 0.0;
+  addDoubleArrayOption("FLUID_TABLE_DENSITY_RANGE", 2, FluidTable_DensityRange, default_fluid_table_range);
+  addDoubleArrayOption("FLUID_TABLE_TEMPERATURE_RANGE", 2, FluidTable_TemperatureRange, default_fluid_table_range);
+  /* DESCRIPTION: File that stores the table, it is reused if it matches the fluid model and the ranges */
+  addStringOption("FLUID_TABLE_FILENAME", FluidTable_FileName, string("fluid_table.dat"));
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -1641,6 +1667,14 @@ void CConfig::SetConfig_Options() {
    * and decrease when the residual is increasing or stalled. \ingroup Config*/
   default_cfl_adapt[0] = 0.0; default_cfl_adapt[1] = 0.0; default_cfl_adapt[2] = 1.0; default_cfl_adapt[3] = 100.0;
   addDoubleArrayOption("CFL_ADAPT_PARAM", 4, CFL_AdaptParam, default_cfl_adapt);
+  /* DESCRIPTION: Adapt the CFL number from the convergence of the linear solvers and the trend of the nonlinear residual. */
+  addBoolOption("CFL_ADAPT_FEEDBACK", CFL_Adapt_Feedback, false);
+  /* !\brief CFL_ADAPT_FEEDBACK_PARAM
+   * DESCRIPTION: Parameters of the CFL feedback controller (divergence ratio, checkpoint frequency). The solution
+   * is saved every "checkpoint frequency" iterations if the residual decreased, and restored (with a reduced CFL)
+   * when the residual grows by more than "divergence ratio" with respect to the saved one. \ingroup Config*/
+  default_cfl_feedback[0] = 100.0; default_cfl_feedback[1] = 10.0;
+  addDoubleArrayOption("CFL_ADAPT_FEEDBACK_PARAM", 2, CFL_AdaptFeedbackParam, default_cfl_feedback);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the adjoint problem */
   addDoubleOption("CFL_REDUCTION_ADJFLOW", CFLRedCoeff_AdjFlow, 0.8);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the level set problem */
@@ -1664,6 +1698,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("HB_PERIOD", HarmonicBalance_Period, -1.0);
   /* DESCRIPTION:  Turn on/off harmonic balance preconditioning */
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
+  /* DESCRIPTION: Iterate the harmonic balance time instances concurrently, one thread and communicator each */
+  addBoolOption("HB_CONCURRENT_INSTANCES", HB_Concurrent_Instances, false);
   /* DESCRIPTION: Iteration number to begin unsteady restarts (dual time method) */
   addLongOption("UNST_RESTART_ITER", Unst_RestartIter, 0);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
@@ -1708,6 +1744,16 @@ void CConfig::SetConfig_Options() {
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Number of vectors of the subspace that FGCRODR recycles between linear solves */
+  addUnsignedLongOption("LINEAR_SOLVER_RECYCLE_DIM", Linear_Solver_Recycle_Dim, 5);
+  /* DESCRIPTION: Max number of iterations that reuse the Jacobian and preconditioner of a previous iteration (0 disables lagging) */
+  addUnsignedLongOption("JACOBIAN_LAG_ITER", Jacobian_Lag_Iter, 0);
+  /* !\brief JACOBIAN_LAG_PARAM
+   * DESCRIPTION: Criteria that refresh a lagged Jacobian (linear solver growth factor, nonlinear residual ratio).
+   * The Jacobian is assembled again when the linear iterations (or residual, if not converged) exceed "growth factor"
+   * times those of the first solve with it, or when the residual grows by more than "residual ratio". \ingroup Config*/
+  default_jacobian_lag[0] = 2.0; default_jacobian_lag[1] = 1.0;
+  addDoubleArrayOption("JACOBIAN_LAG_PARAM", 2, Jacobian_LagParam, default_jacobian_lag);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
@@ -1802,6 +1848,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief NUM_METHOD_GRAD
    *  \n DESCRIPTION: Numerical method for spatial gradients used only for upwind reconstruction \n OPTIONS: See \link Gradient_Map \endlink. \n DEFAULT: NO_GRADIENT. \ingroup Config*/
   addEnumOption("NUM_METHOD_GRAD_RECON", Kind_Gradient_Method_Recon, Gradient_Map, NO_GRADIENT);
+  /*!\brief LEAST_SQUARES_PRECOMPUTED
+   *  \n DESCRIPTION: Precompute the geometric weights of least-squares gradients (recomputed only when the grid moves). \n DEFAULT: NO. \ingroup Config*/
+  addBoolOption("LEAST_SQUARES_PRECOMPUTED", LeastSquaresPrecomputed, false);
   /*!\brief VENKAT_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("VENKAT_LIMITER_COEFF", Venkat_LimiterCoeff, 0.05);
@@ -1811,6 +1860,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief LIMITER_ITER
    *  \n DESCRIPTION: Freeze the value of the limiter after a number of iterations. DEFAULT value 999999. \ingroup Config*/
   addUnsignedLongOption("LIMITER_ITER", LimiterIter, 999999);
+  /*!\brief LIMITER_FREEZE_ITER
+   *  \n DESCRIPTION: Keep the limiters of this iteration for the remaining ones (they are not recomputed). DEFAULT value 999999. \ingroup Config*/
+  addUnsignedLongOption("LIMITER_FREEZE_ITER", LimiterFreezeIter, 999999);
 
   /*!\brief CONV_NUM_METHOD_FLOW
    *  \n DESCRIPTION: Convective numerical method \n OPTIONS: See \link Upwind_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
@@ -1951,6 +2003,11 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Automatically reorient elements that seem flipped */
   addBoolOption("REORIENT_ELEMENTS",ReorientElements, true);
 
+  /*!\brief GEOMETRY_CACHE \n DESCRIPTION: Store the partitioning, multigrid agglomeration and wall distance, and reuse them in later runs with the same mesh and settings. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("GEOMETRY_CACHE", Geometry_Cache, false);
+  /*!\brief GEOMETRY_CACHE_FILENAME \n DESCRIPTION: Root name of the preprocessed geometry cache files, the zone and rank are appended. \n DEFAULT: geometry_cache \ingroup Config*/
+  addStringOption("GEOMETRY_CACHE_FILENAME", Geometry_Cache_FileName, string("geometry_cache"));
+
   /*!\par CONFIG_CATEGORY: Input/output files and formats \ingroup Config */
   /*--- Options related to input/output files and formats ---*/
 
@@ -2689,6 +2746,14 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Activate ParMETIS mode for testing */
   addBoolOption("PARMETIS", ParMETIS, false);
 
+  /* DESCRIPTION: Exchange the halos of the neighbors on the same node through MPI shared memory windows */
+  addBoolOption("HALO_SHARED_MEMORY", Halo_Shared_Memory, false);
+
+  /* DESCRIPTION: Vertex weights of the graph partitioning (NONE, COST_MODEL) */
+  addEnumOption("PARTITION_WEIGHTS", Kind_Partition_Weights, Partition_Weights_Map, NO_PARTITION_WEIGHTS);
+  /* DESCRIPTION: Measure the work of each rank and report the load imbalance at the end of the run */
+  addBoolOption("WRT_LOAD_IMBALANCE", Wrt_Load_Imbalance, false);
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -2774,6 +2839,19 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
 
+  /*!\brief PROBE_COORDS
+   * \n DESCRIPTION: Coordinates (x, y, z) of the flow probes, the values at these points are added to the history output (z is ignored in 2D). \ingroup Config*/
+  addDoubleListOption("PROBE_COORDS", nProbe_Coords, Probe_Coords);
+  /*!\brief PROBE_WRT_FREQ
+   * \n DESCRIPTION: Iteration frequency at which the probes are interpolated. \ingroup Config*/
+  addUnsignedLongOption("PROBE_WRT_FREQ", ProbeWrtFreq, 1);
+  /*!\brief SLICE_PLANES
+   * \n DESCRIPTION: Origin (x, y, z) and normal (nx, ny, nz) of each cut plane of the volume solution. \ingroup Config*/
+  addDoubleListOption("SLICE_PLANES", nSlice_Planes, Slice_Planes);
+  /*!\brief SLICE_WRT_FREQ
+   * \n DESCRIPTION: Iteration frequency at which the slices are written. \ingroup Config*/
+  addUnsignedLongOption("SLICE_WRT_FREQ", SliceWrtFreq, 250);
+
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
 
@@ -3155,6 +3233,17 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     VolumeOutputFiles[2] = SURFACE_PARAVIEW_BINARY;
   }
 
+  /*--- Probes are given by 3 coordinates and slices by an origin and a normal. ---*/
+  if (nProbe_Coords % 3 != 0) {
+    SU2_MPI::Error("PROBE_COORDS must contain 3 coordinates (x, y, z) per probe.", CURRENT_FUNCTION);
+  }
+  if (nSlice_Planes % 6 != 0) {
+    SU2_MPI::Error("SLICE_PLANES must contain an origin (x, y, z) and a normal (nx, ny, nz) per plane.", CURRENT_FUNCTION);
+  }
+  if ((ProbeWrtFreq == 0) || (SliceWrtFreq == 0)) {
+    SU2_MPI::Error("PROBE_WRT_FREQ and SLICE_WRT_FREQ must be greater than zero.", CURRENT_FUNCTION);
+  }
+
   /*--- Check if SU2 was build with TecIO support, as that is required for Tecplot Binary output. ---*/
 #ifndef HAVE_TECIO
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++){
@@ -3423,6 +3512,25 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     Kind_Regime = NO_FLOW;
   }
 
+  /*--- The recycled subspace takes part of each FGCRODR cycle (of LINEAR_SOLVER_RESTART_FREQUENCY iterations). ---*/
+
+  if ((Kind_Linear_Solver == FGCRODR) || (Kind_DiscAdj_Linear_Solver == FGCRODR) ||
+      (Kind_Deform_Linear_Solver == FGCRODR)) {
+    if (Linear_Solver_Recycle_Dim < 1)
+      SU2_MPI::Error("LINEAR_SOLVER_RECYCLE_DIM must be at least 1 for FGCRODR.", CURRENT_FUNCTION);
+    if (Linear_Solver_Recycle_Dim >= Linear_Solver_Restart_Frequency)
+      SU2_MPI::Error("LINEAR_SOLVER_RECYCLE_DIM must be smaller than LINEAR_SOLVER_RESTART_FREQUENCY for FGCRODR.", CURRENT_FUNCTION);
+  }
+
+  /*--- Lagging the Jacobian relies on the pseudo-time iterations of steady problems. ---*/
+
+  if (Jacobian_Lag_Iter > 0) {
+    if (TimeMarching != STEADY)
+      SU2_MPI::Error("JACOBIAN_LAG_ITER is only available for steady problems.", CURRENT_FUNCTION);
+    if ((Jacobian_LagParam[0] < 1.0) || (Jacobian_LagParam[1] <= 0.0))
+      SU2_MPI::Error("JACOBIAN_LAG_PARAM requires a growth factor >= 1 and a positive residual ratio.", CURRENT_FUNCTION);
+  }
+
   if ((rank == MASTER_NODE) && ContinuousAdjoint && (Ref_NonDim == DIMENSIONAL) && (Kind_SU2 == SU2_CFD)) {
     cout << "WARNING: The adjoint solver should use a non-dimensional flow solution." << endl;
   }
@@ -4898,6 +5006,14 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                    CURRENT_FUNCTION);
   }
 
+  if (CFL_Adapt_Feedback && !CFL_Adapt) {
+    SU2_MPI::Error("CFL_ADAPT_FEEDBACK requires CFL_ADAPT= YES.", CURRENT_FUNCTION);
+  }
+
+  if (CFL_Adapt_Feedback && ((CFL_AdaptFeedbackParam[0] <= 1.0) || (CFL_AdaptFeedbackParam[1] < 1.0))) {
+    SU2_MPI::Error("CFL_ADAPT_FEEDBACK_PARAM requires a divergence ratio > 1 and a checkpoint frequency >= 1.", CURRENT_FUNCTION);
+  }
+
 }
 
 void CConfig::SetMarkers(unsigned short val_software) {
@@ -4919,7 +5035,7 @@ void CConfig::SetMarkers(unsigned short val_software) {
 
 #ifdef HAVE_MPI
   if (val_software != SU2_MSH)
-    SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+    SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
 #endif
 
   /*--- Compute the total number of markers in the config file ---*/
@@ -6389,8 +6505,17 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_BCGSTAB:
+            case FGMRES_CGS:
+            case FGCRODR:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_BCGSTAB)
+                cout << "Pipelined BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == FGMRES_CGS)
+                cout << "FGMRES (classical Gram-Schmidt) is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == FGCRODR)
+                cout << "FGCRODR (recycling " << Linear_Solver_Recycle_Dim << " vectors) is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -6399,6 +6524,9 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
               }
+              if (Jacobian_Lag_Iter > 0)
+                cout << "Jacobian and preconditioner lagged for up to " << Jacobian_Lag_Iter << " iterations. Growth factor: "
+                     << Jacobian_LagParam[0] << ", residual ratio: " << Jacobian_LagParam[1] << "." << endl;
               break;
             case SMOOTHER:
               switch (Kind_Linear_Solver_Prec) {
@@ -6542,6 +6670,10 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
       else cout << "CFL adaptation. Factor down: "<< CFL_AdaptParam[0] <<", factor up: "<< CFL_AdaptParam[1]
         <<",\n                lower limit: "<< CFL_AdaptParam[2] <<", upper limit: " << CFL_AdaptParam[3] <<"."<< endl;
 
+      if (CFL_Adapt && CFL_Adapt_Feedback)
+        cout << "CFL driven by the linear solver and nonlinear residual feedback. Divergence ratio: "
+             << CFL_AdaptFeedbackParam[0] << ", checkpoint every " << CFL_AdaptFeedbackParam[1] << " iterations." << endl;
+
       if (nMGLevels !=0) {
         PrintingToolbox::CTablePrinter MGTable(&std::cout);
 
@@ -7355,10 +7487,120 @@ void CConfig::SetSurface_Movement(unsigned short iMarker, unsigned short kind_mo
   nKind_SurfaceMovement++;
 
 }
+template<class F>
+void CConfig::ForEachRuntimeArray(F func) {
+
+  func(Surface_MassFlow, nMarker_Analyze);
+  func(Surface_Mach, nMarker_Analyze);
+  func(Surface_Temperature, nMarker_Analyze);
+  func(Surface_Pressure, nMarker_Analyze);
+  func(Surface_Density, nMarker_Analyze);
+  func(Surface_Enthalpy, nMarker_Analyze);
+  func(Surface_NormalVelocity, nMarker_Analyze);
+  func(Surface_Uniformity, nMarker_Analyze);
+  func(Surface_SecondaryStrength, nMarker_Analyze);
+  func(Surface_SecondOverUniform, nMarker_Analyze);
+  func(Surface_MomentumDistortion, nMarker_Analyze);
+  func(Surface_TotalTemperature, nMarker_Analyze);
+  func(Surface_TotalPressure, nMarker_Analyze);
+  func(Surface_PressureDrop, nMarker_Analyze);
+  func(Surface_DC60, nMarker_Analyze);
+  func(Surface_IDC, nMarker_Analyze);
+  func(Surface_IDC_Mach, nMarker_Analyze);
+  func(Surface_IDR, nMarker_Analyze);
+
+  func(ActDisk_DeltaPress, nMarker_ActDiskInlet);
+  func(ActDisk_DeltaTemp, nMarker_ActDiskInlet);
+  func(ActDisk_TotalPressRatio, nMarker_ActDiskInlet);
+  func(ActDisk_TotalTempRatio, nMarker_ActDiskInlet);
+  func(ActDisk_StaticPressRatio, nMarker_ActDiskInlet);
+  func(ActDisk_StaticTempRatio, nMarker_ActDiskInlet);
+  func(ActDisk_Power, nMarker_ActDiskInlet);
+  func(ActDisk_MassFlow, nMarker_ActDiskInlet);
+  func(ActDisk_Mach, nMarker_ActDiskInlet);
+  func(ActDisk_Force, nMarker_ActDiskInlet);
+  func(ActDisk_NetThrust, nMarker_ActDiskInlet);
+  func(ActDisk_BCThrust, nMarker_ActDiskInlet);
+  func(ActDisk_BCThrust_Old, nMarker_ActDiskInlet);
+  func(ActDisk_GrossThrust, nMarker_ActDiskInlet);
+  func(ActDisk_Area, nMarker_ActDiskInlet);
+  func(ActDisk_ReverseMassFlow, nMarker_ActDiskInlet);
+  func(ActDiskInlet_MassFlow, nMarker_ActDiskInlet);
+  func(ActDiskInlet_Temperature, nMarker_ActDiskInlet);
+  func(ActDiskInlet_TotalTemperature, nMarker_ActDiskInlet);
+  func(ActDiskInlet_Pressure, nMarker_ActDiskInlet);
+  func(ActDiskInlet_TotalPressure, nMarker_ActDiskInlet);
+  func(ActDiskInlet_RamDrag, nMarker_ActDiskInlet);
+  func(ActDiskInlet_Force, nMarker_ActDiskInlet);
+  func(ActDiskInlet_Power, nMarker_ActDiskInlet);
+
+  func(ActDiskOutlet_MassFlow, nMarker_ActDiskOutlet);
+  func(ActDiskOutlet_Temperature, nMarker_ActDiskOutlet);
+  func(ActDiskOutlet_TotalTemperature, nMarker_ActDiskOutlet);
+  func(ActDiskOutlet_Pressure, nMarker_ActDiskOutlet);
+  func(ActDiskOutlet_TotalPressure, nMarker_ActDiskOutlet);
+  func(ActDiskOutlet_GrossThrust, nMarker_ActDiskOutlet);
+  func(ActDiskOutlet_Force, nMarker_ActDiskOutlet);
+  func(ActDiskOutlet_Power, nMarker_ActDiskOutlet);
+
+  func(Outlet_MassFlow, nMarker_Outlet);
+  func(Outlet_Density, nMarker_Outlet);
+  func(Outlet_Area, nMarker_Outlet);
+
+  func(Engine_Power, nMarker_EngineInflow);
+  func(Engine_Mach, nMarker_EngineInflow);
+  func(Engine_Force, nMarker_EngineInflow);
+  func(Engine_NetThrust, nMarker_EngineInflow);
+  func(Engine_GrossThrust, nMarker_EngineInflow);
+  func(Engine_Area, nMarker_EngineInflow);
+  func(Inflow_Mach, nMarker_EngineInflow);
+  func(Inflow_Pressure, nMarker_EngineInflow);
+  func(Inflow_MassFlow, nMarker_EngineInflow);
+  func(Inflow_ReverseMassFlow, nMarker_EngineInflow);
+  func(Inflow_TotalPressure, nMarker_EngineInflow);
+  func(Inflow_Temperature, nMarker_EngineInflow);
+  func(Inflow_TotalTemperature, nMarker_EngineInflow);
+  func(Inflow_RamDrag, nMarker_EngineInflow);
+  func(Inflow_Force, nMarker_EngineInflow);
+  func(Inflow_Power, nMarker_EngineInflow);
+
+  func(Exhaust_Pressure, nMarker_EngineExhaust);
+  func(Exhaust_Temperature, nMarker_EngineExhaust);
+  func(Exhaust_MassFlow, nMarker_EngineExhaust);
+  func(Exhaust_TotalPressure, nMarker_EngineExhaust);
+  func(Exhaust_TotalTemperature, nMarker_EngineExhaust);
+  func(Exhaust_GrossThrust, nMarker_EngineExhaust);
+  func(Exhaust_Force, nMarker_EngineExhaust);
+  func(Exhaust_Power, nMarker_EngineExhaust);
+
+}
+
+CConfig* CConfig::CopyInstance() const {
+
+  CConfig* config = new CConfig(*this);
+  config->Instance_Copy = true;
+
+  config->ForEachRuntimeArray([](su2double*& values, unsigned long size) {
+    if (values == NULL) return;
+    su2double* copy = new su2double[size];
+    for (unsigned long i = 0; i < size; i++) copy[i] = values[i];
+    values = copy;
+  });
+
+  return config;
+}
+
 CConfig::~CConfig(void) {
 
   unsigned long iDV, iMarker, iPeriodic, iFFD;
 
+  /*--- A copy for a time instance only owns the values computed during the iterations. ---*/
+
+  if (Instance_Copy) {
+    ForEachRuntimeArray([](su2double*& values, unsigned long) { delete [] values; });
+    return;
+  }
+
   /*--- Delete all of the option objects in the global option map ---*/
 
   for(map<string, COptionBase*>::iterator itr = option_map.begin(); itr != option_map.end(); itr++) {
@@ -7369,6 +7611,8 @@ CConfig::~CConfig(void) {
   if (TimeIntegrationADER_DG    != NULL) delete [] TimeIntegrationADER_DG;
   if (WeightsIntegrationADER_DG != NULL) delete [] WeightsIntegrationADER_DG;
   if (RK_Alpha_Step             != NULL) delete [] RK_Alpha_Step;
+  if (Probe_Coords              != NULL) delete [] Probe_Coords;
+  if (Slice_Planes              != NULL) delete [] Slice_Planes;
   if (MG_PreSmooth              != NULL) delete [] MG_PreSmooth;
   if (MG_PostSmooth             != NULL) delete [] MG_PostSmooth;
 
@@ -7751,6 +7995,8 @@ CConfig::~CConfig(void) {
   if (default_eng_cyl       != NULL) delete [] default_eng_cyl;
   if (default_eng_val       != NULL) delete [] default_eng_val;
   if (default_cfl_adapt     != NULL) delete [] default_cfl_adapt;
+  if (default_cfl_feedback  != NULL) delete [] default_cfl_feedback;
+  if (default_jacobian_lag  != NULL) delete [] default_jacobian_lag;
   if (default_jst_coeff != NULL) delete [] default_jst_coeff;
   if (default_ffd_coeff != NULL) delete [] default_ffd_coeff;
   if (default_mixedout_coeff!= NULL) delete [] default_mixedout_coeff;
@@ -7767,6 +8013,7 @@ CConfig::~CConfig(void) {
   if (default_inc_crit      != NULL) delete [] default_inc_crit;
   if (default_htp_axis      != NULL) delete [] default_htp_axis;
   if (default_body_force    != NULL) delete [] default_body_force;
+  if (default_fluid_table_range != NULL) delete [] default_fluid_table_range;
   if (default_sineload_coeff!= NULL) delete [] default_sineload_coeff;
   if (default_nacelle_location    != NULL) delete [] default_nacelle_location;
   if (default_wrt_freq != NULL) delete [] default_wrt_freq;
@@ -9304,8 +9551,8 @@ void CConfig::SetProfilingCSV(void) {
   int rank = MASTER_NODE;
   int size = SINGLE_NODE;
 #ifdef HAVE_MPI
-  SU2_MPI::Comm_rank(MPI_COMM_WORLD, &rank);
-  SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+  SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
+  SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
 #endif
 
   /*--- Each rank has the same stack trace, so the they have the same
@@ -9389,11 +9636,11 @@ void CConfig::SetProfilingCSV(void) {
   }
 
 #ifdef HAVE_MPI
-  MPI_Reduce(n_calls, n_calls_red, map_size, MPI_INT, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_tot, l_tot_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_avg, l_avg_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_min, l_min_red, map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_max, l_max_red, map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(n_calls, n_calls_red, map_size, MPI_INT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  MPI_Reduce(l_tot, l_tot_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  MPI_Reduce(l_avg, l_avg_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  MPI_Reduce(l_min, l_min_red, map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+  MPI_Reduce(l_max, l_max_red, map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
 #else
   memcpy(n_calls_red, n_calls, map_size*sizeof(int));
   memcpy(l_tot_red,   l_tot,   map_size*sizeof(double));
@@ -9536,8 +9783,8 @@ void CConfig::GEMMProfilingCSV(void) {
   /* Parallel executable. The profiling data must be sent to the master node.
      First determine the rank and size. */
   int size;
-  SU2_MPI::Comm_rank(MPI_COMM_WORLD, &rank);
-  SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+  SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
+  SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
 
   /* Check for the master node. */
   if(rank == MASTER_NODE) {
@@ -9548,7 +9795,7 @@ void CConfig::GEMMProfilingCSV(void) {
       /* Block until a message from this processor arrives. Determine
          the number of entries in the receive buffers. */
       SU2_MPI::Status status;
-      SU2_MPI::Probe(proc, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Probe(proc, 0, SU2_MPI::GetComm(), &status);
 
       int nEntries;
       SU2_MPI::Get_count(&status, MPI_LONG, &nEntries);
@@ -9562,15 +9809,15 @@ void CConfig::GEMMProfilingCSV(void) {
       vector<long>   recvBufMNK(3*nEntries);
 
       SU2_MPI::Recv(recvBufNCalls.data(), recvBufNCalls.size(),
-                    MPI_LONG, proc, 0, MPI_COMM_WORLD, &status);
+                    MPI_LONG, proc, 0, SU2_MPI::GetComm(), &status);
       SU2_MPI::Recv(recvBufTotTime.data(), recvBufTotTime.size(),
-                    MPI_DOUBLE, proc, 1, MPI_COMM_WORLD, &status);
+                    MPI_DOUBLE, proc, 1, SU2_MPI::GetComm(), &status);
       SU2_MPI::Recv(recvBufMinTime.data(), recvBufMinTime.size(),
-                    MPI_DOUBLE, proc, 2, MPI_COMM_WORLD, &status);
+                    MPI_DOUBLE, proc, 2, SU2_MPI::GetComm(), &status);
       SU2_MPI::Recv(recvBufMaxTime.data(), recvBufMaxTime.size(),
-                    MPI_DOUBLE, proc, 3, MPI_COMM_WORLD, &status);
+                    MPI_DOUBLE, proc, 3, SU2_MPI::GetComm(), &status);
       SU2_MPI::Recv(recvBufMNK.data(), recvBufMNK.size(),
-                    MPI_LONG, proc, 4, MPI_COMM_WORLD, &status);
+                    MPI_LONG, proc, 4, SU2_MPI::GetComm(), &status);
 
       /* Loop over the number of entries. */
       for(int i=0; i<nEntries; ++i) {
@@ -9619,15 +9866,15 @@ void CConfig::GEMMProfilingCSV(void) {
 
     /* Send the data to the master node using blocking sends. */
     SU2_MPI::Send(GEMM_Profile_NCalls.data(), GEMM_Profile_NCalls.size(),
-                  MPI_LONG, MASTER_NODE, 0, MPI_COMM_WORLD);
+                  MPI_LONG, MASTER_NODE, 0, SU2_MPI::GetComm());
     SU2_MPI::Send(GEMM_Profile_TotTime.data(), GEMM_Profile_TotTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 1, MPI_COMM_WORLD);
+                  MPI_DOUBLE, MASTER_NODE, 1, SU2_MPI::GetComm());
     SU2_MPI::Send(GEMM_Profile_MinTime.data(), GEMM_Profile_MinTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 2, MPI_COMM_WORLD);
+                  MPI_DOUBLE, MASTER_NODE, 2, SU2_MPI::GetComm());
     SU2_MPI::Send(GEMM_Profile_MaxTime.data(), GEMM_Profile_MaxTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 3, MPI_COMM_WORLD);
+                  MPI_DOUBLE, MASTER_NODE, 3, SU2_MPI::GetComm());
     SU2_MPI::Send(sendBufMNK.data(), sendBufMNK.size(),
-                  MPI_LONG, MASTER_NODE, 4, MPI_COMM_WORLD);
+                  MPI_LONG, MASTER_NODE, 4, SU2_MPI::GetComm());
   }
 
 #endif
@@ -0,0 +1,130 @@
+/*!
+ * \file benchmark_gemm.cpp
+ * \brief Benchmark of the small matrix products of the DG solver. The kernels
+ *        specialized on K are compared with the generic path, which is LIBXSMM,
+ *        MKL, BLAS or the blocked native implementation, depending on the build.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/blas_structure.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+/*--- Shape of the products in the volume residual of the DG solver for a standard
+      element: the solution and its gradients in the integration points are computed
+      from the DOFs, i.e. M = nInt*(nDim+1), K = nDOFs, and the residual is computed
+      from the fluxes, i.e. M = nDOFs, K = nInt*nDim. The integration rules are the
+      tensor (collapsed for simplices) Gauss rules with p+2 points per direction. ---*/
+struct CShapeDG {
+  const char *name;
+  int p, nDim, nDOFs, nInt;
+};
+
+/* Time nCalls products in seconds per call. */
+template<class TProduct>
+static double TimeProduct(TProduct product, const int nCalls) {
+  product();
+  auto start = chrono::high_resolution_clock::now();
+  for(int i=0; i<nCalls; ++i) product();
+  auto stop  = chrono::high_resolution_clock::now();
+  return chrono::duration<double>(stop-start).count()/nCalls;
+}
+
+int main(int argc, char **argv) {
+
+  /* The padded N of the DG solver for 8 elements treated simultaneously and
+     nDim+2 variables can be overruled on the command line. */
+  const int nElemSimul = (argc > 1) ? atoi(argv[1]) : 8;
+
+  vector<CShapeDG> shapes;
+  for(int p=1; p<=4; ++p) {
+    const int n1D = p+2;
+    shapes.push_back({"TRI",  p, 2, (p+1)*(p+2)/2,       n1D*n1D});
+    shapes.push_back({"QUAD", p, 2, (p+1)*(p+1),         n1D*n1D});
+  }
+  for(int p=1; p<=3; ++p) {
+    const int n1D = p+2;
+    shapes.push_back({"TET",  p, 3, (p+1)*(p+2)*(p+3)/6, n1D*n1D*n1D});
+    shapes.push_back({"HEX",  p, 3, (p+1)*(p+1)*(p+1),   n1D*n1D*n1D});
+  }
+
+  CBlasStructure blas;
+
+  printf("%-5s %2s %5s %5s %5s %12s %12s %8s %10s\n", "elem", "p", "M", "N", "K",
+         "fixed GF/s", "generic GF/s", "speedup", "max diff");
+
+  for(const auto &shape : shapes) {
+
+    const int nVar = shape.nDim + 2;
+    int N = nElemSimul*nVar;
+    if(N%8) N += 8 - N%8;
+
+    /* The two products of the volume residual. */
+    const int products[2][2] = {{shape.nInt*(shape.nDim+1), shape.nDOFs},
+                                {shape.nDOFs, shape.nInt*shape.nDim}};
+
+    for(int iProd=0; iProd<2; ++iProd) {
+      const int M = products[iProd][0], K = products[iProd][1];
+
+      vector<su2double> A(M*K), B(K*N), C1(M*N), C2(M*N);
+      for(auto &a : A) a = rand()/double(RAND_MAX) - 0.5;
+      for(auto &b : B) b = rand()/double(RAND_MAX) - 0.5;
+
+      /* Roughly 0.1 s per measurement. */
+      const double flop = 2.0*M*N*K;
+      const int nCalls = max(10, int(2.e8/flop));
+
+      CBlasStructure::GemmKernel kernel = blas.GetFixedKernel(K);
+
+      const double tGeneric = TimeProduct([&]() {
+        blas.gemm_generic(M, N, K, A.data(), B.data(), C2.data());
+      }, nCalls);
+
+      if( kernel ) {
+        const double tFixed = TimeProduct([&]() {
+          kernel(M, N, A.data(), B.data(), C1.data());
+        }, nCalls);
+
+        double maxDiff = 0.0;
+        for(int i=0; i<M*N; ++i)
+          maxDiff = max(maxDiff, fabs(SU2_TYPE::GetValue(C1[i]-C2[i])));
+
+        printf("%-5s %2d %5d %5d %5d %12.2f %12.2f %8.2f %10.2e\n", shape.name, shape.p, M, N, K,
+               1.e-9*flop/tFixed, 1.e-9*flop/tGeneric, tGeneric/tFixed, maxDiff);
+      }
+      else {
+        printf("%-5s %2d %5d %5d %5d %12s %12.2f %8s %10s\n", shape.name, shape.p, M, N, K,
+               "-", 1.e-9*flop/tGeneric, "-", "-");
+      }
+    }
+  }
+
+  return 0;
+}
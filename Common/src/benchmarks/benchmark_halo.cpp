@@ -0,0 +1,237 @@
+/*!
+ * \file benchmark_halo.cpp
+ * \brief Benchmark of the halo exchange patterns. Non-blocking point-to-point
+ *        messages posted for each exchange (the original pattern of SU2), persistent
+ *        requests (the current pattern of the geometry P2P comms), a neighborhood
+ *        collective on a distributed graph communicator, and the shared memory window
+ *        of HALO_SHARED_MEMORY (when all ranks are on one node) are compared for an
+ *        increasing number of neighbors per rank. The shared memory exchange is also
+ *        checked for races by verifying every value over a number of exchanges.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+#ifdef HAVE_MPI
+#include <mpi.h>
+
+using namespace std;
+
+/* Time nRep exchanges in seconds per exchange, maximum over the ranks. */
+template<class TExchange>
+static double TimeExchange(TExchange exchange, const int nRep) {
+  exchange();
+  MPI_Barrier(MPI_COMM_WORLD);
+  const double start = MPI_Wtime();
+  for(int i=0; i<nRep; ++i) exchange();
+  double time = (MPI_Wtime()-start)/nRep;
+  MPI_Allreduce(MPI_IN_PLACE, &time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  return time;
+}
+
+int main(int argc, char **argv) {
+
+  MPI_Init(&argc, &argv);
+
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  /* Number of doubles per neighbor (e.g. 1000 halo points of 5 variables) and
+     number of repetitions, can be overruled on the command line. */
+  const int count = (argc > 1) ? atoi(argv[1]) : 5000;
+  const int nRep  = (argc > 2) ? atoi(argv[2]) : 200;
+
+  /* The shared memory exchange is only timed if all ranks are on the same node. */
+  MPI_Comm nodeComm;
+  int nodeSize;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+  MPI_Comm_size(nodeComm, &nodeSize);
+  const bool oneNode = (nodeSize == size);
+
+  if (rank == 0) {
+    printf("Halo exchange of %d doubles per neighbor on %d ranks.\n", count, size);
+    printf("%9s %14s %14s %14s %14s\n", "neighbors", "isend (us)", "persist (us)", "neighbor (us)", "shared (us)");
+  }
+
+  /* The neighbors are the ranks at offsets +-1, ..., +-nOffset on a ring, which
+     keeps the send and receive lists symmetric. */
+  for(int nOffset=1; nOffset<=size/2; nOffset*=2) {
+
+    vector<int> neighbors;
+    for(int offset=1; offset<=nOffset; ++offset) {
+      neighbors.push_back((rank+offset)%size);
+      if (2*offset != size) neighbors.push_back((rank-offset+size)%size);
+    }
+    const int nMsg = neighbors.size();
+
+    vector<double> sendBuf(nMsg*count, rank), recvBuf(nMsg*count);
+    vector<MPI_Request> requests(2*nMsg);
+
+    /*--- Non-blocking messages posted for each exchange. ---*/
+    auto isend = [&]() {
+      for(int i=0; i<nMsg; ++i)
+        MPI_Irecv(&recvBuf[i*count], count, MPI_DOUBLE, neighbors[i], 0, MPI_COMM_WORLD, &requests[i]);
+      for(int i=0; i<nMsg; ++i)
+        MPI_Isend(&sendBuf[i*count], count, MPI_DOUBLE, neighbors[i], 0, MPI_COMM_WORLD, &requests[nMsg+i]);
+      MPI_Waitall(2*nMsg, requests.data(), MPI_STATUSES_IGNORE);
+    };
+    const double tIsend = TimeExchange(isend, nRep);
+
+    /*--- Persistent requests, created once. ---*/
+    vector<MPI_Request> persistent(2*nMsg);
+    for(int i=0; i<nMsg; ++i) {
+      MPI_Recv_init(&recvBuf[i*count], count, MPI_DOUBLE, neighbors[i], 0, MPI_COMM_WORLD, &persistent[i]);
+      MPI_Send_init(&sendBuf[i*count], count, MPI_DOUBLE, neighbors[i], 0, MPI_COMM_WORLD, &persistent[nMsg+i]);
+    }
+    auto persist = [&]() {
+      MPI_Startall(2*nMsg, persistent.data());
+      MPI_Waitall(2*nMsg, persistent.data(), MPI_STATUSES_IGNORE);
+    };
+    const double tPersist = TimeExchange(persist, nRep);
+    for(auto& request : persistent) MPI_Request_free(&request);
+
+    /*--- Neighborhood collective on a distributed graph communicator. ---*/
+    MPI_Comm graphComm;
+    MPI_Dist_graph_create_adjacent(MPI_COMM_WORLD, nMsg, neighbors.data(), MPI_UNWEIGHTED,
+                                   nMsg, neighbors.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, 0, &graphComm);
+    vector<int> counts(nMsg, count), displs(nMsg);
+    for(int i=0; i<nMsg; ++i) displs[i] = i*count;
+    auto neighbor = [&]() {
+      MPI_Neighbor_alltoallv(sendBuf.data(), counts.data(), displs.data(), MPI_DOUBLE,
+                             recvBuf.data(), counts.data(), displs.data(), MPI_DOUBLE, graphComm);
+    };
+    const double tNeighbor = TimeExchange(neighbor, nRep);
+    MPI_Comm_free(&graphComm);
+
+    /* Sanity check of the received data. */
+    bool ok = true;
+    for(int i=0; i<nMsg; ++i) ok &= (recvBuf[i*count] == neighbors[i]);
+
+    /*--- Shared memory window (the protocol of CGeometry with HALO_SHARED_MEMORY), each
+     rank copies its messages into the recv buffer of the destination. Empty persistent
+     messages tell the sources that a buffer is free and the destinations that the data
+     arrived, each of them paired with a Win_sync on both sides. ---*/
+    double tShared = 0.0;
+    if (oneNode) {
+      double* winBuf = nullptr;
+      MPI_Win win;
+      MPI_Win_allocate_shared(nMsg*count*sizeof(double), sizeof(double), MPI_INFO_NULL,
+                              nodeComm, &winBuf, &win);
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+      /* Location of each message in the buffer of its destination, and its address
+         (with all ranks on one node the rank in nodeComm is the global rank). */
+      vector<int> idx(nMsg), remoteIdx(nMsg);
+      for(int i=0; i<nMsg; ++i) {
+        idx[i] = i;
+        MPI_Irecv(&remoteIdx[i], 1, MPI_INT, neighbors[i], 1, MPI_COMM_WORLD, &requests[i]);
+        MPI_Isend(&idx[i], 1, MPI_INT, neighbors[i], 1, MPI_COMM_WORLD, &requests[nMsg+i]);
+      }
+      MPI_Waitall(2*nMsg, requests.data(), MPI_STATUSES_IGNORE);
+
+      vector<double*> remoteBuf(nMsg);
+      for(int i=0; i<nMsg; ++i) {
+        MPI_Aint winSize; int dispUnit;
+        MPI_Win_shared_query(win, neighbors[i], &winSize, &dispUnit, &remoteBuf[i]);
+        remoteBuf[i] += remoteIdx[i]*count;
+      }
+
+      vector<MPI_Request> readySend(nMsg), readyRecv(nMsg), arriveSend(nMsg), arriveRecv(nMsg);
+      for(int i=0; i<nMsg; ++i) {
+        MPI_Send_init(nullptr, 0, MPI_DOUBLE, neighbors[i], 2, MPI_COMM_WORLD, &readySend[i]);
+        MPI_Recv_init(nullptr, 0, MPI_DOUBLE, neighbors[i], 2, MPI_COMM_WORLD, &readyRecv[i]);
+        MPI_Send_init(nullptr, 0, MPI_DOUBLE, neighbors[i], 3, MPI_COMM_WORLD, &arriveSend[i]);
+        MPI_Recv_init(nullptr, 0, MPI_DOUBLE, neighbors[i], 3, MPI_COMM_WORLD, &arriveRecv[i]);
+      }
+
+      auto shared = [&]() {
+        /* Our reads of the previous exchange are done, the buffer is free. */
+        MPI_Win_sync(win);
+        MPI_Startall(nMsg, arriveRecv.data());
+        MPI_Startall(nMsg, readyRecv.data());
+        MPI_Startall(nMsg, readySend.data());
+        for(int i=0; i<nMsg; ++i) {
+          MPI_Wait(&readyRecv[i], MPI_STATUS_IGNORE);
+          MPI_Win_sync(win);
+          copy_n(&sendBuf[i*count], count, remoteBuf[i]);
+          MPI_Win_sync(win);
+          MPI_Start(&arriveSend[i]);
+        }
+        for(int i=0; i<nMsg; ++i) {
+          int ind;
+          MPI_Waitany(nMsg, arriveRecv.data(), &ind, MPI_STATUS_IGNORE);
+          /* The data written by the source is visible after this sync. */
+          MPI_Win_sync(win);
+        }
+        MPI_Waitall(nMsg, readySend.data(), MPI_STATUSES_IGNORE);
+        MPI_Waitall(nMsg, arriveSend.data(), MPI_STATUSES_IGNORE);
+      };
+      tShared = TimeExchange(shared, nRep);
+
+      /* Verify every value over a number of exchanges, with different data each time. */
+      for(int stamp=1; stamp<=50; ++stamp) {
+        for(int i=0; i<nMsg; ++i)
+          fill_n(&sendBuf[i*count], count, double(stamp*size+rank));
+        shared();
+        for(int i=0; i<nMsg; ++i)
+          for(int j=0; j<count; ++j)
+            ok &= (winBuf[i*count+j] == double(stamp*size+neighbors[i]));
+      }
+
+      for(int i=0; i<nMsg; ++i) {
+        MPI_Request_free(&readySend[i]); MPI_Request_free(&readyRecv[i]);
+        MPI_Request_free(&arriveSend[i]); MPI_Request_free(&arriveRecv[i]);
+      }
+      MPI_Win_unlock_all(win);
+      MPI_Win_free(&win);
+    }
+
+    int allOk = ok;
+    MPI_Allreduce(MPI_IN_PLACE, &allOk, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+      printf("%9d %14.2f %14.2f %14.2f", nMsg, 1e6*tIsend, 1e6*tPersist, 1e6*tNeighbor);
+      if (oneNode) printf(" %14.2f", 1e6*tShared);
+      else printf(" %14s", "n/a");
+      printf("%s\n", allOk ? "" : "  WRONG DATA");
+    }
+  }
+
+  MPI_Comm_free(&nodeComm);
+
+  MPI_Finalize();
+  return 0;
+}
+
+#else
+
+int main() {
+  printf("The halo exchange benchmark requires a build with MPI.\n");
+  return 0;
+}
+
+#endif
@@ -0,0 +1,196 @@
+/*!
+ * \file benchmark_sysmatrix.cpp
+ * \brief Benchmark of the sparse matrix kernels of the linear solvers. The kernels
+ *        of CSysMatrix that are specialized on the block size (matrix-vector product,
+ *        ILU factorization and substitution, LU-SGS sweeps) are compared with the
+ *        generic ones, for the block sizes of the scalar, turbulence and flow solvers,
+ *        on the edge-based sparse pattern of a structured hexahedral mesh (MESH_FORMAT=BOX).
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/CConfig.hpp"
+#include "../../include/geometry/CPhysicalGeometry.hpp"
+#include "../../include/linear_algebra/CSysMatrix.hpp"
+#include "../../include/linear_algebra/CSysVector.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+/* Time nCalls operations in seconds per call. */
+template<class TOperation>
+static double TimeOperation(TOperation operation, const int nCalls) {
+  operation();
+  auto start = chrono::high_resolution_clock::now();
+  for(int i=0; i<nCalls; ++i) operation();
+  auto stop  = chrono::high_resolution_clock::now();
+  return chrono::duration<double>(stop-start).count()/nCalls;
+}
+
+/* Results of one matrix, with the specialized or the generic kernels. */
+struct CMatrixTimes {
+  double spmv, iluBuild, iluApply, lusgs;
+  CSysVector<su2double> prodSpmv, prodIlu, prodLusgs;
+};
+
+static CMatrixTimes TimeMatrix(unsigned short nVar, bool generic, const int nCalls,
+                               CGeometry *geometry, CConfig *config) {
+
+  const unsigned long nPoint = geometry->GetnPoint(), nPointDomain = geometry->GetnPointDomain();
+
+  CSysMatrix<su2double> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+  if(generic) matrix.SetGenericKernels();
+
+  /* Diagonally dominant blocks, the same values (same seed) for both kernels. */
+  srand(0);
+  vector<su2double> block(nVar*nVar);
+  auto Random = []() { return rand()/double(RAND_MAX) - 0.5; };
+
+  for(unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    const auto nNeigh = geometry->node[iPoint]->GetnPoint();
+    for(unsigned short iNeigh = 0; iNeigh < nNeigh; ++iNeigh) {
+      for(auto &b : block) b = 0.2*Random()/nVar;
+      matrix.SetBlock(iPoint, geometry->node[iPoint]->GetPoint(iNeigh), block.data());
+    }
+    for(unsigned short iVar = 0; iVar < nVar; ++iVar)
+      for(unsigned short jVar = 0; jVar < nVar; ++jVar)
+        block[iVar*nVar+jVar] = (iVar == jVar)? nNeigh + 1.0 + Random() : 0.2*Random()/nVar;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+  }
+
+  CSysVector<su2double> vec(nPoint, nPointDomain, nVar, 0.0);
+  for(unsigned long i = 0; i < nPoint*nVar; ++i) vec[i] = Random();
+
+  CMatrixTimes times;
+  times.prodSpmv.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  times.prodIlu.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  times.prodLusgs.Initialize(nPoint, nPointDomain, nVar, 0.0);
+
+  times.spmv = TimeOperation([&]() {
+    matrix.MatrixVectorProduct(vec, times.prodSpmv, geometry, config);
+  }, nCalls);
+
+  times.iluBuild = TimeOperation([&]() { matrix.BuildILUPreconditioner(); }, max(1, nCalls/10));
+
+  times.iluApply = TimeOperation([&]() {
+    matrix.ComputeILUPreconditioner(vec, times.prodIlu, geometry, config);
+  }, nCalls);
+
+  times.lusgs = TimeOperation([&]() {
+    matrix.ComputeLU_SGSPreconditioner(vec, times.prodLusgs, geometry, config);
+  }, nCalls);
+
+  return times;
+}
+
+static su2double MaxDiff(const CSysVector<su2double> &a, const CSysVector<su2double> &b) {
+  su2double diff = 0.0;
+  for(unsigned long i = 0; i < a.GetLocSize(); ++i) diff = max(diff, fabs(a[i]-b[i]));
+  return diff;
+}
+
+int main(int argc, char **argv) {
+
+  SU2_MPI::Init(&argc, &argv);
+  SU2_MPI::SetComm(MPI_COMM_WORLD);
+
+  /* Number of points per direction of the mesh and number of calls, can be
+     overruled on the command line. */
+  const int nPoint1D = (argc > 1) ? atoi(argv[1]) : 48;
+  const int nCalls   = (argc > 2) ? atoi(argv[2]) : 20;
+
+  /* The mesh is generated from a minimal configuration. */
+  char cfgName[MAX_STRING_SIZE] = "benchmark_sysmatrix.cfg";
+  if(SU2_MPI::GetRank() == MASTER_NODE) {
+    ofstream cfg(cfgName);
+    cfg << "SOLVER= EULER\n"
+        << "MESH_FORMAT= BOX\n"
+        << "MESH_BOX_SIZE= ( " << nPoint1D << ", " << nPoint1D << ", " << nPoint1D << " )\n"
+        << "MARKER_FAR= ( x_minus, x_plus, y_minus, y_plus, z_minus, z_plus )\n"
+        << "LINEAR_SOLVER_PREC= ILU\n"
+        << "LINEAR_SOLVER_ILU_FILL_IN= 0\n";
+  }
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+
+  CConfig config(cfgName, SU2_CFD, false);
+
+  /* Partitioning and the parts of the dual grid preprocessing the sparse pattern needs. */
+  CPhysicalGeometry *geometry_aux = new CPhysicalGeometry(&config, ZONE_0, 1);
+  geometry_aux->SetColorGrid_Parallel(&config);
+  CPhysicalGeometry *geometry = new CPhysicalGeometry(geometry_aux, &config);
+  delete geometry_aux;
+
+  geometry->SetSendReceive(&config);
+  geometry->SetBoundaries(&config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetRCM_Ordering(&config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetEdges();
+  geometry->PreprocessP2PComms(geometry, &config);
+
+  if(SU2_MPI::GetRank() == MASTER_NODE) {
+    printf("\nSparse matrix kernels, %lu points (%d^3 mesh), time per call in ms.\n",
+           geometry->GetGlobal_nPointDomain(), nPoint1D);
+    printf("%4s %-9s %11s %11s %11s %11s %10s\n", "nVar", "kernels", "SpMV", "ILU build",
+           "ILU apply", "LU-SGS", "max diff");
+  }
+
+  for(unsigned short nVar = 1; nVar <= 5; ++nVar) {
+
+    const CMatrixTimes fixed = TimeMatrix(nVar, false, nCalls, geometry, &config);
+    const CMatrixTimes generic = TimeMatrix(nVar, true, nCalls, geometry, &config);
+
+    const su2double diff = max(MaxDiff(fixed.prodSpmv, generic.prodSpmv),
+                               max(MaxDiff(fixed.prodIlu, generic.prodIlu),
+                                   MaxDiff(fixed.prodLusgs, generic.prodLusgs)));
+
+    /* Slowest rank. */
+    double localTimes[2][4] = {{fixed.spmv, fixed.iluBuild, fixed.iluApply, fixed.lusgs},
+                               {generic.spmv, generic.iluBuild, generic.iluApply, generic.lusgs}};
+    double times[2][4], localDiff = SU2_TYPE::GetValue(diff), maxDiff;
+    SU2_MPI::Allreduce(localTimes, times, 8, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&localDiff, &maxDiff, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+    if(SU2_MPI::GetRank() == MASTER_NODE) {
+      const char* names[] = {"fixed", "generic"};
+      for(int i = 0; i < 2; ++i)
+        printf("%4d %-9s %11.3f %11.3f %11.3f %11.3f %10s\n", nVar, names[i], 1.e3*times[i][0],
+               1.e3*times[i][1], 1.e3*times[i][2], 1.e3*times[i][3], "");
+      printf("%4d %-9s %11.2f %11.2f %11.2f %11.2f %10.2e\n", nVar, "speedup", times[1][0]/times[0][0],
+             times[1][1]/times[0][1], times[1][2]/times[0][2], times[1][3]/times[0][3], maxDiff);
+    }
+  }
+
+  delete geometry;
+
+  SU2_MPI::Finalize();
+
+  return 0;
+}
@@ -27,6 +27,7 @@
  */
 
 #include "../include/blas_structure.hpp"
+#include "../include/omp_structure.hpp"
 #include <cstring>
 
 /* MKL or BLAS, if supported. */
@@ -43,12 +44,75 @@ extern "C" void dgemv_(char*, const int*, const int*, const passivedouble*,
                        const int*, const passivedouble*, passivedouble*, const int*);
 #endif
 
-/* Constructor. Initialize the const member variables, if needed. */
+namespace {
+
+/* Number of columns of C that are kept in registers by the specialized kernels. */
+const int nColBlockKernel = 8;
+
+/* Matrix product C = A*B for row major matrices, where the number of columns
+   of A, K, is known at compile time. In the DG solver K is the number of DOFs
+   or integration points of a standard element and N is padded, such that the
+   rows of B and C are aligned. The columns of C are computed in blocks, which
+   are accumulated in registers over the fully unrolled K loop. The inner loop
+   has a fixed length and is vectorized by the compiler for the instruction
+   set of the target, e.g. AVX2 or AVX-512. */
+template<int K>
+void gemm_fixedK(const int M, const int N, const su2double *A,
+                 const su2double *B, su2double *C) {
+
+  for(int i=0; i<M; ++i) {
+    const su2double *a = A + i*K;
+    su2double       *c = C + i*N;
+
+    int j = 0;
+    for(; j<=(N-nColBlockKernel); j+=nColBlockKernel) {
+      su2double cBlock[nColBlockKernel];
+      for(int l=0; l<nColBlockKernel; ++l) cBlock[l] = 0.0;
+
+      for(int k=0; k<K; ++k) {
+        const su2double  aik = a[k];
+        const su2double *b   = B + k*N + j;
+        SU2_OMP_SIMD
+        for(int l=0; l<nColBlockKernel; ++l) cBlock[l] += aik*b[l];
+      }
+
+      for(int l=0; l<nColBlockKernel; ++l) c[j+l] = cBlock[l];
+    }
+
+    /* Remaining columns, if N is not a multiple of the block size. */
+    for(; j<N; ++j) {
+      su2double sum = 0.0;
+      for(int k=0; k<K; ++k) sum += a[k]*B[k*N+j];
+      c[j] = sum;
+    }
+  }
+}
+
+/* Recursive template to store the kernels for all values of K in the table. */
+template<int K>
+struct CFixedKernelTable {
+  static void Set(CBlasStructure::GemmKernel *table) {
+    table[K] = gemm_fixedK<K>;
+    CFixedKernelTable<K-1>::Set(table);
+  }
+};
+
+template<>
+struct CFixedKernelTable<0> {
+  static void Set(CBlasStructure::GemmKernel *table) { table[0] = NULL; }
+};
+
+}
+
+/* Constructor. Initialize the const member variables, if needed,
+   and build the table of the specialized kernels. */
 CBlasStructure::CBlasStructure(void)
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
   : mc (256), kc (128), nc (128) 
 #endif
-{}
+{
+  CFixedKernelTable<maxKFixedKernel>::Set(fixedKernels);
+}
 
 /* Destructor. Nothing to be done. */
 CBlasStructure::~CBlasStructure(void) {}
@@ -64,6 +128,28 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
   if( config ) config->GEMM_Tick(&timeGemm);
 #endif
 
+#if (defined(HAVE_LIBXSMM) || defined(HAVE_MKL)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  /* LIBXSMM and MKL generate their own kernels for small matrices. The
+     specialized kernels only replace the native implementation and the
+     reference or OpenBLAS dgemm, which are not tuned for these sizes. */
+  gemm_generic(M, N, K, A, B, C);
+#else
+  /* Use the kernel that is specialized on K, if available. */
+  GemmKernel kernel = GetFixedKernel(K);
+  if( kernel ) kernel(M, N, A, B, C);
+  else         gemm_generic(M, N, K, A, B, C);
+#endif
+
+  /* Store the profiling information, if needed. */
+#ifdef PROFILE
+  if( config ) config->GEMM_Tock(timeGemm, M, N, K);
+#endif
+}
+
+/* Dense matrix multiplication with the library or the native implementation. */
+void CBlasStructure::gemm_generic(const int M,        const int N,        const int K,
+                                  const su2double *A, const su2double *B, su2double *C) {
+
 #if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
   /* Native implementation of the matrix product. This optimized implementation
      assumes that the matrices are in column major order. This can be
@@ -95,11 +181,6 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
   dgemm_(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
 
 #endif
-#endif
-
-  /* Store the profiling information, if needed. */
-#ifdef PROFILE
-  if( config ) config->GEMM_Tock(timeGemm, M, N, K);
 #endif
 }
 
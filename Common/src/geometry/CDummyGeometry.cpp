@@ -79,17 +79,6 @@ CDummyGeometry::CDummyGeometry(CConfig *config){
   nP2PSend = 0;
   nP2PRecv = 0;
 
-  countPerPoint = 0;
-
-  bufD_P2PSend = NULL;
-  bufD_P2PRecv = NULL;
-
-  bufS_P2PSend = NULL;
-  bufS_P2PRecv = NULL;
-
-  req_P2PSend = NULL;
-  req_P2PRecv = NULL;
-
   nPoint_P2PSend = new int[size];
   nPoint_P2PRecv = new int[size];
 
@@ -104,17 +93,6 @@ CDummyGeometry::CDummyGeometry(CConfig *config){
   nPeriodicSend = 0;
   nPeriodicRecv = 0;
 
-  countPerPeriodicPoint = 0;
-
-  bufD_PeriodicSend = NULL;
-  bufD_PeriodicRecv = NULL;
-
-  bufS_PeriodicSend = NULL;
-  bufS_PeriodicRecv = NULL;
-
-  req_PeriodicSend = NULL;
-  req_PeriodicRecv = NULL;
-
   nPoint_PeriodicSend = NULL;
   nPoint_PeriodicRecv = NULL;
 
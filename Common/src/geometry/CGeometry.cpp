@@ -28,6 +28,19 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/omp_structure.hpp"
+#include <iomanip>
+
+/*--- Persistent point-to-point requests are not supported by the AD MPI wrapper. ---*/
+
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define PERSISTENT_P2P_COMMS
+#endif
+
+/*--- Index of the persistent requests for a data type and direction. ---*/
+
+static inline int PersistentP2PIndex(unsigned short commType, bool reverse) {
+  return 2*(commType == COMM_TYPE_UNSIGNED_SHORT) + reverse;
+}
 
 /*--- Cross product ---*/
 
@@ -95,17 +108,6 @@ CGeometry::CGeometry(void) {
   nP2PSend = 0;
   nP2PRecv = 0;
 
-  countPerPoint = 0;
-
-  bufD_P2PSend = NULL;
-  bufD_P2PRecv = NULL;
-
-  bufS_P2PSend = NULL;
-  bufS_P2PRecv = NULL;
-
-  req_P2PSend = NULL;
-  req_P2PRecv = NULL;
-
   nPoint_P2PSend = NULL;
   nPoint_P2PRecv = NULL;
 
@@ -120,17 +122,6 @@ CGeometry::CGeometry(void) {
   nPeriodicSend = 0;
   nPeriodicRecv = 0;
 
-  countPerPeriodicPoint = 0;
-
-  bufD_PeriodicSend = NULL;
-  bufD_PeriodicRecv = NULL;
-
-  bufS_PeriodicSend = NULL;
-  bufS_PeriodicRecv = NULL;
-
-  req_PeriodicSend = NULL;
-  req_PeriodicRecv = NULL;
-
   nPoint_PeriodicSend = NULL;
   nPoint_PeriodicRecv = NULL;
 
@@ -150,6 +141,9 @@ CGeometry::~CGeometry(void) {
   unsigned long iElem, iElem_Bound, iEdge, iFace, iPoint, iVertex;
   unsigned short iMarker;
 
+  for (auto iFlag = 0; iFlag < 2; iFlag++)
+    if (turboCommSplit[iFlag]) SU2_MPI::Comm_free(&turboComm[iFlag]);
+
   if (elem != NULL) {
     for (iElem = 0; iElem < nElem; iElem++)
       if (elem[iElem] != NULL) delete elem[iElem];
@@ -230,16 +224,14 @@ CGeometry::~CGeometry(void) {
     delete [] CustomBoundaryTemperature;
   }
 
-  /*--- Delete structures for MPI point-to-point communication. ---*/
-
-  if (bufD_P2PRecv != NULL) delete [] bufD_P2PRecv;
-  if (bufD_P2PSend != NULL) delete [] bufD_P2PSend;
+  /*--- Delete the buffers of the MPI comms. ---*/
 
-  if (bufS_P2PRecv != NULL) delete [] bufS_P2PRecv;
-  if (bufS_P2PSend != NULL) delete [] bufS_P2PSend;
+  for (auto buf : commBuffers) {
+    FreeCommBuffers(*buf);
+    delete buf;
+  }
 
-  if (req_P2PSend != NULL) delete [] req_P2PSend;
-  if (req_P2PRecv != NULL) delete [] req_P2PRecv;
+  /*--- Delete structures for MPI point-to-point communication. ---*/
 
   if (nPoint_P2PRecv != NULL) delete [] nPoint_P2PRecv;
   if (nPoint_P2PSend != NULL) delete [] nPoint_P2PSend;
@@ -252,15 +244,6 @@ CGeometry::~CGeometry(void) {
 
   /*--- Delete structures for MPI periodic communication. ---*/
 
-  if (bufD_PeriodicRecv != NULL) delete [] bufD_PeriodicRecv;
-  if (bufD_PeriodicSend != NULL) delete [] bufD_PeriodicSend;
-
-  if (bufS_PeriodicRecv != NULL) delete [] bufS_PeriodicRecv;
-  if (bufS_PeriodicSend != NULL) delete [] bufS_PeriodicSend;
-
-  if (req_PeriodicSend != NULL) delete [] req_PeriodicSend;
-  if (req_PeriodicRecv != NULL) delete [] req_PeriodicRecv;
-
   if (nPoint_PeriodicRecv != NULL) delete [] nPoint_PeriodicRecv;
   if (nPoint_PeriodicSend != NULL) delete [] nPoint_PeriodicSend;
 
@@ -336,7 +319,7 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nPoint_Send_All[1]), 1, MPI_INT,
-                    &(nPoint_Recv_All[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nPoint_Recv_All[1]), 1, MPI_INT, SU2_MPI::GetComm());
 
   /*--- Prepare to send connectivities. First check how many
    messages we will be sending and receiving. Here we also put
@@ -408,26 +391,11 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
   for (iRecv = 0; iRecv < nPoint_P2PRecv[nP2PRecv]; iRecv++)
     Local_Point_P2PRecv[iRecv] = 0;
 
-  /*--- We allocate the memory for communicating values in a later step
-   once we know the maximum packet size that we need to communicate. This
-   memory is deallocated and reallocated automatically in the case that
+  /*--- We allocate the memory for communicating values (see CCommBuffers) in
+   a later step once we know the maximum packet size that we need to communicate.
+   This memory is deallocated and reallocated automatically in the case that
    the previously allocated memory is not sufficient. ---*/
 
-  bufD_P2PSend = NULL;
-  bufD_P2PRecv = NULL;
-
-  bufS_P2PSend = NULL;
-  bufS_P2PRecv = NULL;
-
-  /*--- Allocate memory for the MPI requests if we need to communicate. ---*/
-
-  if (nP2PSend > 0) {
-    req_P2PSend   = new SU2_MPI::Request[nP2PSend];
-  }
-  if (nP2PRecv > 0) {
-    req_P2PRecv   = new SU2_MPI::Request[nP2PRecv];
-  }
-
   /*--- Build lists of local index values for send. ---*/
 
   count = 0;
@@ -478,10 +446,19 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
    here to separate the interior and boundary nodes in order to help
    further overlap computation and communication. ---*/
 
+  /*--- Optionally, the neighbors on the same node exchange the su2double
+   data through shared memory instead of messages. ---*/
+
+  sharedHalo = config->GetHalo_Shared_Memory();
+  if (sharedHalo)
+    for (auto buf : commBuffers) InitSharedP2PComms(*buf);
+
 }
 
 void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- This routine is activated whenever we attempt to perform
    a point-to-point MPI communication with our neighbors but the
    memory buffer allocated is not large enough for the packet size.
@@ -491,35 +468,62 @@ void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
 
   int iSend, iRecv;
 
+  /*--- The persistent requests refer to the old buffers. ---*/
+
+  FreePersistentP2PComms();
+
+  /*--- The requests do not depend on the packet size, allocate them with the first buffers. ---*/
+
+  buf.req_P2PSend.resize(nP2PSend);
+  buf.req_P2PRecv.resize(nP2PRecv);
+
   /*--- Store the larger packet size to the class data. ---*/
 
-  countPerPoint = val_countPerPoint;
+  const bool allocated = (buf.countPerPoint > 0);
+  buf.countPerPoint = val_countPerPoint;
 
   /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
-  if (bufD_P2PSend != NULL) delete [] bufD_P2PSend;
+  if (buf.bufD_P2PSend != NULL) delete [] buf.bufD_P2PSend;
 
-  bufD_P2PSend = new su2double[countPerPoint*nPoint_P2PSend[nP2PSend]];
-  for (iSend = 0; iSend < countPerPoint*nPoint_P2PSend[nP2PSend]; iSend++)
-    bufD_P2PSend[iSend] = 0.0;
+  buf.bufD_P2PSend = new su2double[buf.countPerPoint*nPoint_P2PSend[nP2PSend]];
+  for (iSend = 0; iSend < buf.countPerPoint*nPoint_P2PSend[nP2PSend]; iSend++)
+    buf.bufD_P2PSend[iSend] = 0.0;
 
-  if (bufD_P2PRecv != NULL) delete [] bufD_P2PRecv;
+  if (buf.sharedP2P) {
+#ifdef PERSISTENT_P2P_COMMS
+    /*--- The recv buffers of the ranks of the node form a shared memory
+     window, which is allocated collectively over the node. The window is
+     locked for passive target access during its lifetime, the sync of the
+     memory is done explicitly around the "ready" messages. ---*/
 
-  bufD_P2PRecv = new su2double[countPerPoint*nPoint_P2PRecv[nP2PRecv]];
-  for (iRecv = 0; iRecv < countPerPoint*nPoint_P2PRecv[nP2PRecv]; iRecv++)
-    bufD_P2PRecv[iRecv] = 0.0;
+    if (allocated) {
+      SU2_MPI::Win_unlock_all(buf.winP2PRecv);
+      SU2_MPI::Win_free(&buf.winP2PRecv);
+    }
+    SU2_MPI::Win_allocate_shared(buf.countPerPoint*nPoint_P2PRecv[nP2PRecv]*sizeof(su2double),
+                                 sizeof(su2double), buf.nodeComm, &buf.bufD_P2PRecv, &buf.winP2PRecv);
+    SU2_MPI::Win_lock_all(MPI_MODE_NOCHECK, buf.winP2PRecv);
+#endif
+  }
+  else {
+    if (buf.bufD_P2PRecv != NULL) delete [] buf.bufD_P2PRecv;
+    buf.bufD_P2PRecv = new su2double[buf.countPerPoint*nPoint_P2PRecv[nP2PRecv]];
+  }
+  for (iRecv = 0; iRecv < buf.countPerPoint*nPoint_P2PRecv[nP2PRecv]; iRecv++)
+    buf.bufD_P2PRecv[iRecv] = 0.0;
 
-  if (bufS_P2PSend != NULL) delete [] bufS_P2PSend;
+  if (buf.bufS_P2PSend != NULL) delete [] buf.bufS_P2PSend;
 
-  bufS_P2PSend = new unsigned short[countPerPoint*nPoint_P2PSend[nP2PSend]];
-  for (iSend = 0; iSend < countPerPoint*nPoint_P2PSend[nP2PSend]; iSend++)
-    bufS_P2PSend[iSend] = 0;
+  buf.bufS_P2PSend = new unsigned short[buf.countPerPoint*nPoint_P2PSend[nP2PSend]];
+  for (iSend = 0; iSend < buf.countPerPoint*nPoint_P2PSend[nP2PSend]; iSend++)
+    buf.bufS_P2PSend[iSend] = 0;
 
-  if (bufS_P2PRecv != NULL) delete [] bufS_P2PRecv;
+  if (buf.bufS_P2PRecv != NULL) delete [] buf.bufS_P2PRecv;
 
-  bufS_P2PRecv = new unsigned short[countPerPoint*nPoint_P2PRecv[nP2PRecv]];
-  for (iRecv = 0; iRecv < countPerPoint*nPoint_P2PRecv[nP2PRecv]; iRecv++)
-    bufS_P2PRecv[iRecv] = 0;
+  buf.bufS_P2PRecv = new unsigned short[buf.countPerPoint*nPoint_P2PRecv[nP2PRecv]];
+  for (iRecv = 0; iRecv < buf.countPerPoint*nPoint_P2PRecv[nP2PRecv]; iRecv++)
+    buf.bufS_P2PRecv[iRecv] = 0;
 
 }
 
@@ -528,10 +532,44 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
                              unsigned short commType,
                              bool val_reverse) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- Local variables ---*/
 
   int iMessage, iRecv, offset, nPointP2P, count, source, tag;
 
+#ifdef PERSISTENT_P2P_COMMS
+
+  /*--- Start the persistent recvs (created on first use) and expose
+   them through the usual request array for the completion routines. ---*/
+
+  auto& persistentRecv = buf.reqPersistent_P2PRecv[PersistentP2PIndex(commType, val_reverse)];
+  if (persistentRecv.empty()) InitPersistentP2PComms(commType, val_reverse);
+
+  SU2_MPI::Startall(persistentRecv.size(), persistentRecv.data());
+  copy(persistentRecv.begin(), persistentRecv.end(), buf.req_P2PRecv.begin());
+
+  if (buf.sharedP2P && (commType == COMM_TYPE_DOUBLE) && !val_reverse) {
+
+    /*--- Tell the node-local sources that our recv buffer can be written,
+     the reads of the previous comms must be visible to them first. ---*/
+
+    SU2_MPI::Win_sync(buf.winP2PRecv);
+    for (auto& request : buf.reqShared_P2PReady) {
+      if (request == MPI_REQUEST_NULL) continue;
+      SU2_MPI::Wait(&request, MPI_STATUS_IGNORE);
+      SU2_MPI::Startall(1, &request);
+    }
+
+    /*--- Get ready for the same signal from the node-local destinations. ---*/
+
+    for (auto& request : buf.reqShared_P2PWait)
+      if (request != MPI_REQUEST_NULL) SU2_MPI::Startall(1, &request);
+  }
+  return;
+
+#endif
+
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
@@ -548,7 +586,7 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
       /*--- Compute our location in the buffer using the send data
        structure since we are reversing the comms. ---*/
 
-      offset = countPerPoint*nPoint_P2PSend[iRecv];
+      offset = buf.countPerPoint*nPoint_P2PSend[iRecv];
 
       /*--- Take advantage of cumulative storage format to get the number
        of elems that we need to recv. Note again that we select the send
@@ -558,7 +596,7 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
 
       /*--- Total count can include multiple pieces of data per element. ---*/
 
-      count = countPerPoint*nPointP2P;
+      count = buf.countPerPoint*nPointP2P;
 
       /*--- Get the rank from which we receive the message. Note again
        that we use the send rank as the source instead of the recv rank. ---*/
@@ -572,12 +610,12 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
 
       switch (commType) {
         case COMM_TYPE_DOUBLE:
-          SU2_MPI::Irecv(&(bufD_P2PSend[offset]), count, MPI_DOUBLE,
-                         source, tag, MPI_COMM_WORLD, &(req_P2PRecv[iMessage]));
+          SU2_MPI::Irecv(&(buf.bufD_P2PSend[offset]), count, MPI_DOUBLE,
+                         source, tag, SU2_MPI::GetComm(), &(buf.req_P2PRecv[iMessage]));
           break;
         case COMM_TYPE_UNSIGNED_SHORT:
-          SU2_MPI::Irecv(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT,
-                         source, tag, MPI_COMM_WORLD, &(req_P2PRecv[iMessage]));
+          SU2_MPI::Irecv(&(buf.bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT,
+                         source, tag, SU2_MPI::GetComm(), &(buf.req_P2PRecv[iMessage]));
           break;
         default:
           SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.",
@@ -589,7 +627,7 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
 
       /*--- Compute our location in the recv buffer. ---*/
 
-      offset = countPerPoint*nPoint_P2PRecv[iRecv];
+      offset = buf.countPerPoint*nPoint_P2PRecv[iRecv];
 
       /*--- Take advantage of cumulative storage format to get the number
        of elems that we need to recv. ---*/
@@ -598,7 +636,7 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
 
       /*--- Total count can include multiple pieces of data per element. ---*/
 
-      count = countPerPoint*nPointP2P;
+      count = buf.countPerPoint*nPointP2P;
 
       /*--- Get the rank from which we receive the message. ---*/
 
@@ -609,12 +647,12 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
 
       switch (commType) {
         case COMM_TYPE_DOUBLE:
-          SU2_MPI::Irecv(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE,
-                         source, tag, MPI_COMM_WORLD, &(req_P2PRecv[iMessage]));
+          SU2_MPI::Irecv(&(buf.bufD_P2PRecv[offset]), count, MPI_DOUBLE,
+                         source, tag, SU2_MPI::GetComm(), &(buf.req_P2PRecv[iMessage]));
           break;
         case COMM_TYPE_UNSIGNED_SHORT:
-          SU2_MPI::Irecv(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT,
-                         source, tag, MPI_COMM_WORLD, &(req_P2PRecv[iMessage]));
+          SU2_MPI::Irecv(&(buf.bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT,
+                         source, tag, SU2_MPI::GetComm(), &(buf.req_P2PRecv[iMessage]));
           break;
         default:
           SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.",
@@ -632,12 +670,24 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
 
 }
 
+void CGeometry::SyncSharedP2PRecv(unsigned short commType, bool val_reverse) {
+
+#ifdef PERSISTENT_P2P_COMMS
+  CCommBuffers& buf = GetCommBuffers();
+  if (buf.sharedP2P && (commType == COMM_TYPE_DOUBLE) && !val_reverse)
+    SU2_MPI::Win_sync(buf.winP2PRecv);
+#endif
+
+}
+
 void CGeometry::PostP2PSends(CGeometry *geometry,
                              CConfig *config,
                              unsigned short commType,
                              int val_iSend,
                              bool val_reverse) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- Local variables ---*/
 
   int iMessage, offset, nPointP2P, count, dest, tag;
@@ -646,6 +696,36 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
   iMessage = val_iSend;
 
+#ifdef PERSISTENT_P2P_COMMS
+
+  auto& persistentSend = buf.reqPersistent_P2PSend[PersistentP2PIndex(commType, val_reverse)];
+  if (persistentSend.empty()) InitPersistentP2PComms(commType, val_reverse);
+
+  if (buf.sharedP2P && (commType == COMM_TYPE_DOUBLE) && !val_reverse &&
+      (buf.nodeRank_P2PSend[iMessage] >= 0)) {
+
+    /*--- Node-local destination, copy the message directly into its recv
+     buffer once it is free, the (empty) message then signals the arrival.
+     The syncs pair with the ones of the destination after its reads of the
+     previous comms (PostP2PRecvs) and before the reads of this one. ---*/
+
+    SU2_MPI::Wait(&buf.reqShared_P2PWait[iMessage], MPI_STATUS_IGNORE);
+    SU2_MPI::Win_sync(buf.winP2PRecv);
+
+    offset = buf.countPerPoint*nPoint_P2PSend[iMessage];
+    count  = buf.countPerPoint*(nPoint_P2PSend[iMessage+1] - nPoint_P2PSend[iMessage]);
+    copy_n(&buf.bufD_P2PSend[offset], count,
+           &buf.remoteBuf_P2PSend[iMessage][buf.countPerPoint*buf.remoteOffset_P2PSend[iMessage]]);
+
+    SU2_MPI::Win_sync(buf.winP2PRecv);
+  }
+
+  SU2_MPI::Startall(1, &persistentSend[iMessage]);
+  buf.req_P2PSend[iMessage] = persistentSend[iMessage];
+  return;
+
+#endif
+
   /*--- In some instances related to the adjoint solver, we need
    to reverse the direction of communications such that the normal
    send nodes become the recv nodes and vice-versa. ---*/
@@ -655,7 +735,7 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
     /*--- Compute our location in the buffer using the recv data
      structure since we are reversing the comms. ---*/
 
-    offset = countPerPoint*nPoint_P2PRecv[val_iSend];
+    offset = buf.countPerPoint*nPoint_P2PRecv[val_iSend];
 
     /*--- Take advantage of cumulative storage format to get the number
      of points that we need to send. Note again that we select the recv
@@ -665,7 +745,7 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
     /*--- Total count can include multiple pieces of data per element. ---*/
 
-    count = countPerPoint*nPointP2P;
+    count = buf.countPerPoint*nPointP2P;
 
     /*--- Get the rank to which we send the message. Note again
      that we use the recv rank as the dest instead of the send rank. ---*/
@@ -679,12 +759,12 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
     switch (commType) {
       case COMM_TYPE_DOUBLE:
-        SU2_MPI::Isend(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE,
-                       dest, tag, MPI_COMM_WORLD, &(req_P2PSend[iMessage]));
+        SU2_MPI::Isend(&(buf.bufD_P2PRecv[offset]), count, MPI_DOUBLE,
+                       dest, tag, SU2_MPI::GetComm(), &(buf.req_P2PSend[iMessage]));
         break;
       case COMM_TYPE_UNSIGNED_SHORT:
-        SU2_MPI::Isend(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT,
-                       dest, tag, MPI_COMM_WORLD, &(req_P2PSend[iMessage]));
+        SU2_MPI::Isend(&(buf.bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT,
+                       dest, tag, SU2_MPI::GetComm(), &(buf.req_P2PSend[iMessage]));
         break;
       default:
         SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.",
@@ -696,7 +776,7 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
     /*--- Compute our location in the send buffer. ---*/
 
-    offset = countPerPoint*nPoint_P2PSend[val_iSend];
+    offset = buf.countPerPoint*nPoint_P2PSend[val_iSend];
 
     /*--- Take advantage of cumulative storage format to get the number
      of points that we need to send. ---*/
@@ -705,7 +785,7 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
     /*--- Total count can include multiple pieces of data per element. ---*/
 
-    count = countPerPoint*nPointP2P;
+    count = buf.countPerPoint*nPointP2P;
 
     /*--- Get the rank to which we send the message. ---*/
 
@@ -716,12 +796,12 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
     switch (commType) {
       case COMM_TYPE_DOUBLE:
-        SU2_MPI::Isend(&(bufD_P2PSend[offset]), count, MPI_DOUBLE,
-                       dest, tag, MPI_COMM_WORLD, &(req_P2PSend[iMessage]));
+        SU2_MPI::Isend(&(buf.bufD_P2PSend[offset]), count, MPI_DOUBLE,
+                       dest, tag, SU2_MPI::GetComm(), &(buf.req_P2PSend[iMessage]));
         break;
       case COMM_TYPE_UNSIGNED_SHORT:
-        SU2_MPI::Isend(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT,
-                       dest, tag, MPI_COMM_WORLD, &(req_P2PSend[iMessage]));
+        SU2_MPI::Isend(&(buf.bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT,
+                       dest, tag, SU2_MPI::GetComm(), &(buf.req_P2PSend[iMessage]));
         break;
       default:
         SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.",
@@ -733,10 +813,236 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
 }
 
+void CGeometry::InitPersistentP2PComms(unsigned short commType, bool val_reverse) {
+
+#ifdef PERSISTENT_P2P_COMMS
+
+  CCommBuffers& buf = GetCommBuffers();
+
+
+  SU2_MPI::Datatype type = MPI_DOUBLE;
+  char *bufSend = NULL, *bufRecv = NULL;
+  size_t typeSize = 0;
+
+  switch (commType) {
+    case COMM_TYPE_DOUBLE:
+      type = MPI_DOUBLE;
+      bufSend = reinterpret_cast<char*>(buf.bufD_P2PSend);
+      bufRecv = reinterpret_cast<char*>(buf.bufD_P2PRecv);
+      typeSize = sizeof(su2double);
+      break;
+    case COMM_TYPE_UNSIGNED_SHORT:
+      type = MPI_UNSIGNED_SHORT;
+      bufSend = reinterpret_cast<char*>(buf.bufS_P2PSend);
+      bufRecv = reinterpret_cast<char*>(buf.bufS_P2PRecv);
+      typeSize = sizeof(unsigned short);
+      break;
+    default:
+      SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.",
+                     CURRENT_FUNCTION);
+      break;
+  }
+
+  /*--- Same messages as PostP2PRecvs and PostP2PSends, for reverse comms
+   the roles of the send and recv data structures are swapped. ---*/
+
+  const int *sendStart = val_reverse? nPoint_P2PRecv : nPoint_P2PSend;
+  const int *recvStart = val_reverse? nPoint_P2PSend : nPoint_P2PRecv;
+  const int *sendRank  = val_reverse? Neighbors_P2PRecv : Neighbors_P2PSend;
+  const int *recvRank  = val_reverse? Neighbors_P2PSend : Neighbors_P2PRecv;
+  const int nSend = val_reverse? nP2PRecv : nP2PSend;
+
+  if (val_reverse) swap(bufSend, bufRecv);
+
+  auto& persistentSend = buf.reqPersistent_P2PSend[PersistentP2PIndex(commType, val_reverse)];
+  auto& persistentRecv = buf.reqPersistent_P2PRecv[PersistentP2PIndex(commType, val_reverse)];
+
+  /*--- With shared memory the messages of node-local neighbors are empty,
+   they only signal that the data was copied to the recv buffer. ---*/
+
+  const bool shared = buf.sharedP2P && (commType == COMM_TYPE_DOUBLE) && !val_reverse;
+
+  persistentRecv.resize(nP2PRecv);
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const bool local = shared && (buf.reqShared_P2PReady[iRecv] != MPI_REQUEST_NULL);
+    const int count = local? 0 : buf.countPerPoint*(recvStart[iRecv+1]-recvStart[iRecv]);
+    const int source = recvRank[iRecv];
+    SU2_MPI::Recv_init(&bufRecv[buf.countPerPoint*recvStart[iRecv]*typeSize], count, type,
+                       source, source+1, SU2_MPI::GetComm(), &persistentRecv[iRecv]);
+  }
+
+  persistentSend.resize(nSend);
+  for (int iSend = 0; iSend < nSend; iSend++) {
+    const bool local = shared && (buf.nodeRank_P2PSend[iSend] >= 0);
+    const int count = local? 0 : buf.countPerPoint*(sendStart[iSend+1]-sendStart[iSend]);
+    SU2_MPI::Send_init(&bufSend[buf.countPerPoint*sendStart[iSend]*typeSize], count, type,
+                       sendRank[iSend], rank+1, SU2_MPI::GetComm(), &persistentSend[iSend]);
+  }
+
+  /*--- Location of the recv buffers of the node-local destinations. ---*/
+
+  if (shared) {
+    buf.remoteBuf_P2PSend.assign(nP2PSend, NULL);
+    for (int iSend = 0; iSend < nP2PSend; iSend++)
+      if (buf.nodeRank_P2PSend[iSend] >= 0)
+        SU2_MPI::Win_shared_query(buf.winP2PRecv, buf.nodeRank_P2PSend[iSend], &buf.remoteBuf_P2PSend[iSend]);
+  }
+
+#endif
+
+}
+
+void CGeometry::FreePersistentP2PComms() {
+
+#ifdef PERSISTENT_P2P_COMMS
+
+  CCommBuffers& buf = GetCommBuffers();
+
+  for (auto& requests : buf.reqPersistent_P2PSend) {
+    for (auto& request : requests) SU2_MPI::Request_free(&request);
+    requests.clear();
+  }
+  for (auto& requests : buf.reqPersistent_P2PRecv) {
+    for (auto& request : requests) SU2_MPI::Request_free(&request);
+    requests.clear();
+  }
+#endif
+
+}
+
+void CGeometry::InitSharedP2PComms(CCommBuffers& buf) {
+
+#ifdef PERSISTENT_P2P_COMMS
+
+  if (buf.sharedP2P) return;
+
+  /*--- Ranks on the same node, by their global rank. ---*/
+
+  int nodeSize = 1;
+  SU2_MPI::Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED, rank, &buf.nodeComm);
+  SU2_MPI::Comm_size(buf.nodeComm, &nodeSize);
+
+  vector<int> nodeRanks(nodeSize);
+  SU2_MPI::Allgather(&rank, 1, MPI_INT, nodeRanks.data(), 1, MPI_INT, buf.nodeComm);
+
+  map<int, int> Rank2NodeRank;
+  for (int iRank = 0; iRank < nodeSize; iRank++)
+    Rank2NodeRank[nodeRanks[iRank]] = iRank;
+
+  /*--- Each rank tells its sources where their message goes in its recv buffer. ---*/
+
+  buf.remoteOffset_P2PSend.assign(nP2PSend, 0);
+  vector<SU2_MPI::Request> requests(nP2PSend+nP2PRecv);
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++)
+    SU2_MPI::Irecv(&buf.remoteOffset_P2PSend[iSend], 1, MPI_INT, Neighbors_P2PSend[iSend],
+                   Neighbors_P2PSend[iSend]+1, SU2_MPI::GetComm(), &requests[iSend]);
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++)
+    SU2_MPI::Isend(&nPoint_P2PRecv[iRecv], 1, MPI_INT, Neighbors_P2PRecv[iRecv],
+                   rank+1, SU2_MPI::GetComm(), &requests[nP2PSend+iRecv]);
+
+  SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+  /*--- Persistent (empty) "ready to receive" messages, the tags are
+   offset by the size to keep them apart from the data messages. ---*/
+
+  buf.nodeRank_P2PSend.assign(nP2PSend, -1);
+  buf.reqShared_P2PWait.assign(nP2PSend, MPI_REQUEST_NULL);
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    const int dest = Neighbors_P2PSend[iSend];
+    if (Rank2NodeRank.count(dest) == 0) continue;
+    buf.nodeRank_P2PSend[iSend] = Rank2NodeRank[dest];
+    SU2_MPI::Recv_init(NULL, 0, MPI_DOUBLE, dest, size+dest+1, SU2_MPI::GetComm(), &buf.reqShared_P2PWait[iSend]);
+  }
+
+  buf.reqShared_P2PReady.assign(nP2PRecv, MPI_REQUEST_NULL);
+
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const int source = Neighbors_P2PRecv[iRecv];
+    if (Rank2NodeRank.count(source) == 0) continue;
+    SU2_MPI::Send_init(NULL, 0, MPI_DOUBLE, source, size+rank+1, SU2_MPI::GetComm(), &buf.reqShared_P2PReady[iRecv]);
+  }
+
+  /*--- The recv buffer needs to be reallocated as part of the window. ---*/
+
+  if (buf.countPerPoint > 0) {
+    FreePersistentP2PComms();
+    delete [] buf.bufD_P2PRecv;
+    buf.bufD_P2PRecv = NULL;
+  }
+  const auto count = buf.countPerPoint;
+  buf.countPerPoint = 0;
+  buf.sharedP2P = true;
+  if (count > 0) AllocateP2PComms(count);
+
+#endif
+
+}
+
+CGeometry::CCommBuffers& CGeometry::GetCommBuffers() {
+
+  const auto comm = SU2_MPI::GetComm();
+
+  for (auto buf : commBuffers)
+    if (buf->comm == comm) return *buf;
+
+  /*--- First use of the communicator, the set is registered before setting up the
+   shared memory exchange since that goes through the routines that look it up. ---*/
+
+  auto buf = new CCommBuffers;
+  buf->comm = comm;
+  commBuffers.push_back(buf);
+
+  if (sharedHalo) InitSharedP2PComms(*buf);
+
+  return *buf;
+
+}
+
+void CGeometry::FreeCommBuffers(CCommBuffers& buf) {
+
+#ifdef PERSISTENT_P2P_COMMS
+  for (auto& requests : buf.reqPersistent_P2PSend)
+    for (auto& request : requests) SU2_MPI::Request_free(&request);
+  for (auto& requests : buf.reqPersistent_P2PRecv)
+    for (auto& request : requests) SU2_MPI::Request_free(&request);
+
+  if (buf.sharedP2P) {
+    for (auto& request : buf.reqShared_P2PReady)
+      if (request != MPI_REQUEST_NULL) SU2_MPI::Request_free(&request);
+    for (auto& request : buf.reqShared_P2PWait)
+      if (request != MPI_REQUEST_NULL) SU2_MPI::Request_free(&request);
+    if (buf.countPerPoint > 0) {
+      SU2_MPI::Win_unlock_all(buf.winP2PRecv);
+      SU2_MPI::Win_free(&buf.winP2PRecv);
+    }
+    SU2_MPI::Comm_free(&buf.nodeComm);
+  }
+#endif
+
+  /*--- The shared recv buffer is part of the window. ---*/
+
+  if (!buf.sharedP2P) delete [] buf.bufD_P2PRecv;
+  delete [] buf.bufD_P2PSend;
+
+  delete [] buf.bufS_P2PRecv;
+  delete [] buf.bufS_P2PSend;
+
+  delete [] buf.bufD_PeriodicRecv;
+  delete [] buf.bufD_PeriodicSend;
+
+  delete [] buf.bufS_PeriodicRecv;
+  delete [] buf.bufS_PeriodicSend;
+
+}
+
 void CGeometry::InitiateComms(CGeometry *geometry,
                               CConfig *config,
                               unsigned short commType) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- Local variables ---*/
 
   unsigned short iDim;
@@ -784,14 +1090,14 @@ void CGeometry::InitiateComms(CGeometry *geometry,
    buffer. It will be reallocated whenever we find a larger count
    per point. After the first cycle of comms, this should be inactive. ---*/
 
-  if (COUNT_PER_POINT > geometry->countPerPoint) {
+  if (COUNT_PER_POINT > buf.countPerPoint) {
     geometry->AllocateP2PComms(COUNT_PER_POINT);
   }
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  su2double *bufDSend      = geometry->bufD_P2PSend;
-  unsigned short *bufSSend = geometry->bufS_P2PSend;
+  su2double *bufDSend      = buf.bufD_P2PSend;
+  unsigned short *bufSSend = buf.bufS_P2PSend;
 
   su2double *vector = NULL;
 
@@ -822,7 +1128,7 @@ void CGeometry::InitiateComms(CGeometry *geometry,
 
         /*--- Compute the offset in the recv buffer for this point. ---*/
 
-        buf_offset = (msg_offset + iSend)*countPerPoint;
+        buf_offset = (msg_offset + iSend)*buf.countPerPoint;
 
         switch (commType) {
           case COORDINATES:
@@ -873,6 +1179,8 @@ void CGeometry::CompleteComms(CGeometry *geometry,
                               CConfig *config,
                               unsigned short commType) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- Local variables ---*/
 
   unsigned short iDim;
@@ -883,8 +1191,8 @@ void CGeometry::CompleteComms(CGeometry *geometry,
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  su2double *bufDRecv      = geometry->bufD_P2PRecv;
-  unsigned short *bufSRecv = geometry->bufS_P2PRecv;
+  su2double *bufDRecv      = buf.bufD_P2PRecv;
+  unsigned short *bufSRecv = buf.bufS_P2PRecv;
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. Note that we
@@ -898,7 +1206,11 @@ void CGeometry::CompleteComms(CGeometry *geometry,
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
 
-      SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+      SU2_MPI::Waitany(nP2PRecv, buf.req_P2PRecv.data(), &ind, &status);
+
+      /*--- Data of node-local neighbors arrives through shared memory. ---*/
+
+      SyncSharedP2PRecv((commType == NEIGHBORS)? COMM_TYPE_UNSIGNED_SHORT : COMM_TYPE_DOUBLE, false);
 
       /*--- Once we have recv'd a message, get the source rank. ---*/
 
@@ -924,7 +1236,7 @@ void CGeometry::CompleteComms(CGeometry *geometry,
 
         /*--- Compute the total offset in the recv buffer for this point. ---*/
 
-        buf_offset = (msg_offset + iRecv)*countPerPoint;
+        buf_offset = (msg_offset + iRecv)*buf.countPerPoint;
 
         /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -961,7 +1273,7 @@ void CGeometry::CompleteComms(CGeometry *geometry,
      data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-    SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
+    SU2_MPI::Waitall(nP2PSend, buf.req_P2PSend.data(), MPI_STATUS_IGNORE);
 #endif
 
   }
@@ -971,6 +1283,8 @@ void CGeometry::CompleteComms(CGeometry *geometry,
 void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
                                         CConfig *config) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- We start with the send and receive lists already available in
    the form of stored periodic point-donor pairs. We will loop through
    these markers and establish the neighboring ranks and number of
@@ -1042,7 +1356,7 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
    many periodic points it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nPoint_Send_All[1]), 1, MPI_INT,
-                    &(nPoint_Recv_All[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nPoint_Recv_All[1]), 1, MPI_INT, SU2_MPI::GetComm());
 
   /*--- Check how many messages we will be sending and receiving.
    Here we also put the counters into cumulative storage format to
@@ -1125,20 +1439,10 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
    memory is deallocated and reallocated automatically in the case that
    the previously allocated memory is not sufficient. ---*/
 
-  bufD_PeriodicSend = NULL;
-  bufD_PeriodicRecv = NULL;
-
-  bufS_PeriodicSend = NULL;
-  bufS_PeriodicRecv = NULL;
-
   /*--- Allocate memory for the MPI requests if we need to communicate. ---*/
 
-  if (nPeriodicSend > 0) {
-    req_PeriodicSend   = new SU2_MPI::Request[nPeriodicSend];
-  }
-  if (nPeriodicRecv > 0) {
-    req_PeriodicRecv   = new SU2_MPI::Request[nPeriodicRecv];
-  }
+  buf.req_PeriodicSend.resize(nPeriodicSend);
+  buf.req_PeriodicRecv.resize(nPeriodicRecv);
 
   /*--- Allocate arrays for sending the periodic point index and marker
    index to the recv rank so that it can store the local values. Therefore,
@@ -1227,8 +1531,8 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
     /*--- Post non-blocking recv for this proc. ---*/
 
     SU2_MPI::Irecv(&(static_cast<unsigned long*>(idRecv)[offset]),
-                   count, MPI_UNSIGNED_LONG, source, tag, MPI_COMM_WORLD,
-                   &(req_PeriodicRecv[iMessage]));
+                   count, MPI_UNSIGNED_LONG, source, tag, SU2_MPI::GetComm(),
+                   &(buf.req_PeriodicRecv[iMessage]));
 
     /*--- Increment message counter. ---*/
 
@@ -1258,8 +1562,8 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
     /*--- Post non-blocking send for this proc. ---*/
 
     SU2_MPI::Isend(&(static_cast<unsigned long*>(idSend)[offset]),
-                   count, MPI_UNSIGNED_LONG, dest, tag, MPI_COMM_WORLD,
-                   &(req_PeriodicSend[iMessage]));
+                   count, MPI_UNSIGNED_LONG, dest, tag, SU2_MPI::GetComm(),
+                   &(buf.req_PeriodicSend[iMessage]));
 
     /*--- Increment message counter. ---*/
 
@@ -1269,8 +1573,8 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
 
   /*--- Wait for the non-blocking comms to complete. ---*/
 
-  SU2_MPI::Waitall(nPeriodicSend, req_PeriodicSend, MPI_STATUS_IGNORE);
-  SU2_MPI::Waitall(nPeriodicRecv, req_PeriodicRecv, MPI_STATUS_IGNORE);
+  SU2_MPI::Waitall(nPeriodicSend, buf.req_PeriodicSend.data(), MPI_STATUS_IGNORE);
+  SU2_MPI::Waitall(nPeriodicRecv, buf.req_PeriodicRecv.data(), MPI_STATUS_IGNORE);
 
 #else
 
@@ -1306,6 +1610,8 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
 
 void CGeometry::AllocatePeriodicComms(unsigned short val_countPerPeriodicPoint) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- This routine is activated whenever we attempt to perform
    a periodic MPI communication with our neighbors but the
    memory buffer allocated is not large enough for the packet size.
@@ -1315,40 +1621,45 @@ void CGeometry::AllocatePeriodicComms(unsigned short val_countPerPeriodicPoint)
 
   int iSend, iRecv, nSend, nRecv;
 
+  /*--- The requests do not depend on the packet size, allocate them with the first buffers. ---*/
+
+  buf.req_PeriodicSend.resize(nPeriodicSend);
+  buf.req_PeriodicRecv.resize(nPeriodicRecv);
+
   /*--- Store the larger packet size to the class data. ---*/
 
-  countPerPeriodicPoint = val_countPerPeriodicPoint;
+  buf.countPerPeriodicPoint = val_countPerPeriodicPoint;
 
   /*--- Store the total size of the send/recv arrays for clarity. ---*/
 
-  nSend = countPerPeriodicPoint*nPoint_PeriodicSend[nPeriodicSend];
-  nRecv = countPerPeriodicPoint*nPoint_PeriodicRecv[nPeriodicRecv];
+  nSend = buf.countPerPeriodicPoint*nPoint_PeriodicSend[nPeriodicSend];
+  nRecv = buf.countPerPeriodicPoint*nPoint_PeriodicRecv[nPeriodicRecv];
 
   /*-- Deallocate and reallocate our cummunication memory. ---*/
 
-  if (bufD_PeriodicSend != NULL) delete [] bufD_PeriodicSend;
+  if (buf.bufD_PeriodicSend != NULL) delete [] buf.bufD_PeriodicSend;
 
-  bufD_PeriodicSend = new su2double[nSend];
+  buf.bufD_PeriodicSend = new su2double[nSend];
   for (iSend = 0; iSend < nSend; iSend++)
-    bufD_PeriodicSend[iSend] = 0.0;
+    buf.bufD_PeriodicSend[iSend] = 0.0;
 
-  if (bufD_PeriodicRecv != NULL) delete [] bufD_PeriodicRecv;
+  if (buf.bufD_PeriodicRecv != NULL) delete [] buf.bufD_PeriodicRecv;
 
-  bufD_PeriodicRecv = new su2double[nRecv];
+  buf.bufD_PeriodicRecv = new su2double[nRecv];
   for (iRecv = 0; iRecv < nRecv; iRecv++)
-    bufD_PeriodicRecv[iRecv] = 0.0;
+    buf.bufD_PeriodicRecv[iRecv] = 0.0;
 
-  if (bufS_PeriodicSend != NULL) delete [] bufS_PeriodicSend;
+  if (buf.bufS_PeriodicSend != NULL) delete [] buf.bufS_PeriodicSend;
 
-  bufS_PeriodicSend = new unsigned short[nSend];
+  buf.bufS_PeriodicSend = new unsigned short[nSend];
   for (iSend = 0; iSend < nSend; iSend++)
-    bufS_PeriodicSend[iSend] = 0;
+    buf.bufS_PeriodicSend[iSend] = 0;
 
-  if (bufS_PeriodicRecv != NULL) delete [] bufS_PeriodicRecv;
+  if (buf.bufS_PeriodicRecv != NULL) delete [] buf.bufS_PeriodicRecv;
 
-  bufS_PeriodicRecv = new unsigned short[nRecv];
+  buf.bufS_PeriodicRecv = new unsigned short[nRecv];
   for (iRecv = 0; iRecv < nRecv; iRecv++)
-    bufS_PeriodicRecv[iRecv] = 0;
+    buf.bufS_PeriodicRecv[iRecv] = 0;
 
 }
 
@@ -1356,6 +1667,8 @@ void CGeometry::PostPeriodicRecvs(CGeometry *geometry,
                                   CConfig *config,
                                   unsigned short commType) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- In parallel, communicate the data with non-blocking send/recv. ---*/
 
 #ifdef HAVE_MPI
@@ -1373,7 +1686,7 @@ void CGeometry::PostPeriodicRecvs(CGeometry *geometry,
 
     /*--- Compute our location in the recv buffer. ---*/
 
-    offset = countPerPeriodicPoint*nPoint_PeriodicRecv[iRecv];
+    offset = buf.countPerPeriodicPoint*nPoint_PeriodicRecv[iRecv];
 
     /*--- Take advantage of cumulative storage format to get the number
      of elems that we need to recv. ---*/
@@ -1382,7 +1695,7 @@ void CGeometry::PostPeriodicRecvs(CGeometry *geometry,
 
     /*--- Total count can include multiple pieces of data per element. ---*/
 
-    count = countPerPeriodicPoint*nPointPeriodic;
+    count = buf.countPerPeriodicPoint*nPointPeriodic;
 
     /*--- Get the rank from which we receive the message. ---*/
 
@@ -1393,14 +1706,14 @@ void CGeometry::PostPeriodicRecvs(CGeometry *geometry,
 
     switch (commType) {
       case COMM_TYPE_DOUBLE:
-        SU2_MPI::Irecv(&(static_cast<su2double*>(bufD_PeriodicRecv)[offset]),
-                       count, MPI_DOUBLE, source, tag, MPI_COMM_WORLD,
-                       &(req_PeriodicRecv[iMessage]));
+        SU2_MPI::Irecv(&(static_cast<su2double*>(buf.bufD_PeriodicRecv)[offset]),
+                       count, MPI_DOUBLE, source, tag, SU2_MPI::GetComm(),
+                       &(buf.req_PeriodicRecv[iMessage]));
         break;
       case COMM_TYPE_UNSIGNED_SHORT:
-        SU2_MPI::Irecv(&(static_cast<unsigned short*>(bufS_PeriodicRecv)[offset]),
-                       count, MPI_UNSIGNED_SHORT, source, tag, MPI_COMM_WORLD,
-                       &(req_PeriodicRecv[iMessage]));
+        SU2_MPI::Irecv(&(static_cast<unsigned short*>(buf.bufS_PeriodicRecv)[offset]),
+                       count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
+                       &(buf.req_PeriodicRecv[iMessage]));
         break;
       default:
         SU2_MPI::Error("Unrecognized data type for periodic MPI comms.",
@@ -1423,6 +1736,8 @@ void CGeometry::PostPeriodicSends(CGeometry *geometry,
                                   unsigned short commType,
                                   int val_iSend) {
 
+  CCommBuffers& buf = GetCommBuffers();
+
   /*--- In parallel, communicate the data with non-blocking send/recv. ---*/
 
 #ifdef HAVE_MPI
@@ -1437,7 +1752,7 @@ void CGeometry::PostPeriodicSends(CGeometry *geometry,
 
   /*--- Compute our location in the send buffer. ---*/
 
-  offset = countPerPeriodicPoint*nPoint_PeriodicSend[val_iSend];
+  offset = buf.countPerPeriodicPoint*nPoint_PeriodicSend[val_iSend];
 
   /*--- Take advantage of cumulative storage format to get the number
    of points that we need to send. ---*/
@@ -1447,7 +1762,7 @@ void CGeometry::PostPeriodicSends(CGeometry *geometry,
 
   /*--- Total count can include multiple pieces of data per element. ---*/
 
-  count = countPerPeriodicPoint*nPointPeriodic;
+  count = buf.countPerPeriodicPoint*nPointPeriodic;
 
   /*--- Get the rank to which we send the message. ---*/
 
@@ -1458,14 +1773,14 @@ void CGeometry::PostPeriodicSends(CGeometry *geometry,
 
   switch (commType) {
     case COMM_TYPE_DOUBLE:
-      SU2_MPI::Isend(&(static_cast<su2double*>(bufD_PeriodicSend)[offset]),
-                     count, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD,
-                     &(req_PeriodicSend[iMessage]));
+      SU2_MPI::Isend(&(static_cast<su2double*>(buf.bufD_PeriodicSend)[offset]),
+                     count, MPI_DOUBLE, dest, tag, SU2_MPI::GetComm(),
+                     &(buf.req_PeriodicSend[iMessage]));
       break;
     case COMM_TYPE_UNSIGNED_SHORT:
-      SU2_MPI::Isend(&(static_cast<unsigned short*>(bufS_PeriodicSend)[offset]),
-                     count, MPI_UNSIGNED_SHORT, dest, tag, MPI_COMM_WORLD,
-                     &(req_PeriodicSend[iMessage]));
+      SU2_MPI::Isend(&(static_cast<unsigned short*>(buf.bufS_PeriodicSend)[offset]),
+                     count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
+                     &(buf.req_PeriodicSend[iMessage]));
       break;
     default:
       SU2_MPI::Error("Unrecognized data type for periodic MPI comms.",
@@ -1479,16 +1794,16 @@ void CGeometry::PostPeriodicSends(CGeometry *geometry,
 
   int iSend, myStart, myFinal, iRecv, iRank;
   iRank   = geometry->PeriodicRecv2Neighbor[rank];
-  iRecv   = geometry->nPoint_PeriodicRecv[iRank]*countPerPeriodicPoint;
-  myStart = nPoint_PeriodicSend[val_iSend]*countPerPeriodicPoint;
-  myFinal = nPoint_PeriodicSend[val_iSend+1]*countPerPeriodicPoint;
+  iRecv   = geometry->nPoint_PeriodicRecv[iRank]*buf.countPerPeriodicPoint;
+  myStart = nPoint_PeriodicSend[val_iSend]*buf.countPerPeriodicPoint;
+  myFinal = nPoint_PeriodicSend[val_iSend+1]*buf.countPerPeriodicPoint;
   for (iSend = myStart; iSend < myFinal; iSend++) {
     switch (commType) {
       case COMM_TYPE_DOUBLE:
-        bufD_PeriodicRecv[iRecv] =  bufD_PeriodicSend[iSend];
+        buf.bufD_PeriodicRecv[iRecv] =  buf.bufD_PeriodicSend[iSend];
         break;
       case COMM_TYPE_UNSIGNED_SHORT:
-        bufS_PeriodicRecv[iRecv] =  bufS_PeriodicSend[iSend];
+        buf.bufS_PeriodicRecv[iRecv] =  buf.bufS_PeriodicSend[iSend];
         break;
       default:
         SU2_MPI::Error("Unrecognized data type for periodic MPI comms.",
@@ -2159,8 +2474,8 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
 
   Buffer_Send_nEdge[0] = nLocalEdge;
 
-  SU2_MPI::Allreduce(&nLocalEdge, &MaxLocalEdge, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_nEdge, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nEdge, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nLocalEdge, &MaxLocalEdge, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(Buffer_Send_nEdge, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nEdge, 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
   Buffer_Send_Coord    = new su2double [MaxLocalEdge*6];
   Buffer_Receive_Coord = new su2double [nProcessor*MaxLocalEdge*6];
@@ -2192,9 +2507,9 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
     Buffer_Send_GlobalID[iEdge*4 + 3] = JGlobalID_Index1[iEdge];
   }
 
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_Variable, nBuffer_Variable, MPI_DOUBLE, Buffer_Receive_Variable, nBuffer_Variable, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(Buffer_Send_Variable, nBuffer_Variable, MPI_DOUBLE, Buffer_Receive_Variable, nBuffer_Variable, MPI_DOUBLE, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(Buffer_Send_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
   /*--- Clean the vectors before adding the new vertices only to the master node ---*/
 
@@ -2684,6 +2999,37 @@ void CGeometry::RegisterOutput_Coordinates(CConfig *config){
   }
 }
 
+void CGeometry::SetEdgeHalfVectors(void) {
+
+  if (edge == nullptr) return;
+
+  edgeHalfVectors.resize(nEdge, nDim);
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
+    const su2double* coord_i = node[edge[iEdge]->GetNode(0)]->GetCoord();
+    const su2double* coord_j = node[edge[iEdge]->GetNode(1)]->GetCoord();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      edgeHalfVectors(iEdge,iDim) = 0.5*(coord_j[iDim] - coord_i[iDim]);
+  }
+}
+
+void CGeometry::SetTurboComm(CConfig *config, unsigned short marker_flag) {
+
+  if (turboCommSplit[marker_flag-1]) return;
+
+  /*--- Ranks that have a turbo marker of this kind (even if only with halo vertices)
+   *    take part in the span wise averages, the others are excluded from the reductions. ---*/
+
+  int hasMarker = 0;
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_Turbomachinery(iMarker) != 0) &&
+        (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag)) hasMarker = 1;
+  }
+
+  SU2_MPI::Comm_split(SU2_MPI::GetComm(), hasMarker, SU2_MPI::GetRank(), &turboComm[marker_flag-1]);
+  turboCommSplit[marker_flag-1] = true;
+}
+
 void CGeometry::UpdateGeometry(CGeometry **geometry_container, CConfig *config) {
 
   unsigned short iMesh;
@@ -2902,7 +3248,7 @@ void CGeometry::ComputeSurf_Straightness(CConfig *config,
 
     /*--- Product of type <int>(bool) is equivalnt to a 'logical and' ---*/
     SU2_MPI::Allreduce(Buff_Send_isStraight.data(), Buff_Recv_isStraight.data(),
-                       nMarker_Global, MPI_INT, MPI_PROD, MPI_COMM_WORLD);
+                       nMarker_Global, MPI_INT, MPI_PROD, SU2_MPI::GetComm());
 
     /*--- Print results on screen. ---*/
     if(rank == MASTER_NODE) {
@@ -3172,9 +3518,9 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   su2double MyMeanK = MeanK; MeanK = 0.0;
   su2double MyMaxK = MaxK; MaxK = 0.0;
   unsigned long MynPointDomain = TotalnPointDomain; TotalnPointDomain = 0;
-  SU2_MPI::Allreduce(&MyMeanK, &MeanK, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyMaxK, &MaxK, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MynPointDomain, &TotalnPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyMeanK, &MeanK, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&MyMaxK, &MaxK, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&MynPointDomain, &TotalnPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 #endif
 
   /*--- Compute the mean ---*/
@@ -3195,7 +3541,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
 
 #ifdef HAVE_MPI
   su2double MySigmaK = SigmaK; SigmaK = 0.0;
-  SU2_MPI::Allreduce(&MySigmaK, &SigmaK, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MySigmaK, &SigmaK, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 #endif
 
   SigmaK = sqrt(SigmaK/su2double(TotalnPointDomain));
@@ -3221,7 +3567,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   /*--- Variables and buffers needed for MPI ---*/
 
 #ifdef HAVE_MPI
-  SU2_MPI::Comm_size(MPI_COMM_WORLD, &nProcessor);
+  SU2_MPI::Comm_size(SU2_MPI::GetComm(), &nProcessor);
 #else
   nProcessor = 1;
 #endif
@@ -3238,8 +3584,8 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
 
 #ifdef HAVE_MPI
   MaxLocalVertex = 0;
-  SU2_MPI::Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 #else
   MaxLocalVertex = nLocalVertex;
   Buffer_Receive_nVertex[0] = nLocalVertex;
@@ -3272,7 +3618,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   }
 
 #ifdef HAVE_MPI
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer, MPI_DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer, MPI_DOUBLE, SU2_MPI::GetComm());
 #else
   for (iVertex = 0; iVertex < Point_Critical.size(); iVertex++) {
     for (iDim = 0; iDim < nDim; iDim++) {
@@ -3392,15 +3738,15 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
   SU2_OMP_MASTER
   {
     su2double* dbl_buffer = new su2double [Global_nElemDomain*nDim];
-    SU2_MPI::Allreduce(cg_elem,dbl_buffer,Global_nElemDomain*nDim,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(cg_elem,dbl_buffer,Global_nElemDomain*nDim,MPI_DOUBLE,MPI_SUM,SU2_MPI::GetComm());
     swap(dbl_buffer, cg_elem); delete [] dbl_buffer;
 
     dbl_buffer = new su2double [Global_nElemDomain];
-    SU2_MPI::Allreduce(vol_elem,dbl_buffer,Global_nElemDomain,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(vol_elem,dbl_buffer,Global_nElemDomain,MPI_DOUBLE,MPI_SUM,SU2_MPI::GetComm());
     swap(dbl_buffer, vol_elem); delete [] dbl_buffer;
 
     vector<char> char_buffer(Global_nElemDomain);
-    MPI_Allreduce(halo_detect.data(),char_buffer.data(),Global_nElemDomain,MPI_CHAR,MPI_SUM,MPI_COMM_WORLD);
+    MPI_Allreduce(halo_detect.data(),char_buffer.data(),Global_nElemDomain,MPI_CHAR,MPI_SUM,SU2_MPI::GetComm());
     halo_detect.swap(char_buffer);
   }
   SU2_OMP_BARRIER
@@ -3442,7 +3788,7 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
     SU2_OMP_MASTER
     {
       su2double *buffer = new su2double [Global_nElemDomain];
-      SU2_MPI::Allreduce(work_values,buffer,Global_nElemDomain,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(work_values,buffer,Global_nElemDomain,MPI_DOUBLE,MPI_SUM,SU2_MPI::GetComm());
       swap(buffer, work_values); delete [] buffer;
     }
     SU2_OMP_BARRIER
@@ -3523,7 +3869,7 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> &filter_radius,
   limited_searches /= kernels.size();
 
   unsigned long tmp = limited_searches;
-  SU2_MPI::Reduce(&tmp,&limited_searches,1,MPI_UNSIGNED_LONG,MPI_SUM,MASTER_NODE,MPI_COMM_WORLD);
+  SU2_MPI::Reduce(&tmp,&limited_searches,1,MPI_UNSIGNED_LONG,MPI_SUM,MASTER_NODE,SU2_MPI::GetComm());
 
   if (rank==MASTER_NODE && limited_searches>0)
     cout << "Warning: The filter radius was limited for " << limited_searches
@@ -3561,7 +3907,7 @@ void CGeometry::GetGlobalElementAdjacencyMatrix(vector<unsigned long> &neighbour
   /*--- Share with all processors ---*/
   {
     unsigned short *buffer = new unsigned short [Global_nElemDomain];
-    MPI_Allreduce(nFaces_elem,buffer,Global_nElemDomain,MPI_UNSIGNED_SHORT,MPI_MAX,MPI_COMM_WORLD);
+    MPI_Allreduce(nFaces_elem,buffer,Global_nElemDomain,MPI_UNSIGNED_SHORT,MPI_MAX,SU2_MPI::GetComm());
     /*--- swap pointers and delete old data to keep the same variable name after reduction ---*/
     swap(buffer, nFaces_elem); delete [] buffer;
   }
@@ -3608,7 +3954,7 @@ void CGeometry::GetGlobalElementAdjacencyMatrix(vector<unsigned long> &neighbour
   /*--- Share with all processors ---*/
   {
     long *buffer = new long [matrix_size];
-    MPI_Allreduce(neighbour_idx,buffer,matrix_size,MPI_LONG,MPI_MAX,MPI_COMM_WORLD);
+    MPI_Allreduce(neighbour_idx,buffer,matrix_size,MPI_LONG,MPI_MAX,SU2_MPI::GetComm());
     swap(buffer, neighbour_idx); delete [] buffer;
   }
 #endif
@@ -4010,22 +4356,29 @@ void CGeometry::SetGridVelocity(CConfig *config, unsigned long iter) {
 
 }
 
-const CCompressedSparsePatternUL& CGeometry::GetSparsePattern(ConnectivityType type, unsigned long fillLvl)
+const CCompressedSparsePatternUL& CGeometry::GetSparsePattern(ConnectivityType type, unsigned long fillLvl,
+                                                              const void* user)
 {
   bool fvm = (type == ConnectivityType::FiniteVolume);
 
   CCompressedSparsePatternUL* pattern = nullptr;
 
+  /*--- Each level of fill has its own pattern, the map creates it on first access. ---*/
+
   if (fillLvl == 0)
     pattern = fvm? &finiteVolumeCSRFill0 : &finiteElementCSRFill0;
   else
-    pattern = fvm? &finiteVolumeCSRFillN : &finiteElementCSRFillN;
+    pattern = fvm? &finiteVolumeCSRFillN[fillLvl] : &finiteElementCSRFillN[fillLvl];
 
   if (pattern->empty()) {
     *pattern = buildCSRPattern(*this, type, fillLvl);
-    pattern->buildDiagPtr();
   }
 
+  /*--- The 0-fill FVM pattern may have been built for the edge map, without diagonal. ---*/
+  pattern->buildDiagPtr();
+
+  if ((fillLvl > 0) && (user != nullptr)) sparsePatternUsers[pattern].insert(user);
+
   return *pattern;
 }
 
@@ -4037,9 +4390,43 @@ const CEdgeToNonZeroMapUL& CGeometry::GetEdgeToSparsePatternMap(void)
     }
     edgeToCSRMap = mapEdgesToSparsePattern(*this, finiteVolumeCSRFill0);
   }
+
   return edgeToCSRMap;
 }
 
+unsigned long CGeometry::GetSparsePatternMemorySaved(void) const
+{
+  /*--- Number of additional copies that sharing avoided for a given pattern. ---*/
+  auto extraCopies = [this](const void* ptr) -> unsigned long {
+    auto it = sparsePatternUsers.find(ptr);
+    if (it == sparsePatternUsers.end()) return 0;
+    return it->second.size()-1;
+  };
+
+  unsigned long saved = 0;
+
+  for (const auto& pattern : finiteVolumeCSRFillN)
+    saved += extraCopies(&pattern.second) * pattern.second.getMemorySize();
+  for (const auto& pattern : finiteElementCSRFillN)
+    saved += extraCopies(&pattern.second) * pattern.second.getMemorySize();
+
+  return saved;
+}
+
+void CGeometry::ReportLoadImbalance(CConfig *config) const
+{
+  su2double localTime = workTime, totalTime = 0.0, maxTime = 0.0;
+  SU2_MPI::Allreduce(&localTime, &totalTime, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&localTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  if ((rank != MASTER_NODE) || (totalTime == 0.0)) return;
+
+  const passivedouble meanTime = SU2_TYPE::GetValue(totalTime)/size;
+  cout << "Measured load imbalance of the spatial integration (max/mean-1): " << setprecision(3)
+       << 100.0*(SU2_TYPE::GetValue(maxTime)/meanTime - 1.0) << "% (max " << SU2_TYPE::GetValue(maxTime)
+       << " s, mean " << meanTime << " s per rank)." << endl;
+}
+
 const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(void)
 {
   if (edgeColoring.empty()) {
@@ -0,0 +1,369 @@
+/*!
+ * \file CGeometryCache.cpp
+ * \brief Implementation of the class that stores preprocessed geometry data between runs.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/geometry/CGeometryCache.hpp"
+#include "../../include/geometry/CPhysicalGeometry.hpp"
+
+/*--- Version of the file layout, part of the key so that old files are ignored. ---*/
+static const unsigned long CACHE_FORMAT_VERSION = 1;
+
+/*--- Helpers to read/write a size followed by that many values. The size is
+ checked against the rest of the file, a truncated or corrupt file is a miss. ---*/
+
+template<class T>
+static bool ReadVector(FILE *fhw, long fileSize, vector<T>& vec) {
+  unsigned long nValues = 0;
+  if (fread(&nValues, sizeof(unsigned long), 1, fhw) != 1) return false;
+  const long pos = ftell(fhw);
+  if ((pos < 0) || (pos > fileSize) || (nValues > static_cast<unsigned long>(fileSize-pos)/sizeof(T))) return false;
+  vec.resize(nValues);
+  return (fread(vec.data(), sizeof(T), nValues, fhw) == nValues);
+}
+
+template<class T>
+static void WriteVector(FILE *fhw, const vector<T>& vec) {
+  const unsigned long nValues = vec.size();
+  fwrite(&nValues, sizeof(unsigned long), 1, fhw);
+  fwrite(vec.data(), sizeof(T), nValues, fhw);
+}
+
+CGeometryCache::CGeometryCache(const CGeometry *geometry, CConfig *config) {
+
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+  loaded = false;
+
+  /*--- Each rank has its own file, for each zone. ---*/
+
+  stringstream name;
+  name << config->GetGeometry_Cache_FileName() << "_" << config->GetiZone() << "_" << rank << ".dat";
+  fileName = name.str();
+
+  /*--- Offset basis of the FNV-1a hash. ---*/
+
+  key = 14695981039346656037ULL;
+
+  /*--- Options that change the result of the preprocessing. ---*/
+
+  unsigned long options[] = {CACHE_FORMAT_VERSION, static_cast<unsigned long>(size),
+                             config->GetKind_Solver(), config->GetnMGLevels(),
+                             config->GetReorientElements(), config->GetnMarker_CfgFile(),
+                             config->GetKind_Partition_Weights()};
+  HashData(options, sizeof(options));
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_CfgFile(); iMarker++) {
+    const string tag = config->GetMarker_CfgFile_TagBound(iMarker);
+    const unsigned long kindBC = config->GetMarker_CfgFile_KindBC(tag);
+    HashData(tag.data(), tag.size());
+    HashData(&kindBC, sizeof(unsigned long));
+  }
+
+  /*--- The vertex weights of the partitioning, the cost model depends on the wall
+   treatment of the markers. ---*/
+
+  if (config->GetKind_Partition_Weights() == COST_MODEL_WEIGHTS) {
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_CfgFile(); iMarker++) {
+      const passivedouble cost = CPhysicalGeometry::VertexCost(config, config->GetMarker_CfgFile_TagBound(iMarker));
+      HashData(&cost, sizeof(passivedouble));
+    }
+  }
+
+  /*--- The mesh as seen by this rank in the linear partition. ---*/
+
+  unsigned long sizes[] = {geometry->GetnDim(), geometry->GetGlobal_nPointDomain(),
+                           geometry->GetnPoint(), geometry->GetnElem()};
+  HashData(sizes, sizeof(sizes));
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    const unsigned long globalIndex = geometry->node[iPoint]->GetGlobalIndex();
+    HashData(&globalIndex, sizeof(unsigned long));
+    for (unsigned short iDim = 0; iDim < geometry->GetnDim(); iDim++) {
+      const passivedouble coord = SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim));
+      HashData(&coord, sizeof(passivedouble));
+    }
+  }
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    const unsigned long vtkType = geometry->elem[iElem]->GetVTK_Type();
+    HashData(&vtkType, sizeof(unsigned long));
+    for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++) {
+      const unsigned long node = geometry->elem[iElem]->GetNode(iNode);
+      HashData(&node, sizeof(unsigned long));
+    }
+  }
+
+  /*--- The cache is only used if it is valid on every rank, otherwise
+   the collective steps (partitioning, agglomeration) would diverge. ---*/
+
+  unsigned short localLoaded = ReadFile(geometry->GetnPoint()), globalLoaded = localLoaded;
+
+  SU2_MPI::Allreduce(&localLoaded, &globalLoaded, 1, MPI_UNSIGNED_SHORT, MPI_MIN, SU2_MPI::GetComm());
+
+  loaded = (globalLoaded != 0);
+
+  if (!loaded) {
+    coloring.clear();
+    agglomeration.clear();
+    wallDistance.clear();
+  }
+
+  if (rank == MASTER_NODE) {
+    if (loaded) cout << "Using the preprocessed geometry cache (" << config->GetGeometry_Cache_FileName() << ")." << endl;
+    else cout << "The preprocessed geometry cache is not available, it will be created." << endl;
+  }
+
+}
+
+void CGeometryCache::HashData(const void *data, size_t nBytes) {
+
+  const unsigned char *bytes = static_cast<const unsigned char*>(data);
+
+  for (size_t i = 0; i < nBytes; i++) {
+    key ^= bytes[i];
+    key *= 1099511628211ULL;
+  }
+
+}
+
+bool CGeometryCache::ReadFile(unsigned long nPointLinear) {
+
+  FILE *fhw = fopen(fileName.c_str(), "rb");
+
+  if (fhw == NULL) return false;
+
+  bool success = (fseek(fhw, 0, SEEK_END) == 0);
+  const long fileSize = ftell(fhw);
+  success = success && (fileSize >= 0) && (fseek(fhw, 0, SEEK_SET) == 0);
+
+  unsigned long long fileKey = 0;
+  unsigned long nLevels = 0;
+
+  success = success && (fread(&fileKey, sizeof(unsigned long long), 1, fhw) == 1) && (fileKey == key);
+  success = success && ReadVector(fhw, fileSize, coloring);
+  success = success && (fread(&nLevels, sizeof(unsigned long), 1, fhw) == 1);
+
+  /*--- Each level takes at least the space of its size. ---*/
+
+  success = success && (nLevels <= static_cast<unsigned long>(fileSize)/sizeof(unsigned long));
+
+  if (success) {
+    agglomeration.resize(nLevels);
+    for (auto& level : agglomeration) success = success && ReadVector(fhw, fileSize, level);
+  }
+  success = success && ReadVector(fhw, fileSize, wallDistance);
+
+  /*--- Nothing may follow the data. ---*/
+
+  success = success && (fgetc(fhw) == EOF);
+
+  fclose(fhw);
+
+  /*--- The sizes must match the mesh, any other file is treated as a miss. ---*/
+
+  success = success && (coloring.size() == nPointLinear) && CheckAgglomeration();
+
+  if (success && !agglomeration.empty() && !wallDistance.empty())
+    success = (wallDistance.size() == agglomeration[0][0]);
+
+  return success;
+
+}
+
+void CGeometryCache::WriteFile(void) const {
+
+  FILE *fhw = fopen(fileName.c_str(), "wb");
+
+  if (fhw == NULL) {
+    SU2_MPI::Error(string("Unable to write the preprocessed geometry cache ") + fileName, CURRENT_FUNCTION);
+  }
+
+  const unsigned long nLevels = agglomeration.size();
+
+  fwrite(&key, sizeof(unsigned long long), 1, fhw);
+  WriteVector(fhw, coloring);
+  fwrite(&nLevels, sizeof(unsigned long), 1, fhw);
+  for (const auto& level : agglomeration) WriteVector(fhw, level);
+  WriteVector(fhw, wallDistance);
+
+  fclose(fhw);
+
+  if (rank == MASTER_NODE)
+    cout << "Preprocessed geometry cache written (" << fileName << " on the master rank)." << endl;
+
+}
+
+bool CGeometryCache::GetColoring(CGeometry *geometry) const {
+
+  if (!loaded || (coloring.size() != geometry->GetnPoint())) return false;
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    geometry->node[iPoint]->SetColor(coloring[iPoint]);
+
+  return true;
+
+}
+
+void CGeometryCache::SetColoring(const CGeometry *geometry) {
+
+  coloring.resize(geometry->GetnPoint());
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    coloring[iPoint] = geometry->node[iPoint]->GetColor();
+
+}
+
+/*--- The agglomeration of each level is stored in a flat vector with the layout:
+ [nPoint fine, nPoint coarse, nPointDomain coarse,
+  (parent, agglomerate flag) for each fine point,
+  (domain flag, indirect flag, nChildren, children...) for each coarse point]. ---*/
+
+bool CGeometryCache::CheckAgglomeration(void) const {
+
+  for (unsigned long iLevel = 0; iLevel < agglomeration.size(); iLevel++) {
+
+    const vector<unsigned long>& level = agglomeration[iLevel];
+
+    if (level.size() < 3) return false;
+
+    const unsigned long nPointFine = level[0], nPointCoarse = level[1], nPointDomainCoarse = level[2];
+
+    /*--- The fine grid of a level is the coarse grid of the previous one. ---*/
+
+    if ((iLevel > 0) && (nPointFine != agglomeration[iLevel-1][1])) return false;
+
+    if ((nPointFine > level.size()/2) || (nPointCoarse > nPointFine) || (nPointDomainCoarse > nPointCoarse) ||
+        (level.size() < 3 + 2*nPointFine + 3*nPointCoarse)) return false;
+
+    unsigned long pos = 3;
+
+    for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++, pos += 2)
+      if (level[pos] >= nPointCoarse) return false;
+
+    for (unsigned long iCoarse = 0; iCoarse < nPointCoarse; iCoarse++) {
+      pos += 2;
+      const unsigned long nChildren = level[pos++];
+      if (nChildren > level.size() - pos) return false;
+      for (unsigned long iChildren = 0; iChildren < nChildren; iChildren++)
+        if (level[pos++] >= nPointFine) return false;
+    }
+
+    if (pos != level.size()) return false;
+  }
+
+  return true;
+
+}
+
+bool CGeometryCache::GetAgglomeration(unsigned short iMesh, CGeometry *fine_grid, CGeometry *coarse_grid) const {
+
+  if (!loaded || (iMesh > agglomeration.size())) return false;
+
+  const vector<unsigned long>& level = agglomeration[iMesh-1];
+
+  /*--- The fine grid is identical if the key matched, anything else is a corrupt file. ---*/
+
+  if (level.empty() || (level[0] != fine_grid->GetnPoint())) {
+    SU2_MPI::Error(string("The multigrid data of the preprocessed geometry cache ") + fileName +
+                   string(" does not match the mesh, delete the file and run again."), CURRENT_FUNCTION);
+  }
+
+  unsigned long pos = 1;
+  const unsigned long nPointCoarse = level[pos++];
+  const unsigned long nPointDomainCoarse = level[pos++];
+
+  for (unsigned long iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++) {
+    const unsigned long parent = level[pos++];
+    if (level[pos++]) fine_grid->node[iPoint]->SetParent_CV(parent);
+  }
+
+  vector<unsigned long> outerPtr(1, 0), innerIdx;
+
+  for (unsigned long iCoarse = 0; iCoarse < nPointCoarse; iCoarse++) {
+    coarse_grid->node[iCoarse]->SetDomain(level[pos++] != 0);
+    coarse_grid->node[iCoarse]->SetAgglomerate_Indirect(level[pos++] != 0);
+
+    const unsigned long nChildren = level[pos++];
+    innerIdx.insert(innerIdx.end(), level.begin()+pos, level.begin()+pos+nChildren);
+    outerPtr.push_back(innerIdx.size());
+    pos += nChildren;
+  }
+
+  coarse_grid->SetnPoint(nPointCoarse);
+  coarse_grid->SetnPointDomain(nPointDomainCoarse);
+  coarse_grid->SetChildrenCV(CCompressedSparsePatternUL(outerPtr, innerIdx));
+
+  return true;
+
+}
+
+void CGeometryCache::SetAgglomeration(unsigned short iMesh, const CGeometry *fine_grid, const CGeometry *coarse_grid) {
+
+  if (agglomeration.size() < iMesh) agglomeration.resize(iMesh);
+
+  vector<unsigned long>& level = agglomeration[iMesh-1];
+  level.clear();
+
+  level.push_back(fine_grid->GetnPoint());
+  level.push_back(coarse_grid->GetnPoint());
+  level.push_back(coarse_grid->GetnPointDomain());
+
+  for (unsigned long iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++) {
+    level.push_back(fine_grid->node[iPoint]->GetParent_CV());
+    level.push_back(fine_grid->node[iPoint]->GetAgglomerate());
+  }
+
+  const auto& children = coarse_grid->GetChildrenCV();
+
+  for (unsigned long iCoarse = 0; iCoarse < coarse_grid->GetnPoint(); iCoarse++) {
+    const CPoint *point = coarse_grid->node[iCoarse];
+    level.push_back(point->GetDomain());
+    level.push_back(point->GetAgglomerate_Indirect());
+    level.push_back(children.getNumNonZeros(iCoarse));
+    for (unsigned long iChildren = 0; iChildren < children.getNumNonZeros(iCoarse); iChildren++)
+      level.push_back(children.getInnerIdx(iCoarse, iChildren));
+  }
+
+}
+
+bool CGeometryCache::GetWallDistance(CGeometry *geometry) const {
+
+  if (!loaded || (wallDistance.size() != geometry->GetnPoint())) return false;
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    geometry->node[iPoint]->SetWall_Distance(wallDistance[iPoint]);
+
+  return true;
+
+}
+
+void CGeometryCache::SetWallDistance(const CGeometry *geometry) {
+
+  wallDistance.resize(geometry->GetnPoint());
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    wallDistance[iPoint] = SU2_TYPE::GetValue(geometry->node[iPoint]->GetWall_Distance());
+
+}
@@ -26,11 +26,14 @@
  */
 
 #include "../../include/geometry/CMultiGridGeometry.hpp"
+#include "../../include/geometry/CGeometryCache.hpp"
 #include "../../include/CMultiGridQueue.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/omp_structure.hpp"
 
 
-CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh) : CGeometry() {
+CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh,
+                                       const CGeometryCache *cache) : CGeometry() {
 
   /*--- CGeometry & CConfig pointers to the fine grid level for clarity. We may
    need access to the other zones in the mesh for zone boundaries. ---*/
@@ -40,33 +43,11 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   /*--- Local variables ---*/
 
-  unsigned long iPoint, Index_CoarseCV, CVPoint, iElem, iVertex, jPoint, iteration, nVertexS, nVertexR,
-                nBufferS_Vector, nBufferR_Vector, iParent, jVertex,Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine,
-                *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL,
-                *Parent_Remote = NULL,         *Children_Remote = NULL,    *Parent_Local = NULL,            *Children_Local = NULL;
-  short marker_seed;
-  bool agglomerate_seed = true;
-  unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
-  vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
-  vector<unsigned long>::iterator it;
-
-  unsigned short nMarker_Max = config->GetnMarker_Max();
-
-  unsigned short *copy_marker = new unsigned short [nMarker_Max];
-
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  unsigned long iPoint, iElem, Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;
+  unsigned short iNode;
 
   nDim = fine_grid->GetnDim(); // Write the number of dimensions of the coarse grid.
 
-  /*--- Create a queue system to deo the agglomeration
-   1st) More than two markers ---> Vertices (never agglomerate)
-   2nd) Two markers ---> Edges (agglomerate if same BC, never agglomerate if different BC)
-   3rd) One marker ---> Surface (always agglomarate)
-   4th) No marker ---> Internal Volume (always agglomarate) ---*/
-
   /*--- Set a marker to indicate indirect agglomeration ---*/
 
   if (iMesh == MESH_1) {
@@ -88,8 +69,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   /*--- Create the coarse grid structure using as baseline the fine grid ---*/
 
-  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
-
   nPointNode = fine_grid->GetnPoint();
   node = new CPoint*[fine_grid->GetnPoint()];
   for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
@@ -103,6 +82,101 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
     node[iPoint]->SetAgglomerate_Indirect(false);
   }
 
+  /*--- Agglomerate the fine grid control volumes, unless the agglomeration of an
+   identical previous run is available in the preprocessed geometry cache. ---*/
+
+  if ((cache == NULL) || !cache->GetAgglomeration(iMesh, fine_grid, this))
+    SetAgglomeration(fine_grid, config);
+
+  /*--- Console output with the summary of the agglomeration ---*/
+
+  Local_nPointCoarse = nPoint;
+  Local_nPointFine = fine_grid->GetnPoint();
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+#else
+  Global_nPointCoarse = Local_nPointCoarse;
+  Global_nPointFine = Local_nPointFine;
+#endif
+
+  su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
+
+  if (iMesh != MESH_0) {
+    if (nDim == 2) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./2.);
+    if (nDim == 3) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./3.);
+    CFL = factor*config->GetCFL(iMesh-1)/Coeff;
+    config->SetCFL(iMesh, CFL);
+  }
+
+  su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
+
+  if (((nDim == 2) && (ratio < 2.5)) ||
+      ((nDim == 3) && (ratio < 2.5))) {
+    config->SetMGLevels(iMesh-1);
+  }
+  else {
+    if (rank == MASTER_NODE) {
+      PrintingToolbox::CTablePrinter MGTable(&std::cout);
+      MGTable.AddColumn("MG Level", 10);
+      MGTable.AddColumn("CVs", 10);
+      MGTable.AddColumn("Aggl. Rate", 10);
+      MGTable.AddColumn("CFL", 10);
+      MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+
+
+      if (iMesh == 1){
+        MGTable.PrintHeader();
+        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1);
+      }
+      stringstream ss;
+      ss << "1/" << std::setprecision(3) << ratio;
+      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL;
+      if (iMesh == config->GetnMGLevels()){
+        MGTable.PrintFooter();
+      }
+    }
+  }
+
+}
+
+
+void CMultiGridGeometry::SetAgglomeration(CGeometry *fine_grid, CConfig *config) {
+
+  /*--- Local variables ---*/
+
+  unsigned long iPoint, Index_CoarseCV, CVPoint, iVertex, jPoint, iteration, nVertexS, nVertexR,
+                nBufferS_Vector, nBufferR_Vector, iParent, jVertex,
+                *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL,
+                *Parent_Remote = NULL,         *Children_Remote = NULL,    *Parent_Local = NULL,            *Children_Local = NULL;
+  short marker_seed;
+  bool agglomerate_seed = true;
+  unsigned short iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR;
+  vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
+  vector<unsigned long>::iterator it;
+
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+
+  unsigned short *copy_marker = new unsigned short [nMarker_Max];
+
+#ifdef HAVE_MPI
+  int send_to, receive_from;
+  SU2_MPI::Status status;
+#endif
+
+  /*--- Create a queue system to deo the agglomeration
+   1st) More than two markers ---> Vertices (never agglomerate)
+   2nd) Two markers ---> Edges (agglomerate if same BC, never agglomerate if different BC)
+   3rd) One marker ---> Surface (always agglomarate)
+   4th) No marker ---> Internal Volume (always agglomarate) ---*/
+
+  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
+
+  /*--- Children of each coarse control volume, there are at most as many as fine points. ---*/
+
+  vector<vector<unsigned long> > Children_CV(fine_grid->GetnPoint());
+
   Index_CoarseCV = 0;
 
   /*--- The first step is the boundary agglomeration. ---*/
@@ -119,7 +193,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
           (fine_grid->node[iPoint]->GetDomain()) &&
           (GeometricalCheck(iPoint, fine_grid, config))) {
 
-        nChildren = 1;
 
         /*--- We set an index for the parent control volume ---*/
 
@@ -127,7 +200,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
         /*--- We add the seed point (child) to the parent control volume ---*/
 
-        node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+        Children_CV[Index_CoarseCV].push_back(iPoint);
         agglomerate_seed = true; counter = 0; marker_seed = iMarker;
 
         /*--- For a particular point in the fine grid we save all the markers
@@ -178,8 +251,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
               /*--- We set the value of the child ---*/
 
-              node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-              nChildren++;
+              Children_CV[Index_CoarseCV].push_back(CVPoint);
             }
 
           }
@@ -210,17 +282,13 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
               /*--- We set the value of the child ---*/
 
-              node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-              nChildren++;
+              Children_CV[Index_CoarseCV].push_back(CVPoint);
             }
           }
 
 
         }
 
-        /*--- Update the number of child of the control volume ---*/
-
-        node[Index_CoarseCV]->SetnChildren_CV(nChildren);
         Index_CoarseCV++;
       }
     }
@@ -236,8 +304,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
           (fine_grid->node[iPoint]->GetDomain())) {
         fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
-        node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
-        node[Index_CoarseCV]->SetnChildren_CV(1);
+        Children_CV[Index_CoarseCV].push_back(iPoint);
         Index_CoarseCV++;
       }
     }
@@ -282,7 +349,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
         (fine_grid->node[iPoint]->GetDomain()) &&
         (GeometricalCheck(iPoint, fine_grid, config))) {
 
-      nChildren = 1;
 
       /*--- We set an index for the parent control volume ---*/
 
@@ -290,7 +356,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
       /*--- We add the seed point (child) to the parent control volume ---*/
 
-      node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+      Children_CV[Index_CoarseCV].push_back(iPoint);
 
       /*--- Update the queue with the seed point (remove the seed and
        increase the priority of the neighbors) ---*/
@@ -315,8 +381,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
           /*--- We set the value of the child ---*/
 
-          node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-          nChildren++;
+          Children_CV[Index_CoarseCV].push_back(CVPoint);
 
           /*--- Update the queue with the new control volume (remove the CV and
            increase the priority of the neighbors) ---*/
@@ -355,8 +420,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
           /*--- We set the value of the child ---*/
 
-          node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-          nChildren++;
+          Children_CV[Index_CoarseCV].push_back(CVPoint);
 
           /*--- Update the queue with the new control volume (remove the CV and
            increase the priority of the neighbors) ---*/
@@ -366,9 +430,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
         }
       }
 
-      /*--- Update the number of control of childrens ---*/
-
-      node[Index_CoarseCV]->SetnChildren_CV(nChildren);
       Index_CoarseCV++;
     }
     else {
@@ -386,12 +447,10 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
   for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
     if ((fine_grid->node[iPoint]->GetAgglomerate() == false) && (fine_grid->node[iPoint]->GetDomain())) {
 
-      nChildren = 1;
       fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
       if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
         node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
-      node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
-      node[Index_CoarseCV]->SetnChildren_CV(nChildren);
+      Children_CV[Index_CoarseCV].push_back(iPoint);
       Index_CoarseCV++;
 
     }
@@ -401,14 +460,12 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   /*--- Check that there are no hanging nodes ---*/
 
-  unsigned long iFinePoint, iFinePoint_Neighbor, iCoarsePoint, iCoarsePoint_Complete;
-  unsigned short iChildren;
+  unsigned long iFinePoint_Neighbor, iCoarsePoint, iCoarsePoint_Complete;
 
   /*--- Find the point surrounding a point ---*/
 
   for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
-    for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+    for (auto iFinePoint : Children_CV[iCoarsePoint]) {
       for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
         iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
         iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
@@ -432,19 +489,14 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
        Set the parent CV of iFinePoint. Instead of using the original
        (iCoarsePoint) one use the new one (iCoarsePoint_Complete) ---*/
 
-      nChildren = node[iCoarsePoint_Complete]->GetnChildren_CV();
-
-      for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
-        node[iCoarsePoint_Complete]->SetChildren_CV(nChildren, iFinePoint);
-        nChildren++;
+      for (auto iFinePoint : Children_CV[iCoarsePoint]) {
+        Children_CV[iCoarsePoint_Complete].push_back(iFinePoint);
         fine_grid->node[iFinePoint]->SetParent_CV(iCoarsePoint_Complete);
       }
 
-      /*--- Update the number of children control volumes ---*/
+      /*--- The isolated point has no children left ---*/
 
-      node[iCoarsePoint_Complete]->SetnChildren_CV(nChildren);
-      node[iCoarsePoint]->SetnChildren_CV(0);
+      Children_CV[iCoarsePoint].clear();
 
     }
   }
@@ -525,9 +577,9 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 #ifdef HAVE_MPI
       /*--- Send/Receive information using Sendrecv ---*/
       SU2_MPI::Sendrecv(Buffer_Send_Children, nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,0,
-                   Buffer_Receive_Children, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,0, MPI_COMM_WORLD, &status);
+                   Buffer_Receive_Children, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,0, SU2_MPI::GetComm(), &status);
       SU2_MPI::Sendrecv(Buffer_Send_Parent, nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,1,
-                   Buffer_Receive_Parent, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,1, MPI_COMM_WORLD, &status);
+                   Buffer_Receive_Parent, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,1, SU2_MPI::GetComm(), &status);
 #else
       /*--- Receive information without MPI ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
@@ -580,10 +632,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
       Index_CoarseCV += Aux_Parent.size();
 
-      nChildren_MPI = new unsigned short [Index_CoarseCV];
-      for (iParent = 0; iParent < Index_CoarseCV; iParent++)
-        nChildren_MPI[iParent] = 0;
-
       /*--- Create the final structure ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
 
@@ -591,16 +639,13 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
          is always, when receive the information ---*/
 
         fine_grid->node[Children_Local[iVertex]]->SetParent_CV(Parent_Local[iVertex]);
-        node[Parent_Local[iVertex]]->SetChildren_CV(nChildren_MPI[Parent_Local[iVertex]], Children_Local[iVertex]);
-        nChildren_MPI[Parent_Local[iVertex]]++;
-        node[Parent_Local[iVertex]]->SetnChildren_CV(nChildren_MPI[Parent_Local[iVertex]]);
+        Children_CV[Parent_Local[iVertex]].push_back(Children_Local[iVertex]);
         node[Parent_Local[iVertex]]->SetDomain(false);
 
       }
 
       /*--- Deallocate auxiliar structures ---*/
 
-      delete[] nChildren_MPI;
       delete[] Parent_Remote;
       delete[] Children_Remote;
       delete[] Parent_Local;
@@ -619,58 +664,26 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   nPoint = Index_CoarseCV;
 
-  /*--- Console output with the summary of the agglomeration ---*/
-
-  Local_nPointCoarse = nPoint;
-  Local_nPointFine = fine_grid->GetnPoint();
-
-#ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#else
-  Global_nPointCoarse = Local_nPointCoarse;
-  Global_nPointFine = Local_nPointFine;
-#endif
-
-  su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
-
-  if (iMesh != MESH_0) {
-    if (nDim == 2) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./2.);
-    if (nDim == 3) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./3.);
-    CFL = factor*config->GetCFL(iMesh-1)/Coeff;
-    config->SetCFL(iMesh, CFL);
-  }
+  delete [] copy_marker;
 
-  su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
+  /*--- The agglomeration is now final, store the children in contiguous (CSR) format.
+   The cumulative sum of the number of children gives the outer pointers. ---*/
 
-  if (((nDim == 2) && (ratio < 2.5)) ||
-      ((nDim == 3) && (ratio < 2.5))) {
-    config->SetMGLevels(iMesh-1);
-  }
-  else {
-    if (rank == MASTER_NODE) {
-      PrintingToolbox::CTablePrinter MGTable(&std::cout);
-      MGTable.AddColumn("MG Level", 10);
-      MGTable.AddColumn("CVs", 10);
-      MGTable.AddColumn("Aggl. Rate", 10);
-      MGTable.AddColumn("CFL", 10);
-      MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+  su2vector<unsigned long> outerPtr(nPoint+1);
+  outerPtr(0) = 0;
+  for (unsigned long iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++)
+    outerPtr(iCoarsePoint+1) = outerPtr(iCoarsePoint) + Children_CV[iCoarsePoint].size();
 
+  su2vector<unsigned long> innerIdx(outerPtr(nPoint));
 
-      if (iMesh == 1){
-        MGTable.PrintHeader();
-        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1);
-      }
-      stringstream ss;
-      ss << "1/" << std::setprecision(3) << ratio;
-      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL;
-      if (iMesh == config->GetnMGLevels()){
-        MGTable.PrintFooter();
-      }
-    }
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(512)
+    for (unsigned long iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++)
+      copy(Children_CV[iCoarsePoint].begin(), Children_CV[iCoarsePoint].end(), &innerIdx(outerPtr(iCoarsePoint)));
   }
 
-  delete [] copy_marker;
+  SetChildrenCV(CCompressedSparsePatternUL(move(outerPtr), move(innerIdx)));
 
 }
 
@@ -932,28 +945,29 @@ void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long> *Suitable_In
 
 void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
 
-  unsigned long iFinePoint, iFinePoint_Neighbor, iParent, iCoarsePoint;
-  unsigned short iChildren, iNode;
+  /*--- Set the point surrounding a point, each coarse point only modifies
+   its own list of neighbors, thus the loop can be shared by threads. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
+      for (auto iChildren = 0ul; iChildren < childrenCV.getNumNonZeros(iCoarsePoint); iChildren ++) {
+        auto iFinePoint = childrenCV.getInnerIdx(iCoarsePoint, iChildren);
+        for (unsigned short iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
+          auto iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
+          auto iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
+          if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
+        }
+      }
 
-  /*--- Set the point surrounding a point ---*/
+      /*--- Set the number of neighbors variable, this is
+       important for JST and multigrid in parallel ---*/
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
-    for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
-      for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
-        iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
-        iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
-        if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
-      }
+      node[iCoarsePoint]->SetnNeighbor(node[iCoarsePoint]->GetnPoint());
     }
   }
 
-  /*--- Set the number of neighbors variable, this is
-   important for JST and multigrid in parallel ---*/
-
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
-    node[iCoarsePoint]->SetnNeighbor(node[iCoarsePoint]->GetnPoint());
-
 }
 
 void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
@@ -965,14 +979,17 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
 
   /*--- If any children node belong to the boundary then the entire control
    volume will belong to the boundary ---*/
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
-    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
-      if (fine_grid->node[iFinePoint]->GetBoundary()) {
-        node[iCoarsePoint]->SetBoundary(nMarker);
-        break;
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(512)
+    for (unsigned long iCoarse = 0; iCoarse < nPoint; iCoarse ++)
+      for (auto iChild = 0ul; iChild < childrenCV.getNumNonZeros(iCoarse); iChild ++) {
+        if (fine_grid->node[childrenCV.getInnerIdx(iCoarse, iChild)]->GetBoundary()) {
+          node[iCoarse]->SetBoundary(nMarker);
+          break;
+        }
       }
-    }
+  }
 
   vertex = new CVertex**[nMarker];
   nVertex = new unsigned long [nMarker];
@@ -987,8 +1004,8 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
 
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
     if (node[iCoarsePoint]->GetBoundary()) {
-      for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      for (iChildren = 0; iChildren < childrenCV.getNumNonZeros(iCoarsePoint); iChildren++) {
+        iFinePoint = childrenCV.getInnerIdx(iCoarsePoint, iChildren);
         for (iMarker = 0; iMarker < nMarker; iMarker ++) {
           if ((fine_grid->node[iFinePoint]->GetVertex(iMarker) != -1) && (node[iCoarsePoint]->GetVertex(iMarker) == -1)) {
             iVertex = nVertex[iMarker];
@@ -1014,8 +1031,8 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
 
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
     if (node[iCoarsePoint]->GetBoundary()) {
-      for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      for (iChildren = 0; iChildren < childrenCV.getNumNonZeros(iCoarsePoint); iChildren++) {
+        iFinePoint = childrenCV.getInnerIdx(iCoarsePoint, iChildren);
         for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker ++) {
           if ((fine_grid->node[iFinePoint]->GetVertex(iMarker) != -1) && (node[iCoarsePoint]->GetVertex(iMarker) == -1)) {
             iVertex = nVertex[iMarker];
@@ -1102,19 +1119,20 @@ void CMultiGridGeometry::MatchPeriodic(CConfig *config, unsigned short val_perio
 
 void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid, unsigned short action) {
 
-  unsigned long iFinePoint, iFinePoint_Neighbor, iCoarsePoint, iEdge, iParent;
-  long FineEdge, CoarseEdge;
-  unsigned short iChildren, iNode, iDim;
-  bool change_face_orientation;
-  su2double *Normal, Coarse_Volume, Area, *NormalFace = NULL;
-  Normal = new su2double [nDim];
+  /*--- The coordinates may have changed, the least-squares weights are recomputed on demand. ---*/
+  if (action != ALLOCATE) ClearLeastSquaresWeights();
+
+  SU2_OMP_PARALLEL
+  {
+  unsigned short iDim;
+  su2double Normal[3] = {0.0, 0.0, 0.0};
 
   /*--- Compute the area of the coarse volume ---*/
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
-    node[iCoarsePoint]->SetVolume(0.0);
-    Coarse_Volume = 0.0;
-    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+  SU2_OMP_FOR_STAT(512)
+  for (unsigned long iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
+    su2double Coarse_Volume = 0.0;
+    for (auto iChildren = 0ul; iChildren < childrenCV.getNumNonZeros(iCoarsePoint); iChildren ++) {
+      auto iFinePoint = childrenCV.getInnerIdx(iCoarsePoint, iChildren);
       Coarse_Volume += fine_grid->node[iFinePoint]->GetVolume();
     }
     node[iCoarsePoint]->SetVolume(Coarse_Volume);
@@ -1122,25 +1140,30 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
 
   /*--- Update or not the values of faces at the edge ---*/
   if (action != ALLOCATE) {
-    for (iEdge=0; iEdge < nEdge; iEdge++)
+    SU2_OMP_FOR_STAT(512)
+    for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++)
       edge[iEdge]->SetZeroValues();
   }
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
-    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+  /*--- A coarse edge (iParent, iCoarsePoint) is only visited from its endpoint with
+   the largest index, therefore each edge is only updated by one thread. ---*/
 
-      for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
-        iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
-        iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
+  SU2_OMP_FOR_DYN(256)
+  for (unsigned long iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
+    for (auto iChildren = 0ul; iChildren < childrenCV.getNumNonZeros(iCoarsePoint); iChildren ++) {
+      auto iFinePoint = childrenCV.getInnerIdx(iCoarsePoint, iChildren);
+
+      for (unsigned short iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
+        auto iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
+        auto iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
         if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
 
-          FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
+          long FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
 
-          change_face_orientation = false;
+          bool change_face_orientation = false;
           if (iFinePoint < iFinePoint_Neighbor) change_face_orientation = true;
 
-          CoarseEdge = FindEdge(iParent, iCoarsePoint);
+          long CoarseEdge = FindEdge(iParent, iCoarsePoint);
 
           fine_grid->edge[FineEdge]->GetNormal(Normal);
 
@@ -1154,22 +1177,24 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
         }
       }
     }
-  delete[] Normal;
 
   /*--- Check if there is a normal with null area ---*/
 
-  for (iEdge = 0; iEdge < nEdge; iEdge++) {
-    NormalFace = edge[iEdge]->GetNormal();
-    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+  SU2_OMP_FOR_STAT(512)
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
+    su2double *NormalFace = edge[iEdge]->GetNormal();
+    su2double Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
     Area = sqrt(Area);
     if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
   }
 
+  } // end SU2_OMP_PARALLEL
+
 }
 
 void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_grid, unsigned short action) {
-  unsigned long iCoarsePoint, iFinePoint, FineVertex, iVertex;
-  unsigned short iMarker, iChildren, iDim;
+  unsigned long iCoarsePoint, iFinePoint, FineVertex, iVertex, iChildren;
+  unsigned short iMarker, iDim;
   su2double *Normal, Area, *NormalFace = NULL;
 
   Normal = new su2double [nDim];
@@ -1183,8 +1208,8 @@ void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_
   for (iMarker = 0; iMarker < nMarker; iMarker ++)
     for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
       iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
-      for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      for (iChildren = 0; iChildren < childrenCV.getNumNonZeros(iCoarsePoint); iChildren ++) {
+        iFinePoint = childrenCV.getInnerIdx(iCoarsePoint, iChildren);
         if (fine_grid->node[iFinePoint]->GetVertex(iMarker)!=-1) {
           FineVertex = fine_grid->node[iFinePoint]->GetVertex(iMarker);
           fine_grid->vertex[iMarker][FineVertex]->GetNormal(Normal);
@@ -1207,26 +1232,26 @@ void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_
 }
 
 void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iChildren, iDim;
-  su2double Area_Parent, Area_Children;
-  su2double *Coordinates_Fine, *Coordinates;
-  Coordinates = new su2double[nDim];
-
-  for (Point_Coarse = 0; Point_Coarse < GetnPoint(); Point_Coarse++) {
-    Area_Parent = node[Point_Coarse]->GetVolume();
-    for (iDim = 0; iDim < nDim; iDim++) Coordinates[iDim] = 0.0;
-    for (iChildren = 0; iChildren < node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geometry->node[Point_Fine]->GetVolume();
-      Coordinates_Fine = geometry->node[Point_Fine]->GetCoord();
-      for (iDim = 0; iDim < nDim; iDim++)
-        Coordinates[iDim] += Coordinates_Fine[iDim]*Area_Children/Area_Parent;
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(512)
+    for (unsigned long Point_Coarse = 0; Point_Coarse < GetnPoint(); Point_Coarse++) {
+      su2double Area_Parent = node[Point_Coarse]->GetVolume();
+      su2double Coordinates[3] = {0.0, 0.0, 0.0};
+      for (auto iChildren = 0ul; iChildren < childrenCV.getNumNonZeros(Point_Coarse); iChildren++) {
+        auto Point_Fine = childrenCV.getInnerIdx(Point_Coarse, iChildren);
+        su2double Area_Children = geometry->node[Point_Fine]->GetVolume();
+        const su2double *Coordinates_Fine = geometry->node[Point_Fine]->GetCoord();
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          Coordinates[iDim] += Coordinates_Fine[iDim]*Area_Children/Area_Parent;
+      }
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        node[Point_Coarse]->SetCoord(iDim, Coordinates[iDim]);
     }
-    for (iDim = 0; iDim < nDim; iDim++)
-      node[Point_Coarse]->SetCoord(iDim, Coordinates[iDim]);
   }
-  delete[] Coordinates;
+
+  SetEdgeHalfVectors();
 }
 
 void CMultiGridGeometry::SetMultiGridWallHeatFlux(CGeometry *geometry, unsigned short val_marker){
@@ -1246,8 +1271,8 @@ void CMultiGridGeometry::SetMultiGridWallHeatFlux(CGeometry *geometry, unsigned
       WallHeatFlux_Coarse = 0.0;
       numberVertexChildren = 0;
       /*--- Compute area parent by taking into account only volumes that are on the marker ---*/
-      for(iChildren=0; iChildren < node[Point_Coarse]->GetnChildren_CV(); iChildren++){
-        Point_Fine = node[Point_Coarse]->GetChildren_CV(iChildren);
+      for (iChildren = 0; iChildren < childrenCV.getNumNonZeros(Point_Coarse); iChildren++){
+        Point_Fine = childrenCV.getInnerIdx(Point_Coarse, iChildren);
         isVertex = (node[Point_Fine]->GetDomain() && geometry->node[Point_Fine]->GetVertex(val_marker) != -1);
         if (isVertex){
           numberVertexChildren += 1;
@@ -1256,8 +1281,8 @@ void CMultiGridGeometry::SetMultiGridWallHeatFlux(CGeometry *geometry, unsigned
       }
 
       /*--- Loop again and propagate values to the coarser level ---*/
-      for(iChildren=0; iChildren < node[Point_Coarse]->GetnChildren_CV(); iChildren++){
-        Point_Fine = node[Point_Coarse]->GetChildren_CV(iChildren);
+      for (iChildren = 0; iChildren < childrenCV.getNumNonZeros(Point_Coarse); iChildren++){
+        Point_Fine = childrenCV.getInnerIdx(Point_Coarse, iChildren);
         Vertex_Fine = geometry->node[Point_Fine]->GetVertex(val_marker);
         isVertex = (node[Point_Fine]->GetDomain() && Vertex_Fine != -1);
         if(isVertex){
@@ -1292,8 +1317,8 @@ void CMultiGridGeometry::SetMultiGridWallTemperature(CGeometry *geometry, unsign
       WallTemperature_Coarse = 0.0;
       numberVertexChildren = 0;
       /*--- Compute area parent by taking into account only volumes that are on the marker ---*/
-      for(iChildren=0; iChildren < node[Point_Coarse]->GetnChildren_CV(); iChildren++){
-        Point_Fine = node[Point_Coarse]->GetChildren_CV(iChildren);
+      for (iChildren = 0; iChildren < childrenCV.getNumNonZeros(Point_Coarse); iChildren++){
+        Point_Fine = childrenCV.getInnerIdx(Point_Coarse, iChildren);
         isVertex = (node[Point_Fine]->GetDomain() && geometry->node[Point_Fine]->GetVertex(val_marker) != -1);
         if (isVertex){
           numberVertexChildren += 1;
@@ -1302,8 +1327,8 @@ void CMultiGridGeometry::SetMultiGridWallTemperature(CGeometry *geometry, unsign
       }
 
       /*--- Loop again and propagate values to the coarser level ---*/
-      for(iChildren=0; iChildren < node[Point_Coarse]->GetnChildren_CV(); iChildren++){
-        Point_Fine = node[Point_Coarse]->GetChildren_CV(iChildren);
+      for (iChildren = 0; iChildren < childrenCV.getNumNonZeros(Point_Coarse); iChildren++){
+        Point_Fine = childrenCV.getInnerIdx(Point_Coarse, iChildren);
         Vertex_Fine = geometry->node[Point_Fine]->GetVertex(val_marker);
         isVertex = (node[Point_Fine]->GetDomain() && Vertex_Fine != -1);
         if(isVertex){
@@ -1324,6 +1349,7 @@ void CMultiGridGeometry::SetMultiGridWallTemperature(CGeometry *geometry, unsign
 void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfig *config) {
 
   /*--- Loop over all coarse mesh points. ---*/
+  SU2_OMP_PARALLEL_(for schedule(static,512))
   for (unsigned long Point_Coarse = 0; Point_Coarse < nPoint; Point_Coarse++) {
     su2double Area_Parent = node[Point_Coarse]->GetVolume();
 
@@ -1332,8 +1358,8 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfi
 
     /*--- Loop over all of the children for this coarse CV and compute
      a grid velocity based on the values in the child CVs (fine mesh). ---*/
-    for (unsigned short iChild = 0; iChild < node[Point_Coarse]->GetnChildren_CV(); iChild++) {
-      unsigned long Point_Fine       = node[Point_Coarse]->GetChildren_CV(iChild);
+    for (auto iChild = 0ul; iChild < childrenCV.getNumNonZeros(Point_Coarse); iChild++) {
+      unsigned long Point_Fine       = childrenCV.getInnerIdx(Point_Coarse, iChild);
       su2double Area_Child           = fine_mesh->node[Point_Fine]->GetVolume();
       const su2double* Grid_Vel_Fine = fine_mesh->node[Point_Fine]->GetGridVel();
       for (unsigned short iDim = 0; iDim < nDim; iDim++)
@@ -34,6 +34,17 @@
 
 #include <cmath>
 
+/*--- Call the version of a kernel that is specialized for the block size chosen in Initialize. ---*/
+#define BLOCK_SIZE_DISPATCH(KERNEL, ...) \
+switch (blockSizeKernel) {                   \
+  case 1:  KERNEL<1>(__VA_ARGS__); break;    \
+  case 2:  KERNEL<2>(__VA_ARGS__); break;    \
+  case 3:  KERNEL<3>(__VA_ARGS__); break;    \
+  case 4:  KERNEL<4>(__VA_ARGS__); break;    \
+  case 5:  KERNEL<5>(__VA_ARGS__); break;    \
+  default: KERNEL<0>(__VA_ARGS__); break;    \
+}
+
 template<class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix(void) {
 
@@ -41,9 +52,11 @@ CSysMatrix<ScalarType>::CSysMatrix(void) {
   rank = SU2_MPI::GetRank();
 
   nPoint = nPointDomain = nVar = nEqn = 0;
+  blockSizeKernel = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
   nLinelet = 0;
+  frozen = false;
 
   omp_partitions    = nullptr;
 
@@ -121,6 +134,14 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- Choose the kernels specialized for the block size (square blocks of the
+   *    sizes used by the solvers), with MKL the JIT kernels are used instead. ---*/
+#ifdef USE_MKL
+  blockSizeKernel = 0;
+#else
+  blockSizeKernel = ((nVar == nEqn) && (nVar <= 5))? nVar : 0;
+#endif
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
@@ -140,7 +161,7 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   {
     ilu_fill_in = config->GetLinear_Solver_ILU_n();
 
-    const auto& csr_ilu = geometry->GetSparsePattern(type, ilu_fill_in);
+    const auto& csr_ilu = (ilu_fill_in == 0)? csr : geometry->GetSparsePattern(type, ilu_fill_in, this);
 
     row_ptr_ilu = csr_ilu.outerPtr();
     col_ind_ilu = csr_ilu.innerIdx();
@@ -184,9 +205,11 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   omp_partitions = new unsigned long [omp_num_parts+1];
 
   /// TODO: Use a work estimate to produce more balanced partitions.
+  /*--- Rounding up may leave the last partitions empty (small coarse grids),
+   *    they must not start beyond the domain points. ---*/
   auto pts_per_part = roundUpDiv(nPointDomain, omp_num_parts);
   for(auto part = 0ul; part < omp_num_parts; ++part)
-    omp_partitions[part] = part * pts_per_part;
+    omp_partitions[part] = min(part * pts_per_part, nPointDomain);
   omp_partitions[omp_num_parts] = nPointDomain;
 
   /*--- Generate MKL Kernels ---*/
@@ -255,13 +278,15 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
    buffer. It will be reallocated whenever we find a larger count
    per point. After the first cycle of comms, this should be inactive. ---*/
 
-  if (COUNT_PER_POINT > geometry->countPerPoint) {
+  auto& buf = geometry->GetCommBuffers();
+
+  if (COUNT_PER_POINT > buf.countPerPoint) {
     geometry->AllocateP2PComms(COUNT_PER_POINT);
   }
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  su2double *bufDSend = geometry->bufD_P2PSend;
+  su2double *bufDSend = buf.bufD_P2PSend;
 
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
@@ -295,7 +320,7 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
 
             /*--- Compute the offset in the recv buffer for this point. ---*/
 
-            buf_offset = (msg_offset + iSend)*geometry->countPerPoint;
+            buf_offset = (msg_offset + iSend)*buf.countPerPoint;
 
             /*--- Load the buffer with the data to be sent. ---*/
 
@@ -312,7 +337,7 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
            recv buffer for the send instead. Also, all of the offsets
            and counts are derived from the recv data structures. ---*/
 
-          bufDSend = geometry->bufD_P2PRecv;
+          bufDSend = buf.bufD_P2PRecv;
 
           /*--- Get the offset for the start of this message. ---*/
 
@@ -333,7 +358,7 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
 
             /*--- Compute the offset in the recv buffer for this point. ---*/
 
-            buf_offset = (msg_offset + iSend)*geometry->countPerPoint;
+            buf_offset = (msg_offset + iSend)*buf.countPerPoint;
 
             /*--- Load the buffer with the data to be sent. ---*/
 
@@ -377,7 +402,9 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  const su2double *bufDRecv = geometry->bufD_P2PRecv;
+  auto& buf = geometry->GetCommBuffers();
+
+  const su2double *bufDRecv = buf.bufD_P2PRecv;
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
@@ -389,9 +416,13 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
 
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv,
+      SU2_MPI::Waitany(geometry->nP2PRecv, buf.req_P2PRecv.data(),
                        &ind, &status);
 
+      /*--- Data of node-local neighbors arrives through shared memory. ---*/
+
+      geometry->SyncSharedP2PRecv(COMM_TYPE_DOUBLE, commType == SOLUTION_MATRIXTRANS);
+
       /*--- Once we have recv'd a message, get the source rank. ---*/
 
       source = status.MPI_SOURCE;
@@ -420,7 +451,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
 
             /*--- Compute the offset in the recv buffer for this point. ---*/
 
-            buf_offset = (msg_offset + iRecv)*geometry->countPerPoint;
+            buf_offset = (msg_offset + iRecv)*buf.countPerPoint;
 
             /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -436,7 +467,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
            send buffer for the recv instead. Also, all of the offsets
            and counts are derived from the send data structures. ---*/
 
-          bufDRecv = geometry->bufD_P2PSend;
+          bufDRecv = buf.bufD_P2PSend;
 
           /*--- We know the offsets based on the source rank. ---*/
 
@@ -459,7 +490,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
 
             /*--- Compute the offset in the recv buffer for this point. ---*/
 
-            buf_offset = (msg_offset + iRecv)*geometry->countPerPoint;
+            buf_offset = (msg_offset + iRecv)*buf.countPerPoint;
 
 
             for (iVar = 0; iVar < nVar; iVar++)
@@ -480,7 +511,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
      data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
+    SU2_MPI::Waitall(geometry->nP2PSend, buf.req_P2PSend.data(), MPI_STATUS_IGNORE);
 #endif
 
   }
@@ -489,6 +520,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::SetValZero() {
+  if (frozen) return;
   SU2_OMP_FOR_STAT(omp_light_size)
   for (auto index = 0ul; index < nnz*nVar*nEqn; index++)
     matrix[index] = 0.0;
@@ -496,6 +528,7 @@ void CSysMatrix<ScalarType>::SetValZero() {
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::SetValDiagonalZero() {
+  if (frozen) return;
   SU2_OMP_FOR_STAT(omp_heavy_size)
   for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
     for (auto index = 0ul; index < nVar*nEqn; ++index)
@@ -511,26 +544,7 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
 #else
-#define A(I,J) matrix[(I)*nVar+(J)]
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
-      for (auto kVar = jVar; kVar < nVar; kVar++)
-        A(iVar,kVar) -= weight * A(jVar,kVar);
-      vec[iVar] -= weight * vec[jVar];
-    }
-  }
-
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--; // unsigned type
-    for (auto jVar = iVar+1; jVar < nVar; jVar++)
-      vec[iVar] -= A(iVar,jVar) * vec[jVar];
-    vec[iVar] /= A(iVar,iVar);
-  }
-#undef A
+  gauss_elimination_impl<ScalarType>(nVar, matrix, vec);
 #endif
 }
 
@@ -593,6 +607,8 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
 template<class ScalarType>
 void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
 
+  if (frozen) return;
+
   unsigned long block_i = i/nVar;
   unsigned long row = i - block_i*nVar;
   unsigned long index, iVar;
@@ -642,17 +658,7 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    auto prod_begin = row_i*nVar; // offset to beginning of block row_i
-    for(auto iVar = 0ul; iVar < nVar; iVar++)
-      prod[prod_begin+iVar] = 0.0;
-    for (auto index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      auto vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
-      auto mat_begin = index*nVar*nVar; // offset to beginning of matrix block[row_i][col_ind[indx]]
-      MatrixVectorProductAdd(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
-    }
-  }
+  BLOCK_SIZE_DISPATCH(MatrixVectorProductKernel, vec, prod)
 
   /*--- MPI Parallelization by master thread. ---*/
 
@@ -664,6 +670,26 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
   SU2_OMP_BARRIER
 }
 
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::MatrixVectorProductKernel(const CSysVector<ScalarType> & vec,
+                                                       CSysVector<ScalarType> & prod) const {
+  /*--- Block size, compilation constant if N > 0. ---*/
+  const unsigned long n = (N > 0)? N : nVar;
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+    auto prod_begin = row_i*n; // offset to beginning of block row_i
+    for(auto iVar = 0ul; iVar < n; iVar++)
+      prod[prod_begin+iVar] = 0.0;
+    for (auto index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+      auto vec_begin = col_ind[index]*n; // offset to beginning of block col_ind[index]
+      auto mat_begin = index*n*n; // offset to beginning of matrix block[row_i][col_ind[indx]]
+      BlockGemv<N,true,true>(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
+    }
+  }
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProductTransposed(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                            CGeometry *geometry, CConfig *config) const {
@@ -716,9 +742,8 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+
+  BLOCK_SIZE_DISPATCH(JacobiKernel, vec, prod)
 
   /*--- MPI Parallelization ---*/
   SU2_OMP_MASTER
@@ -729,6 +754,17 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
   SU2_OMP_BARRIER
 }
 
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::JacobiKernel(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const {
+
+  const unsigned long n = (N > 0)? N : nVar;
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    BlockGemv<N,true,false>(&(invM[iPoint*n*n]), &vec[iPoint*n], &prod[iPoint*n]);
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
@@ -766,6 +802,16 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  BLOCK_SIZE_DISPATCH(ILUFactorizationKernel)
+
+}
+
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::ILUFactorizationKernel() {
+
+  const unsigned long n = (N > 0)? N : nVar;
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -775,6 +821,7 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
   {
     const auto begin = omp_partitions[thread];
     const auto end = omp_partitions[thread+1];
+    if (begin == end) continue;
 
     /*--- Each thread will work on the submatrix defined from row/col "begin"
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
@@ -786,7 +833,7 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
       /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
 
-      InverseDiagonalBlock_ILUMatrix(iPoint-1, &invM[(iPoint-1)*nVar*nVar]);
+      InverseDiagonalBlock_ILUMatrix(iPoint-1, &invM[(iPoint-1)*n*n]);
 
       /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
 
@@ -802,8 +849,8 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
         /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+        auto Block_ij = &ILU_matrix[index*n*n];
+        BlockGemm<N>(Block_ij, &invM[jPoint*n*n], weight);
 
         /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
 
@@ -820,20 +867,21 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
           auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
 
           if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_*nVar*nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
+            auto Block_jk = &ILU_matrix[index_*n*n];
+            BlockGemm<N>(weight, Block_jk, aux_block);
+            for (auto iVar = 0ul; iVar < n*n; ++iVar)
+              Block_ik[iVar] -= aux_block[iVar];
           }
         }
 
         /*--- Lastly, store "weight" in the lower triangular part, which
          will be reused during the forward solve in the precon/smoother. ---*/
 
-        for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+        for (auto iVar = 0ul; iVar < n*n; ++iVar)
           Block_ij[iVar] = weight[iVar];
       }
     }
-    InverseDiagonalBlock_ILUMatrix(end-1, &invM[(end-1)*nVar*nVar]);
+    InverseDiagonalBlock_ILUMatrix(end-1, &invM[(end-1)*n*n]);
 
   } // end parallel
 
@@ -845,6 +893,32 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
+  /*--- For 5x5 blocks the specialized substitution is not faster than the
+   *    generic one (SU2_BENCHMARK_SYSMATRIX), the latter is kept. ---*/
+  if (blockSizeKernel == 5) {
+    ILUSubstitutionKernel<0>(vec, prod);
+  }
+  else {
+    BLOCK_SIZE_DISPATCH(ILUSubstitutionKernel, vec, prod)
+  }
+
+  /*--- MPI Parallelization ---*/
+
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::ILUSubstitutionKernel(const CSysVector<ScalarType> & vec,
+                                                   CSysVector<ScalarType> & prod) const {
+
+  const unsigned long n = (N > 0)? N : nVar;
+
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
@@ -856,7 +930,7 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
 
     /*--- Copy vector to then work on prod in place ---*/
 
-    for (auto iVar = begin*nVar; iVar < end*nVar; iVar++)
+    for (auto iVar = begin*n; iVar < end*n; iVar++)
       prod[iVar] = vec[iVar];
 
     /*--- Forward solve the system using the lower matrix entries that
@@ -867,8 +941,8 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
       for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
         auto jPoint = col_ind_ilu[index];
         if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+        auto Block_ij = &ILU_matrix[index*n*n];
+        BlockGemv<N,false,true>(Block_ij, &prod[jPoint*n], &prod[iPoint*n]);
       }
     }
 
@@ -876,22 +950,45 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
 
     for (auto iPoint = end; iPoint > begin;) {
       iPoint--; // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        aux_vec[iVar] = prod[iPoint*nVar+iVar];
+      for (auto iVar = 0ul; iVar < n; iVar++)
+        aux_vec[iVar] = prod[iPoint*n+iVar];
 
       for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
         auto jPoint = col_ind_ilu[index];
         if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+        auto Block_ij = &ILU_matrix[index*n*n];
+        BlockGemv<N,false,true>(Block_ij, &prod[jPoint*n], aux_vec);
       }
 
-      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+      BlockGemv<N,true,false>(&invM[iPoint*n*n], aux_vec, &prod[iPoint*n]);
     }
   } // end parallel
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                         CGeometry *geometry, CConfig *config) const {
+
+  /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  BLOCK_SIZE_DISPATCH(LU_SGSForwardKernel, vec, prod)
 
   /*--- MPI Parallelization ---*/
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
+
+  BLOCK_SIZE_DISPATCH(LU_SGSBackwardKernel, prod)
 
+  /*--- MPI Parallelization ---*/
   SU2_OMP_MASTER
   {
     InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
@@ -901,13 +998,11 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
-                                                         CGeometry *geometry, CConfig *config) const {
+template<unsigned long N>
+void CSysMatrix<ScalarType>::LU_SGSForwardKernel(const CSysVector<ScalarType> & vec,
+                                                 CSysVector<ScalarType> & prod) const {
 
-  /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
-
-  /*--- Coherent view of vectors. ---*/
-  SU2_OMP_BARRIER
+  const unsigned long n = (N > 0)? N : nVar;
 
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
@@ -921,25 +1016,30 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
      *    This is NOT exactly equivalent to the MPI implementation on the same
      *    number of domains, for that we would need to define "thread-halos". ---*/
 
-    ScalarType low_prod[MAXNVAR];
-
     for (auto iPoint = begin; iPoint < end; ++iPoint) {
-      auto idx = iPoint*nVar;
-      LowerProduct(prod, iPoint, begin, low_prod);        // Compute L.x*
-      VectorSubtraction(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);              // Solve D.x* = y
+      auto idx = iPoint*n;
+
+      /*--- Compute y = b - L.x* ---*/
+      for (auto iVar = 0ul; iVar < n; ++iVar)
+        prod[idx+iVar] = vec[idx+iVar];
+
+      for (auto index = row_ptr[iPoint]; index < dia_ptr[iPoint]; ++index) {
+        auto jPoint = col_ind[index];
+        if (jPoint >= begin)
+          BlockGemv<N,false,true>(&matrix[index*n*n], &prod[jPoint*n], &prod[idx]);
+      }
+
+      /*--- Solve D.x* = y ---*/
+      BlockGaussElimination<N>(iPoint, &prod[idx]);
     }
   } // end parallel
+}
 
-  /*--- MPI Parallelization ---*/
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::LU_SGSBackwardKernel(CSysVector<ScalarType> & prod) const {
 
-  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
+  const unsigned long n = (N > 0)? N : nVar;
 
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
@@ -951,25 +1051,28 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
      *    product should consider halo columns. ---*/
     const auto col_end = (row_end==nPointDomain)? nPoint : row_end;
 
-    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+    ScalarType dia_prod[MAXNVAR];
 
     for (auto iPoint = row_end; iPoint > begin;) {
       iPoint--; // because of unsigned type
-      auto idx = iPoint*nVar;
-      DiagonalProduct(prod, iPoint, dia_prod);          // Compute D.x*
-      UpperProduct(prod, iPoint, col_end, up_prod);     // Compute U.x_(n+1)
-      VectorSubtraction(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);            // Solve D.x* = y
+      auto idx = iPoint*n;
+
+      /*--- Compute y = D.x*-U.x_(n+1) ---*/
+      BlockGemv<N,true,false>(&matrix[dia_ptr[iPoint]*n*n], &prod[idx], dia_prod);
+
+      for (auto index = dia_ptr[iPoint]+1; index < row_ptr[iPoint+1]; ++index) {
+        auto jPoint = col_ind[index];
+        if (jPoint < col_end)
+          BlockGemv<N,false,true>(&matrix[index*n*n], &prod[jPoint*n], dia_prod);
+      }
+
+      for (auto iVar = 0ul; iVar < n; ++iVar)
+        prod[idx+iVar] = dia_prod[iVar];
+
+      /*--- Solve D.x* = y ---*/
+      BlockGaussElimination<N>(iPoint, &prod[idx]);
     }
   } // end parallel
-
-  /*--- MPI Parallelization ---*/
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
 }
 
 template<class ScalarType>
@@ -1127,8 +1230,8 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
   }
   Local_nLineLets = nLinelet;
 
-  SU2_MPI::Allreduce(&Local_nPoints, &Global_nPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nLineLets, &Global_nLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&Local_nPoints, &Global_nPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&Local_nLineLets, &Global_nLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
   /*--- Memory allocation --*/
 
@@ -36,16 +36,23 @@
 #include "../../include/linear_algebra/CPreconditioner.hpp"
 
 #include <limits>
+#include <algorithm>
 
 const su2double eps = numeric_limits<passivedouble>::epsilon(); /*!< \brief machine epsilon */
 
 template<class ScalarType>
 CSysSolve<ScalarType>::CSysSolve(const bool mesh_deform_mode) : cg_ready(false), bcg_ready(false),
-                                                                gmres_ready(false), smooth_ready(false) {
+                                                                gmres_ready(false), smooth_ready(false),
+                                                                pcg_ready(false), pbcg_ready(false),
+                                                                gcrodr_ready(false), nRecycled(0) {
   mesh_deform = mesh_deform_mode;
   LinSysRes_ptr = nullptr;
   LinSysSol_ptr = nullptr;
   Residual = 0.0;
+  recSolves[0] = recSolves[1] = 0;
+  recIters[0] = recIters[1] = 0;
+  recMatVecs[0] = recMatVecs[1] = 0;
+  recTime[0] = recTime[1] = 0.0;
 }
 
 template<class ScalarType>
@@ -156,6 +163,294 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, vector<vector<ScalarType> > &
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg,
+                                                 vector<CSysVector<ScalarType> > & w) const {
+
+  /*--- Dot products of w[i+1] with all previous vectors, and with itself to
+   *    obtain the norm (Pythagoras) without an extra reduction. ---*/
+
+  const unsigned long nDot = i+2;
+  vector<const CSysVector<ScalarType>*> a(nDot, &w[i+1]), b(nDot);
+  for (int k = 0; k < i+2; k++) b[k] = &w[k];
+
+  vector<ScalarType> prod(nDot);
+
+  StartDotProducts(nDot, a.data(), b.data());
+  FinishDotProducts(nDot, prod.data());
+
+  ScalarType nrm0 = prod[i+1];
+
+  /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN ---*/
+
+  if ((nrm0 <= 0.0) || (nrm0 != nrm0)) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+  }
+
+  ScalarType nrm = nrm0;
+  for (int k = 0; k < i+1; k++) {
+    Hsbg[k][i] = prod[k];
+    w[i+1].Plus_AX(-prod[k], w[k]);
+    nrm -= prod[k]*prod[k];
+  }
+
+  /*--- Re-orthogonalize if the norm dropped significantly (loss of orthogonality
+   *    and cancellation in the Pythagorean norm), "twice is enough". ---*/
+
+  if (nrm < 0.5*nrm0) {
+
+    StartDotProducts(nDot, a.data(), b.data());
+    FinishDotProducts(nDot, prod.data());
+
+    nrm = prod[i+1];
+    for (int k = 0; k < i+1; k++) {
+      Hsbg[k][i] += prod[k];
+      w[i+1].Plus_AX(-prod[k], w[k]);
+      nrm -= prod[k]*prod[k];
+    }
+  }
+
+  nrm = sqrt(max(nrm, ScalarType(0.0)));
+  Hsbg[i+1][i] = nrm;
+
+  /*--- Scale the resulting vector ---*/
+
+  w[i+1] /= nrm;
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::StartDotProducts(unsigned long n, const CSysVector<ScalarType>* const* a,
+                                             const CSysVector<ScalarType>* const* b) const {
+
+  const unsigned long nElm = a[0]->GetNElmDomain();
+
+  /*--- All threads get the same "view" of the vectors and shared buffers. ---*/
+  SU2_OMP_BARRIER
+
+#if !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+
+  ScalarType* local = dotLocal.data();
+
+  SU2_OMP_MASTER
+  for (auto k = 0ul; k < n; ++k) local[k] = 0.0;
+  SU2_OMP_BARRIER
+
+  /*--- Each thread computes all products over a block of entries before moving
+   *    to the next, vectors that appear in several products are reused from cache. ---*/
+
+  vector<ScalarType> sum(n, 0.0);
+  const unsigned long nBlock = roundUpDiv(nElm, DOT_BLOCK_SIZE);
+
+  SU2_OMP(for schedule(static) nowait)
+  for (auto iBlock = 0ul; iBlock < nBlock; ++iBlock) {
+    const auto begin = iBlock*DOT_BLOCK_SIZE;
+    const auto end = min(begin+DOT_BLOCK_SIZE, nElm);
+    for (auto k = 0ul; k < n; ++k) {
+      const auto& u = *a[k];
+      const auto& v = *b[k];
+      ScalarType partial = 0.0;
+      for (auto i = begin; i < end; ++i)
+        partial += u[i]*v[i];
+      sum[k] += partial;
+    }
+  }
+
+  /*--- Reduction over all threads in this mpi rank using the shared buffer. ---*/
+  for (auto k = 0ul; k < n; ++k) {
+    SU2_OMP(atomic)
+    local[k] += sum[k];
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Start the reduction across ranks, only the master thread communicates,
+   *    the other threads continue (the result is only read after the Wait). ---*/
+  SU2_OMP_MASTER
+  SU2_MPI::Iallreduce(local, dotGlobal.data(), n, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm(), &dotRequest);
+
+#else
+  /*--- Compatible version, no OMP reductions, no atomics, master does everything
+   *    and the reduction is blocking (not supported by the AD MPI wrapper). ---*/
+  SU2_OMP_MASTER
+  {
+    for (auto k = 0ul; k < n; ++k) {
+      dotLocal[k] = 0.0;
+      for (auto i = 0ul; i < nElm; ++i)
+        dotLocal[k] += (*a[k])[i] * (*b[k])[i];
+    }
+    SelectMPIWrapper<ScalarType>::W::Allreduce(dotLocal.data(), dotGlobal.data(), n, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  }
+#endif
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::FinishDotProducts(unsigned long n, ScalarType* res) const {
+
+#if defined(HAVE_MPI) && !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+  SU2_OMP_MASTER
+  SU2_MPI::Wait(&dotRequest, MPI_STATUS_IGNORE);
+#endif
+  /*--- Make view of result consistent across threads. ---*/
+  SU2_OMP_BARRIER
+
+  for (auto k = 0ul; k < n; ++k) res[k] = dotGlobal[k];
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::SymmetricEigen(int n, vector<vector<ScalarType> > & A, vector<vector<ScalarType> > & V) {
+
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++)
+      V[i][j] = (i == j)? 1.0 : 0.0;
+
+  for (int iSweep = 0; iSweep < 50; iSweep++) {
+
+    /*--- Stop when the off-diagonal part is negligible relative to the diagonal. ---*/
+
+    ScalarType offDiag = 0.0, diag = 0.0;
+    for (int i = 0; i < n; i++) {
+      diag += A[i][i]*A[i][i];
+      for (int j = i+1; j < n; j++) offDiag += A[i][j]*A[i][j];
+    }
+    if (offDiag <= eps*eps*diag) break;
+
+    for (int p = 0; p < n-1; p++) {
+      for (int q = p+1; q < n; q++) {
+
+        if (A[p][q] == 0.0) continue;
+
+        /*--- Rotation in the p-q plane that annihilates A[p][q] (smallest angle). ---*/
+
+        ScalarType theta = 0.5*(A[q][q]-A[p][p])/A[p][q];
+        ScalarType t = 1.0/(fabs(theta) + sqrt(theta*theta + 1.0));
+        if (theta < 0.0) t = -t;
+        ScalarType c = 1.0/sqrt(t*t + 1.0), s = t*c;
+
+        for (int k = 0; k < n; k++) {
+          ScalarType akp = A[k][p], akq = A[k][q];
+          A[k][p] = c*akp - s*akq;
+          A[k][q] = s*akp + c*akq;
+        }
+        for (int k = 0; k < n; k++) {
+          ScalarType apk = A[p][k], aqk = A[q][k];
+          A[p][k] = c*apk - s*aqk;
+          A[q][k] = s*apk + c*aqk;
+        }
+        for (int k = 0; k < n; k++) {
+          ScalarType vkp = V[k][p], vkq = V[k][q];
+          V[k][p] = c*vkp - s*vkq;
+          V[k][q] = s*vkp + c*vkq;
+        }
+      }
+    }
+  }
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::UpdateRecycledSubspace(unsigned long nRec, unsigned long nSteps, unsigned long k,
+                                                            const vector<vector<ScalarType> > & B,
+                                                            const vector<vector<ScalarType> > & H) const {
+
+  /*--- All threads compute the (small) dense factorizations, the results are the same. ---*/
+
+  const unsigned long n = nRec + nSteps;
+
+  /*--- G = [I B; 0 H], of size (n+1) x n. ---*/
+
+  vector<vector<ScalarType> > G(n+1, vector<ScalarType>(n, 0.0));
+  for (auto i = 0ul; i < nRec; ++i) {
+    G[i][i] = 1.0;
+    for (auto j = 0ul; j < nSteps; ++j) G[i][nRec+j] = B[i][j];
+  }
+  for (auto j = 0ul; j < nSteps; ++j)
+    for (auto i = 0ul; i <= j+1; ++i) G[nRec+i][nRec+j] = H[i][j];
+
+  /*--- Right singular vectors of G from the eigen-decomposition of G^T*G. ---*/
+
+  vector<vector<ScalarType> > GtG(n, vector<ScalarType>(n, 0.0)), P(n, vector<ScalarType>(n, 0.0));
+  ScalarType normG = 0.0;
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto j = 0ul; j <= i; ++j) {
+      for (auto l = 0ul; l <= n; ++l) GtG[i][j] += G[l][i]*G[l][j];
+      GtG[j][i] = GtG[i][j];
+    }
+    normG += GtG[i][i];
+  }
+  normG = sqrt(normG);
+
+  SymmetricEigen(n, GtG, P);
+
+  vector<unsigned long> order(n);
+  for (auto i = 0ul; i < n; ++i) order[i] = i;
+  stable_sort(order.begin(), order.end(),
+              [&GtG](unsigned long a, unsigned long b) { return GtG[a][a] < GtG[b][b]; });
+
+  /*--- QR factorization of G*P by modified Gram-Schmidt, the columns of M = P*R^-1 are
+   *    transformed in the same way. Columns with a negligible image are dropped. ---*/
+
+  const auto kNew = min(k, n);
+  vector<vector<ScalarType> > Q(kNew, vector<ScalarType>(n+1)), M(kNew, vector<ScalarType>(n));
+  unsigned long nKept = 0;
+
+  for (auto j = 0ul; j < kNew; ++j) {
+    auto& q = Q[nKept];
+    auto& mj = M[nKept];
+
+    ScalarType nrm0 = 0.0;
+    for (auto l = 0ul; l < n; ++l) mj[l] = P[l][order[j]];
+    for (auto l = 0ul; l <= n; ++l) {
+      q[l] = 0.0;
+      for (auto i = 0ul; i < n; ++i) q[l] += G[l][i]*mj[i];
+      nrm0 += q[l]*q[l];
+    }
+    nrm0 = sqrt(nrm0);
+    if (nrm0 <= eps*normG) continue;
+
+    for (auto i = 0ul; i < nKept; ++i) {
+      ScalarType prod = 0.0;
+      for (auto l = 0ul; l <= n; ++l) prod += Q[i][l]*q[l];
+      for (auto l = 0ul; l <= n; ++l) q[l] -= prod*Q[i][l];
+      for (auto l = 0ul; l < n; ++l) mj[l] -= prod*M[i][l];
+    }
+
+    ScalarType nrm = 0.0;
+    for (auto l = 0ul; l <= n; ++l) nrm += q[l]*q[l];
+    nrm = sqrt(nrm);
+    if (nrm <= 1e-8*nrm0) continue;
+
+    for (auto l = 0ul; l <= n; ++l) q[l] /= nrm;
+    for (auto l = 0ul; l < n; ++l) mj[l] /= nrm;
+    ++nKept;
+  }
+
+  /*--- U = [U Z]*M and C = [C V]*Q are built in the work vectors, which are then swapped
+   *    with the old ones (by one thread, after all threads are done with the vectors). ---*/
+
+  auto Yhat = [&](unsigned long i) -> const CSysVector<ScalarType>& { return (i < nRec)? RecU[i] : RecZ[i-nRec]; };
+  auto What = [&](unsigned long i) -> const CSysVector<ScalarType>& { return (i < nRec)? RecC[i] : RecV[i-nRec]; };
+
+  for (auto j = 0ul; j < nKept; ++j) {
+    RecTmp[j].Equals_AX(M[j][0], Yhat(0));
+    for (auto i = 1ul; i < n; ++i) RecTmp[j].Plus_AX(M[j][i], Yhat(i));
+  }
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  swap(RecU, RecTmp);
+  SU2_OMP_BARRIER
+
+  for (auto j = 0ul; j < nKept; ++j) {
+    RecTmp[j].Equals_AX(Q[j][0], What(0));
+    for (auto i = 1ul; i <= n; ++i) RecTmp[j].Plus_AX(Q[j][i], What(i));
+  }
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  swap(RecC, RecTmp);
+  SU2_OMP_BARRIER
+
+  return nKept;
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(string solver, ScalarType restol, ScalarType resinit) const {
 
@@ -186,6 +481,35 @@ void CSysSolve<ScalarType>::WriteWarning(ScalarType res_calc, ScalarType res_tru
   cout << "# true_res - calc_res = " << res_true - res_calc << endl;
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::WriteRecycleSummary(const string & name) const {
+
+  const auto nSolves = recSolves[0] + recSolves[1];
+
+  if ((SU2_MPI::GetRank() != MASTER_NODE) || (nSolves == 0)) return;
+
+  /*--- The warm solves also pay the products that rebuild C = A*U and the updates of the
+   *    recycled subspace, hence the matrix-vector products and the time are reported. ---*/
+
+  passivedouble avgIters[2] = {0.0}, avgMatVecs[2] = {0.0}, avgTime[2] = {0.0};
+  for (auto i = 0; i < 2; ++i) {
+    if (recSolves[i] == 0) continue;
+    avgIters[i] = passivedouble(recIters[i])/recSolves[i];
+    avgMatVecs[i] = passivedouble(recMatVecs[i])/recSolves[i];
+    avgTime[i] = recTime[i]/recSolves[i];
+  }
+
+  cout << name << " FGCRODR: " << nSolves << " solves, " << recSolves[0] << " without and " << recSolves[1]
+       << " with recycled subspace." << endl;
+  cout << "  Average per solve without / with recycled subspace: " << avgIters[0] << " / " << avgIters[1]
+       << " iterations, " << avgMatVecs[0] << " / " << avgMatVecs[1] << " matrix-vector products, "
+       << avgTime[0] << " / " << avgTime[1] << " s";
+  if ((recSolves[0] > 0) && (recSolves[1] > 0) && (avgMatVecs[0] > 0.0) && (avgTime[0] > 0.0))
+    cout << " (" << 100.0*(1.0 - avgMatVecs[1]/avgMatVecs[0]) << "% fewer products, "
+         << 100.0*(1.0 - avgTime[1]/avgTime[0]) << "% less time)";
+  cout << "." << endl;
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                   const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -216,10 +540,13 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
       r.Initialize(nBlk, nBlkDomain, nVar, nullptr);
       z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
       p.Initialize(nBlk, nBlkDomain, nVar, nullptr);
-
-      cg_ready = true;
     }
     SU2_OMP_BARRIER
+
+    /*--- Set the flag only after all threads have tested it, otherwise a
+     *    late thread could skip the barrier above. ---*/
+    SU2_OMP_MASTER
+    cg_ready = true;
   }
 
   /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
@@ -327,7 +654,8 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
-                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config,
+                                                      bool classical_gs) const {
 
   const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
 
@@ -352,9 +680,14 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     {
       W.resize(m+1, x);
       Z.resize(m+1, x);
-      gmres_ready = true;
+      dotLocal.resize(max<size_t>(dotLocal.size(), m+2));
+      dotGlobal.resize(dotLocal.size());
     }
     SU2_OMP_BARRIER
+
+    /*--- See CG_LinSolver. ---*/
+    SU2_OMP_MASTER
+    gmres_ready = true;
   }
 
   /*--- Define various arrays. In parallel, each thread of each rank has and works
@@ -424,9 +757,10 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
     mat_vec(Z[i], W[i+1]);
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Gram-Schmidt orthogonalization ---*/
 
-    ModGramSchmidt(i, H, W);
+    if (classical_gs) ClassicalGramSchmidt(i, H, W);
+    else ModGramSchmidt(i, H, W);
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
      new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
@@ -507,10 +841,12 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
       p.Initialize(nBlk, nBlkDomain, nVar, nullptr);
       v.Initialize(nBlk, nBlkDomain, nVar, nullptr);
       z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
-
-      bcg_ready = true;
     }
     SU2_OMP_BARRIER
+
+    /*--- See CG_LinSolver. ---*/
+    SU2_OMP_MASTER
+    bcg_ready = true;
   }
 
   /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
@@ -637,6 +973,563 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return i;
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedCG_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                           const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                           ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, only one thread can
+   *    do this since the working vectors are shared. ---*/
+
+  if (!pcg_ready) {
+    SU2_OMP_MASTER
+    {
+      PipeVec.resize(max<size_t>(PipeVec.size(), 9), x);
+      dotLocal.resize(max<size_t>(dotLocal.size(), MAX_PIPE_DOTS));
+      dotGlobal.resize(dotLocal.size());
+    }
+    SU2_OMP_BARRIER
+
+    /*--- See CG_LinSolver. ---*/
+    SU2_OMP_MASTER
+    pcg_ready = true;
+  }
+
+  /*--- Residual, preconditioned residual and its product (r, u, w), search direction (p)
+   *    and recurrences for the products of p (s = A.p, q = M.s, z = A.q) and M.w (m_) and A.m (n_). ---*/
+
+  auto& r = PipeVec[0];  auto& u = PipeVec[1];  auto& w = PipeVec[2];
+  auto& p = PipeVec[3];  auto& s = PipeVec[4];  auto& q = PipeVec[5];
+  auto& z = PipeVec[6];  auto& m_ = PipeVec[7]; auto& n_ = PipeVec[8];
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  mat_vec(x, w);
+  r = b; r -= w;
+
+  norm_r = r.norm();
+  norm0  = b.norm();
+  if ((norm_r < tol*norm0) || (norm_r < eps)) {
+    if (master) cout << "CSysSolve::PipelinedCG(): system solved by initial guess." << endl;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  norm0 = norm_r;
+
+  /*--- Output header information including initial residual ---*/
+
+  if ((monitoring) && (master)) {
+    WriteHeader("Pipelined CG", tol, norm_r);
+    WriteHistory(i, norm_r/norm0);
+  }
+
+  precond(r, u);
+  mat_vec(u, w);
+
+  ScalarType alpha = 0.0, beta = 0.0, gamma = 0.0, gamma_old = 0.0, delta = 0.0;
+
+  const CSysVector<ScalarType>* dot_a[] = {&r, &w, &r};
+  const CSysVector<ScalarType>* dot_b[] = {&u, &u, &r};
+  ScalarType dots[3];
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Start the reduction of (r,u), (w,u) and (r,r), and hide
+     *    its latency behind the preconditioner and the product. ---*/
+
+    StartDotProducts(3, dot_a, dot_b);
+
+    precond(w, m_);
+    mat_vec(m_, n_);
+
+    FinishDotProducts(3, dots);
+
+    gamma_old = gamma;
+    gamma = dots[0];
+    delta = dots[1];
+
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+
+    norm_r = sqrt(dots[2]);
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (master)) && (i % 10 == 0) && (i > 0))
+      WriteHistory(i, norm_r/norm0);
+
+    /*--- Update the recurrences, on the first iteration they are initialized. ---*/
+
+    if (i > 0) {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta*gamma/alpha);
+
+      z.Equals_AX_Plus_BY(beta, z, 1.0, n_);
+      q.Equals_AX_Plus_BY(beta, q, 1.0, m_);
+      s.Equals_AX_Plus_BY(beta, s, 1.0, w);
+      p.Equals_AX_Plus_BY(beta, p, 1.0, u);
+    }
+    else {
+      alpha = gamma / delta;
+      z = n_; q = m_; s = w; p = u;
+    }
+
+    /*--- Update solution and residuals. ---*/
+
+    x.Plus_AX(alpha, p);
+    r.Plus_AX(-alpha, s);
+    u.Plus_AX(-alpha, q);
+    w.Plus_AX(-alpha, z);
+
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("Pipelined CG", i, norm_r/norm0);
+
+    mat_vec(x, w);
+    r = b; r -= w;
+    ScalarType true_res = r.norm();
+
+    if ((fabs(true_res - norm_r) > tol*10.0) && (master)) {
+      WriteWarning(norm_r, true_res, tol);
+    }
+
+  }
+
+  residual = norm_r/norm0;
+  return i;
+
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedBCGSTAB_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                                const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                                ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet ---*/
+
+  if (!pbcg_ready) {
+    SU2_OMP_MASTER
+    {
+      PipeVec.resize(max<size_t>(PipeVec.size(), 12), x);
+      dotLocal.resize(max<size_t>(dotLocal.size(), MAX_PIPE_DOTS));
+      dotGlobal.resize(dotLocal.size());
+    }
+    SU2_OMP_BARRIER
+
+    /*--- See CG_LinSolver. ---*/
+    SU2_OMP_MASTER
+    pbcg_ready = true;
+  }
+
+  /*--- The method is applied to A.M (right preconditioning), the vectors are in the
+   *    space of the residual, the solution increment is accumulated in "dx" and the
+   *    preconditioner is applied to it at the end, "aux" holds M.z and M.w. ---*/
+
+  auto& r_0 = PipeVec[0]; auto& r = PipeVec[1];   auto& w = PipeVec[2];
+  auto& t   = PipeVec[3]; auto& p = PipeVec[4];   auto& s = PipeVec[5];
+  auto& z   = PipeVec[6]; auto& q = PipeVec[7];   auto& y = PipeVec[8];
+  auto& v   = PipeVec[9]; auto& dx = PipeVec[10]; auto& aux = PipeVec[11];
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  mat_vec(x, w);
+  r = b; r -= w;
+
+  norm_r = r.norm();
+  norm0  = b.norm();
+  if ((norm_r < tol*norm0) || (norm_r < eps)) {
+    if (master) cout << "CSysSolve::PipelinedBCGSTAB(): system solved by initial guess." << endl;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  norm0 = norm_r;
+
+  /*--- Output header information including initial residual ---*/
+
+  if ((monitoring) && (master)) {
+    WriteHeader("Pipelined BCGSTAB", tol, norm_r);
+    WriteHistory(i, norm_r/norm0);
+  }
+
+  /*--- Initialization, w = A.M.r, t = A.M.w ---*/
+
+  r_0 = r;
+  dx = ScalarType(0.0);
+
+  precond(r, aux);
+  mat_vec(aux, w);
+  precond(w, aux);
+  mat_vec(aux, t);
+
+  ScalarType alpha = 0.0, beta = 0.0, omega = 0.0, rho = 0.0;
+  {
+    const CSysVector<ScalarType>* dot_a[] = {&r_0, &r_0};
+    const CSysVector<ScalarType>* dot_b[] = {&r, &w};
+    ScalarType dots[2];
+    StartDotProducts(2, dot_a, dot_b);
+    FinishDotProducts(2, dots);
+    rho = dots[0];
+    alpha = rho / dots[1];
+  }
+
+  const CSysVector<ScalarType>* dot1_a[] = {&q, &y};
+  const CSysVector<ScalarType>* dot1_b[] = {&y, &y};
+  const CSysVector<ScalarType>* dot2_a[] = {&r_0, &r_0, &r_0, &r_0, &r};
+  const CSysVector<ScalarType>* dot2_b[] = {&r, &w, &s, &z, &r};
+  ScalarType dots[MAX_PIPE_DOTS];
+
+  /*--- Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- p_i = r_i + beta*(p_{i-1} - omega*s_{i-1}), and likewise for s (A.p) and z (A.s). ---*/
+
+    if (i > 0) {
+      const ScalarType beta_omega = -beta*omega;
+      p.Equals_AX_Plus_BY(beta, p, beta_omega, s); p += r;
+      s.Equals_AX_Plus_BY(beta, s, beta_omega, z); s += w;
+      z.Equals_AX_Plus_BY(beta, z, beta_omega, v); z += t;
+    }
+    else {
+      p = r; s = w; z = t;
+    }
+
+    /*--- q = r - alpha*s, y = w - alpha*z ---*/
+
+    q.Equals_AX_Plus_BY(1.0, r, -alpha, s);
+    y.Equals_AX_Plus_BY(1.0, w, -alpha, z);
+
+    /*--- Reduction of (q,y) and (y,y), overlapped with v = A.M.z ---*/
+
+    StartDotProducts(2, dot1_a, dot1_b);
+
+    precond(z, aux);
+    mat_vec(aux, v);
+
+    FinishDotProducts(2, dots);
+
+    omega = dots[0] / dots[1];
+
+    /*--- Update solution (increment) and residual, w = y - omega*(t - alpha*v) ---*/
+
+    dx.Plus_AX(alpha, p);
+    dx.Plus_AX(omega, q);
+    r.Equals_AX_Plus_BY(1.0, q, -omega, y);
+    w.Equals_AX_Plus_BY(1.0, y, -omega, t);
+    w.Plus_AX(omega*alpha, v);
+
+    /*--- Reduction of the dot products with r_0 and of the residual norm,
+     *    overlapped with t = A.M.w ---*/
+
+    StartDotProducts(5, dot2_a, dot2_b);
+
+    precond(w, aux);
+    mat_vec(aux, t);
+
+    FinishDotProducts(5, dots);
+
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+
+    norm_r = sqrt(dots[4]);
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (master)) && ((i+1) % 10 == 0))
+      WriteHistory(i+1, norm_r/norm0);
+
+    /*--- Compute beta and the next alpha. ---*/
+
+    beta = (alpha/omega) * (dots[0]/rho);
+    rho = dots[0];
+    alpha = rho / (dots[1] + beta*dots[2] - beta*omega*dots[3]);
+
+  }
+
+  /*--- Apply the preconditioner to the increment. ---*/
+
+  precond(dx, aux);
+  x += aux;
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("Pipelined BCGSTAB", i, norm_r/norm0);
+
+    mat_vec(x, w);
+    r = b; r -= w;
+    ScalarType true_res = r.norm();
+
+    if ((fabs(true_res - norm_r) > tol*10.0) && (master)) {
+      WriteWarning(norm_r, true_res, tol);
+    }
+
+  }
+
+  residual = norm_r/norm0;
+  return i;
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::FGCRODR_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                       ScalarType tol, unsigned long m, unsigned long cycle, unsigned long k,
+                                                       bool sameMatrix, ScalarType & residual, bool monitoring,
+                                                       CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+
+  /*---  Check the subspace sizes ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if ((k < 1) || (k >= cycle)) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("The recycled subspace of FGCRODR must be smaller than the restart frequency.", CURRENT_FUNCTION);
+  }
+
+  if (cycle > 5000) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("FGCRODR subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the recycled subspace persists between calls. ---*/
+
+  if (!gcrodr_ready) {
+    SU2_OMP_MASTER
+    {
+      RecV.resize(cycle+1, x);
+      RecZ.resize(cycle+1, x);
+      RecU.resize(k, x);
+      RecC.resize(k, x);
+      RecTmp.resize(k, x);
+      nRecycled = 0;
+    }
+    SU2_OMP_BARRIER
+
+    /*--- See CG_LinSolver. ---*/
+    SU2_OMP_MASTER
+    gcrodr_ready = true;
+  }
+
+  /*--- Small dense arrays, each thread has its own copy (see FGMRES). H is rotated
+   *    to solve the least-squares problems, Hbar keeps the Hessenberg matrix. ---*/
+
+  vector<ScalarType> g(cycle+1, 0.0);
+  vector<ScalarType> sn(cycle+1, 0.0);
+  vector<ScalarType> cs(cycle+1, 0.0);
+  vector<ScalarType> y(cycle, 0.0);
+  vector<ScalarType> res(cycle+1, 0.0);
+  vector<vector<ScalarType> > H(cycle+1, vector<ScalarType>(cycle, 0.0));
+  vector<vector<ScalarType> > Hbar(cycle+1, vector<ScalarType>(cycle, 0.0));
+  vector<vector<ScalarType> > B(k, vector<ScalarType>(cycle, 0.0));
+
+  const passivedouble startTime = SU2_MPI::Wtime();
+
+  /*--- Calculate the initial residual, r = b - A*x, it is kept in RecV[0]. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  mat_vec(x, RecV[0]);
+  RecV[0].Equals_AX_Plus_BY(1.0, b, -1.0, RecV[0]);
+
+  ScalarType beta = RecV[0].norm();
+
+  if ((beta < tol*norm0) || (beta < eps)) {
+
+    /*--- System is already solved ---*/
+
+    if (master) cout << "CSysSolve::FGCRODR(): system solved by initial guess." << endl;
+    residual = beta;
+    return 0;
+  }
+
+  norm0 = beta;
+
+  /*--- The matrix may have changed since the last call, recompute C = A*U and make it
+   *    orthonormal, applying the same transformation to U to keep A*U = C. If the matrix
+   *    is the same, C is still valid (U does not depend on the preconditioner). ---*/
+
+  unsigned long nRec = nRecycled, nKept = sameMatrix? nRecycled : 0;
+  const bool warm = (nRec > 0);
+
+  for (unsigned long j = 0; j < nRec && !sameMatrix; j++) {
+
+    if (nKept != j) RecU[nKept] = RecU[j];
+    mat_vec(RecU[nKept], RecC[nKept]);
+
+    ScalarType nrm0 = RecC[nKept].norm();
+
+    for (unsigned long i = 0; i < nKept; i++) {
+      ScalarType prod = RecC[nKept].dot(RecC[i]);
+      RecC[nKept].Plus_AX(-prod, RecC[i]);
+      RecU[nKept].Plus_AX(-prod, RecU[i]);
+    }
+
+    ScalarType nrm = RecC[nKept].norm();
+    if ((nrm0 == 0.0) || (nrm <= 1e-8*nrm0)) continue;
+
+    RecC[nKept] /= nrm;
+    RecU[nKept] /= nrm;
+    nKept++;
+  }
+  nRec = nKept;
+
+  /*--- Minimize the residual over the recycled subspace, x += U*C^T*r, r -= C*C^T*r. ---*/
+
+  for (unsigned long i = 0; i < nRec; i++) {
+    ScalarType prod = RecC[i].dot(RecV[0]);
+    x.Plus_AX(prod, RecU[i]);
+    RecV[0].Plus_AX(-prod, RecC[i]);
+  }
+  if (nRec > 0) beta = RecV[0].norm();
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long iter = 0;
+  if ((monitoring) && (master)) {
+    WriteHeader("FGCRODR", tol, norm0);
+    WriteHistory(iter, beta/norm0);
+  }
+
+  /*--- Cycles of m-k Arnoldi steps with the operator (I-C*C^T)*A*M^-1. ---*/
+
+  while ((beta >= tol*norm0) && (iter < m)) {
+
+    const unsigned long nMax = min(cycle-nRec, m-iter);
+    const ScalarType betaCycle = beta;
+
+    RecV[0] /= beta;
+    for (auto& val : g) val = 0.0;
+    g[0] = beta;
+
+    unsigned long s = 0;
+    while (s < nMax) {
+
+      /*---  Precondition, add to the Krylov subspace, and project out range(C) ---*/
+
+      precond(RecV[s], RecZ[s]);
+      mat_vec(RecZ[s], RecV[s+1]);
+
+      for (unsigned long i = 0; i < nRec; i++) {
+        B[i][s] = RecV[s+1].dot(RecC[i]);
+        RecV[s+1].Plus_AX(-B[i][s], RecC[i]);
+      }
+
+      ModGramSchmidt(s, H, RecV);
+
+      for (unsigned long i = 0; i <= s+1; i++) Hbar[i][s] = H[i][s];
+
+      /*---  Givens rotations, as in FGMRES ---*/
+
+      for (unsigned long i = 0; i < s; i++)
+        ApplyGivens(sn[i], cs[i], H[i][s], H[i+1][s]);
+      GenerateGivens(H[s][s], H[s+1][s], sn[s], cs[s]);
+      ApplyGivens(sn[s], cs[s], g[s], g[s+1]);
+
+      beta = fabs(g[s+1]);
+      s++;
+      iter++;
+
+      if ((monitoring) && (master) && (iter % 10 == 0))
+        WriteHistory(iter, beta/norm0);
+
+      if (beta < tol*norm0) break;
+    }
+
+    /*---  Solve the least-squares problem, the recycled part of the update is -U*B*y. ---*/
+
+    SolveReduced(s, H, g, y);
+    for (unsigned long j = 0; j < s; j++)
+      x.Plus_AX(y[j], RecZ[j]);
+
+    for (unsigned long i = 0; i < nRec; i++) {
+      ScalarType By = 0.0;
+      for (unsigned long j = 0; j < s; j++) By += B[i][j]*y[j];
+      x.Plus_AX(-By, RecU[i]);
+    }
+
+    /*--- Coefficients of the new residual in the Arnoldi basis, r = V*(beta*e1 - Hbar*y). ---*/
+
+    for (unsigned long i = 0; i <= s; i++) res[i] = (i == 0)? betaCycle : ScalarType(0.0);
+    for (unsigned long j = 0; j < s; j++)
+      for (unsigned long i = 0; i <= j+1; i++) res[i] -= Hbar[i][j]*y[j];
+
+    /*--- Update the recycled subspace with the information of this cycle, the residual
+     *    remains orthogonal to the new C since it is contained in range([C V]*G). ---*/
+
+    nRec = UpdateRecycledSubspace(nRec, s, k, B, Hbar);
+
+    RecV[0] *= res[0];
+    for (unsigned long i = 1; i <= s; i++)
+      RecV[0].Plus_AX(res[i], RecV[i]);
+  }
+
+  /*--- Keep the subspace for the next call and update the statistics. ---*/
+
+  SU2_OMP_MASTER
+  {
+    recSolves[warm]++;
+    recIters[warm] += iter;
+    recMatVecs[warm] += 1 + (sameMatrix? 0 : nRecycled) + iter;
+    recTime[warm] += SU2_MPI::Wtime() - startTime;
+    nRecycled = nRec;
+  }
+  SU2_OMP_BARRIER
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("FGCRODR", iter, beta/norm0);
+
+    mat_vec(x, RecV[0]);
+    RecV[0] -= b;
+    ScalarType true_res = RecV[0].norm();
+
+    if (fabs(true_res - beta) > tol*10) {
+      if (master) {
+        WriteWarning(beta, true_res, tol);
+      }
+    }
+
+  }
+
+  residual = beta/norm0;
+  return iter;
+
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                         const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -667,10 +1560,12 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
       A_x.Initialize(nBlk, nBlkDomain, nVar, nullptr);
       r.Initialize(nBlk, nBlkDomain, nVar, nullptr);
       z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
-
-      smooth_ready = true;
     }
     SU2_OMP_BARRIER
+
+    /*--- See CG_LinSolver. ---*/
+    SU2_OMP_MASTER
+    smooth_ready = true;
   }
 
   /*--- Compute the initial residual and check if the system is already solved (if in COMM_FULL mode). ---*/
@@ -888,8 +1783,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   SU2_OMP_PARALLEL
   {
-    /*--- Build preconditioner in parallel. ---*/
-    precond->Build();
+    /*--- Build preconditioner in parallel, unless the matrix is frozen (lagged),
+     *    in which case the factorization of the previous solve is still valid. ---*/
+    if (!Jacobian.GetFrozen()) precond->Build();
 
     /*--- Thread-local variables. ---*/
     unsigned long iter = 0;
@@ -905,6 +1801,19 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       case CONJUGATE_GRADIENT:
         iter = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
         break;
+      case PIPELINED_CG:
+        iter = PipelinedCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case PIPELINED_BCGSTAB:
+        iter = PipelinedBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case FGMRES_CGS:
+        iter = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config, true);
+        break;
+      case FGCRODR:
+        iter = FGCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, RestartIter,
+                                 config->GetLinear_Solver_Recycle_Dim(), Jacobian.GetFrozen(), residual, ScreenOutput, config);
+        break;
       case RESTARTED_FGMRES:
         norm0 = LinSysRes_ptr->norm();
         while (iter < MaxIter) {
@@ -918,7 +1827,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
         iter = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
         break;
       case PASTIX_LDLT : case PASTIX_LU:
-        Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
+        if (!Jacobian.GetFrozen()) Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
         Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
         iter = 1;
         break;
@@ -1051,6 +1960,19 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PipelinedCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PipelinedBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
+    case FGMRES_CGS:
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config, true);
+      break;
+    case FGCRODR:
+      IterLinSol = FGCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, RestartIter,
+                                     config->GetLinear_Solver_Recycle_Dim(), false, Residual, ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = 0;
       Norm0 = LinSysRes_ptr->norm();
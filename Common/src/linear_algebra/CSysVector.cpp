@@ -232,7 +232,7 @@ ScalarType CSysVector<ScalarType>::dot(const CSysVector<ScalarType> & u) const {
   SU2_OMP_MASTER
   {
     sum = dotRes;
-    SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
   }
   /*--- Make view of result consistent across threads. ---*/
   SU2_OMP_BARRIER
@@ -247,7 +247,7 @@ ScalarType CSysVector<ScalarType>::dot(const CSysVector<ScalarType> & u) const {
       sum += vec_val[i]*u.vec_val[i];
 #ifdef HAVE_MPI
     /*--- Reduce across all mpi ranks. ---*/
-    SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 #else
     dotRes = sum;
 #endif // MPI
@@ -30,6 +30,8 @@
 int CBaseMPIWrapper::Rank = 0;
 int CBaseMPIWrapper::Size = 1;
 CBaseMPIWrapper::Comm CBaseMPIWrapper::currentComm = MPI_COMM_WORLD;
+thread_local CBaseMPIWrapper::Comm CBaseMPIWrapper::threadComm = MPI_COMM_WORLD;
+thread_local bool CBaseMPIWrapper::threadCommInUse = false;
 
 #ifdef HAVE_MPI
 int  CBaseMPIWrapper::MinRankError;
@@ -48,6 +48,7 @@
 #include "../solvers/CDiscAdjMeshSolver.hpp"
 #include "../solvers/CMeshSolver.hpp"
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/geometry/CGeometryCache.hpp"
 #include "../../../Common/include/grid_movement_structure.hpp"
 #include "../../../Common/include/CConfig.hpp"
 #include "../../../Common/include/interpolation_structure.hpp"
@@ -115,6 +116,8 @@ protected:
   CNumerics ******numerics_container;           /*!< \brief Description of the numerical method (the way in which the equations are solved). */
   CConfig **config_container;                   /*!< \brief Definition of the particular problem. */
   CConfig *driver_config;                       /*!< \brief Definition of the driver configuration. */
+  CConfig **config_instance;                    /*!< \brief Configuration of each time instance iterated concurrently (HB_CONCURRENT_INSTANCES), NULL otherwise. */
+  SU2_MPI::Comm *comm_instance;                 /*!< \brief MPI communicator of each time instance iterated concurrently. */
   COutput *driver_output;                       /*!< \brief Definition of the driver output. */
   CSurfaceMovement **surface_movement;          /*!< \brief Surface movement classes of the problem. */
   CVolumetricMovement ***grid_movement;         /*!< \brief Volume grid movement classes of the problem. */
@@ -167,6 +170,33 @@ protected:
    */
   void Geometrical_Preprocessing(CConfig *config, CGeometry **&geometry, bool dummy);
 
+  /*!
+   * \brief Check whether the time instances of a zone can use the geometry of the first instance.
+   * \note This is the case for harmonic balance if the mesh does not move between instances,
+   *       i.e. static meshes, rotating frames, steady translation, and moving walls. Instances
+   *       iterated concurrently use the buffers of the MPI comms that belong to their communicator.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if the geometry (including the multigrid levels) is shared by the instances.
+   */
+  bool Shared_InstanceGeometry(CConfig *config) const;
+
+  /*!
+   * \brief Give each time instance of a harmonic balance problem its own configuration and MPI
+   *        communicator, such that the instances can be iterated concurrently (HB_CONCURRENT_INSTANCES).
+   * \note The first instance keeps the configuration of the zone, the others get a copy of it (CConfig::CopyInstance)
+   *       once the first instance is preprocessed.
+   */
+  void ConcurrentInstance_Preprocessing();
+
+  /*!
+   * \brief Get the configuration of a time instance, indexed by zone like config_container.
+   * \param[in] val_iInst - Index of the instance.
+   * \return The configuration of the instance if they are iterated concurrently, otherwise config_container.
+   */
+  inline CConfig** GetInstance_Config(unsigned short val_iInst) const {
+    return (config_instance != NULL)? &config_instance[val_iInst] : config_container;
+  }
+
   /*!
    * \brief Do the geometrical preprocessing for the DG FEM solver.
    */
@@ -174,8 +204,9 @@ protected:
 
   /*!
    * \brief Geometrical_Preprocessing_FVM
+   * \param[out] geometry_cache - Preprocessed geometry cache, allocated if it is enabled in the config.
    */
-  void Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geometry);
+  void Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geometry, CGeometryCache *&geometry_cache);
 
   /*!
    * \brief Definition of the physics iteration class or within a single zone.
@@ -193,6 +224,13 @@ protected:
    */
   void Solver_Preprocessing(CConfig *config, CGeometry **geometry, CSolver ***&solver);
 
+  /*!
+   * \brief Print the memory used by the containers of the nodes of each solver (summed over grid levels and ranks).
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Solver_MemoryReport(CSolver ***solver, CConfig *config) const;
+
   /*!
    * \brief Restart of the solvers from the restart files.
    * \param[in] solver_container - Container vector with all the solutions.
@@ -851,6 +889,101 @@ public:
    */
   vector<passivedouble> GetVertex_UndeformedCoord(unsigned short iMarker, unsigned long iVertex);
 
+  /*--- Bulk versions of the coupling functions, they operate on all the vertices of a marker
+   *    at once. The arrays are contiguous, row-major (nVertex x nDim for vectors) and owned
+   *    by the caller; in the Python wrapper they are NumPy arrays passed without copies. ---*/
+
+  /*!
+   * \brief Get the coordinates of all the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Coordinates, nVertex x nDim.
+   * \param[in] nVertex, nVar - Dimensions of the array, must be the number of vertices and of dimensions.
+   */
+  void GetMarkerCoordinates(unsigned short iMarker, passivedouble *values, int nVertex, int nVar);
+
+  /*!
+   * \brief Set the new coordinates of all the vertices of a marker (bulk SetVertexCoordX/Y/Z and SetVertexVarCoord).
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - New coordinates, nVertex x nDim.
+   * \param[in] nVertex, nVar - Dimensions of the array, must be the number of vertices and of dimensions.
+   */
+  void SetMarkerCoordinates(unsigned short iMarker, passivedouble *values, int nVertex, int nVar);
+
+  /*!
+   * \brief Get the fluid forces on all the vertices of a marker (bulk ComputeVertexForces and GetVertexForceX/Y/Z).
+   * \note The forces of the halo vertices are zero.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Forces, nVertex x nDim.
+   * \param[in] nVertex, nVar - Dimensions of the array, must be the number of vertices and of dimensions.
+   */
+  void GetMarkerForces(unsigned short iMarker, passivedouble *values, int nVertex, int nVar);
+
+  /*!
+   * \brief Get the temperature of all the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Temperatures, nVertex.
+   * \param[in] nVertex - Size of the array, must be the number of vertices.
+   */
+  void GetMarkerTemperatures(unsigned short iMarker, passivedouble *values, int nVertex);
+
+  /*!
+   * \brief Set the wall temperature of all the vertices of a marker.
+   * \note The marker must be an isothermal marker listed in MARKER_PYTHON_CUSTOM.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Temperatures, nVertex.
+   * \param[in] nVertex - Size of the array, must be the number of vertices.
+   */
+  void SetMarkerTemperatures(unsigned short iMarker, passivedouble *values, int nVertex);
+
+  /*!
+   * \brief Get the normal heat flux of all the vertices of a marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Normal heat fluxes, nVertex.
+   * \param[in] nVertex - Size of the array, must be the number of vertices.
+   */
+  void GetMarkerNormalHeatFluxes(unsigned short iMarker, passivedouble *values, int nVertex);
+
+  /*!
+   * \brief Set the wall normal heat flux of all the vertices of a marker.
+   * \note The marker must be a heat flux marker listed in MARKER_PYTHON_CUSTOM.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Normal heat fluxes, nVertex.
+   * \param[in] nVertex - Size of the array, must be the number of vertices.
+   */
+  void SetMarkerNormalHeatFluxes(unsigned short iMarker, passivedouble *values, int nVertex);
+
+  /*!
+   * \brief Set the mesh displacement of all the vertices of a marker (bulk SetMeshDisplacement).
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Displacements, nVertex x nDim.
+   * \param[in] nVertex, nVar - Dimensions of the array, must be the number of vertices and of dimensions.
+   */
+  void SetMarkerMeshDisplacements(unsigned short iMarker, passivedouble *values, int nVertex, int nVar);
+
+  /*!
+   * \brief Set the loads of the structural solver on all the vertices of a marker (bulk SetFEA_Loads).
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Loads, nVertex x nDim.
+   * \param[in] nVertex, nVar - Dimensions of the array, must be the number of vertices and of dimensions.
+   */
+  void SetMarkerFEALoads(unsigned short iMarker, passivedouble *values, int nVertex, int nVar);
+
+  /*!
+   * \brief Get the structural displacements of all the vertices of a marker (bulk GetFEA_Displacements).
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Displacements, nVertex x nDim.
+   * \param[in] nVertex, nVar - Dimensions of the array, must be the number of vertices and of dimensions.
+   */
+  void GetMarkerFEADisplacements(unsigned short iMarker, passivedouble *values, int nVertex, int nVar);
+
+  /*!
+   * \brief Get the flow loads of all the vertices of a marker (bulk GetFlowLoad).
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Loads, nVertex x nDim.
+   * \param[in] nVertex, nVar - Dimensions of the array, must be the number of vertices and of dimensions.
+   */
+  void GetMarkerFlowLoads(unsigned short iMarker, passivedouble *values, int nVertex, int nVar);
+
 };
 
 /*!
@@ -34,6 +34,8 @@
 #include <iostream>
 #include <string>
 #include <cmath>
+#include <vector>
+#include <memory>
 
 #define LEN_COMPONENTS 32
 
@@ -545,28 +547,28 @@ public:
   virtual ~CPengRobinson(void);
 
   /*!
-   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \brief Set the Dimensionless State using Density and Internal Energy (source model).
    * \param[in] rho - first thermodynamic variable.
    * \param[in] e - second thermodynamic variable.
    */
   void SetTDState_rhoe (su2double rho, su2double e );
 
   /*!
-   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \brief Set the Dimensionless State using Pressure and Temperature (source model).
    * \param[in] P - first thermodynamic variable.
    * \param[in] T - second thermodynamic variable.
    */
   void SetTDState_PT (su2double P, su2double T );
 
   /*!
-   * \brief Set the Dimensionless State using Pressure and Density
+   * \brief Set the Dimensionless State using Pressure and Density (source model).
    * \param[in] P - first thermodynamic variable.
    * \param[in] rho - second thermodynamic variable.
    */
   void SetTDState_Prho (su2double P, su2double rho );
 
   /*!
-   * \brief Set the Dimensionless Energy using Pressure and Density
+   * \brief Set the Dimensionless Energy using Pressure and Density (source model).
    * \param[in] P - first thermodynamic variable.
    * \param[in] rho - second thermodynamic variable.
    */
@@ -608,6 +610,281 @@ public:
 
 };
 
+/*!
+ * \class CFluidTable
+ * \brief Structured 2D table of thermodynamic properties with bicubic (Catmull-Rom) interpolation.
+ * \details The nodes are uniformly spaced and the values of each node are stored contiguously.
+ *          One layer of ghost nodes surrounds the table so that the 4x4 interpolation stencil
+ *          is available on the whole domain. Invalid nodes are stored as NaN.
+ */
+class CFluidTable {
+public:
+  enum { MAXVAR = 16 };          /*!< \brief Maximum number of values per node. */
+
+private:
+  unsigned long nX, nY;          /*!< \brief Number of nodes in each direction, including the ghost layers. */
+  unsigned short nVar;           /*!< \brief Number of values per node. */
+  passivedouble xMin, yMin,      /*!< \brief Coordinates of the first interior node. */
+  Delta_x, Delta_y;              /*!< \brief Spacing of the nodes. */
+  vector<passivedouble> data;    /*!< \brief Values of the nodes, [(j*nX+i)*nVar + iVar]. */
+
+public:
+  /*!
+   * \brief Allocate the table.
+   * \param[in] val_nX - Number of interior nodes in the x direction.
+   * \param[in] val_nY - Number of interior nodes in the y direction.
+   * \param[in] val_nVar - Number of values per node.
+   * \param[in] x0, x1, y0, y1 - Extent of the interior of the table.
+   */
+  void Initialize(unsigned long val_nX, unsigned long val_nY, unsigned short val_nVar,
+                  passivedouble x0, passivedouble x1, passivedouble y0, passivedouble y1);
+
+  /*!
+   * \brief Number of nodes (including ghosts) in each direction.
+   */
+  inline unsigned long GetnX(void) const { return nX; }
+  inline unsigned long GetnY(void) const { return nY; }
+
+  /*!
+   * \brief Number of values per node.
+   */
+  inline unsigned short GetnVar(void) const { return nVar; }
+
+  /*!
+   * \brief Coordinates of a node, the ghost nodes have indices 0 and nX-1 (nY-1).
+   */
+  inline passivedouble GetX(unsigned long i) const { return xMin + (long(i)-1)*Delta_x; }
+  inline passivedouble GetY(unsigned long j) const { return yMin + (long(j)-1)*Delta_y; }
+
+  /*!
+   * \brief Spacing of the nodes.
+   */
+  inline passivedouble GetDelta_x(void) const { return Delta_x; }
+  inline passivedouble GetDelta_y(void) const { return Delta_y; }
+
+  /*!
+   * \brief Access the values of a node.
+   */
+  inline passivedouble* GetNode(unsigned long i, unsigned long j) { return &data[(j*nX+i)*nVar]; }
+  inline const passivedouble* GetNode(unsigned long i, unsigned long j) const { return &data[(j*nX+i)*nVar]; }
+
+  /*!
+   * \brief Access the storage of the table (for communication and file IO).
+   */
+  inline vector<passivedouble>& GetData(void) { return data; }
+  inline const vector<passivedouble>& GetData(void) const { return data; }
+
+  /*!
+   * \brief Interpolate the values, and optionally their derivatives, at a point.
+   * \param[in] x, y - Coordinates of the point.
+   * \param[out] val - Interpolated values (nValues).
+   * \param[out] dvdx, dvdy - Derivatives of the interpolant (nValues), not computed if NULL.
+   * \param[in] nValues - Only the first nValues values of each node are interpolated.
+   * \return False if the point is outside the table or the stencil contains invalid nodes.
+   */
+  bool Interpolate(su2double x, su2double y, su2double *val, su2double *dvdx = NULL,
+                   su2double *dvdy = NULL, unsigned short nValues = MAXVAR) const;
+
+  /*!
+   * \brief Write the table to an open binary file.
+   */
+  void Write(FILE *fhw) const;
+
+  /*!
+   * \brief Read the table from an open binary file.
+   * \return False if the file does not contain a complete table.
+   */
+  bool Read(FILE *fhw);
+};
+
+/*!
+ * \class CLookUpTableFluid
+ * \brief Tabulated version of a (real gas) fluid model.
+ * \details The properties of the source model are tabulated on a structured grid in
+ *          (log(rho), e). The input pairs that the models invert iteratively (h-s, P-s)
+ *          use inverse tables to obtain an initial guess that is polished with Newton
+ *          iterations on the interpolant. The models evaluate the other pairs (rho-e, P-rho,
+ *          P-T, rho-T) in closed form, faster than the table search, so they are passed to the
+ *          source model. States outside the tables (or that do not converge) are computed by
+ *          the source model.
+ *          The tables are read-only and shared by all the instances with the same key
+ *          (multigrid levels, thread copies), and they can be stored in a file.
+ */
+class CLookUpTableFluid : public CFluidModel {
+public:
+  /*!
+   * \brief Values stored by the table in (log(rho), e), the ones used by the
+   *        Newton iterations come first since only those are interpolated there.
+   */
+  enum ENUM_TABLE_VAR {PRESSURE = 0, TEMPERATURE, ENTROPY, SOUNDSPEED2, DPDRHO_E, DPDE_RHO,
+                       DTDRHO_E, DTDE_RHO, CP, CV, N_TABLE_VARS};
+
+  /*!
+   * \brief Input pairs with an inverse table, the values stored are (log(rho), e).
+   */
+  enum ENUM_TABLE_PAIR {PAIR_HS = 0,    /*!< \brief (h, s). */
+                        PAIR_PS,        /*!< \brief (log(P), s). */
+                        N_TABLE_PAIRS};
+
+private:
+  /*!
+   * \brief Set of tables built for one source model.
+   */
+  struct CTableSet {
+    vector<passivedouble> key;           /*!< \brief Parameters and fingerprint of the source model. */
+    CFluidTable state;                   /*!< \brief Properties in (log(rho), e). */
+    CFluidTable inverse[N_TABLE_PAIRS];  /*!< \brief Initial guess of (log(rho), e) for the other pairs. */
+  };
+
+  static shared_ptr<const CTableSet> LastTables; /*!< \brief Most recently built tables, reused when the key matches. */
+
+  shared_ptr<const CTableSet> Tables;  /*!< \brief Tables used by this instance. */
+  CFluidModel *Source;                 /*!< \brief Exact model, used to build the tables and outside of them. */
+
+  /*!
+   * \brief Coordinates of a state in the space of an input pair.
+   * \param[in] iPair - Input pair.
+   * \param[in] x, e - Coordinates in the main table.
+   * \param[in] val - Properties of the state.
+   * \param[in] dvdx, dvdy - Derivatives of the properties, the Jacobian is not computed if NULL.
+   * \param[out] a, b - Coordinates of the pair.
+   * \param[out] jac - Derivatives of (a,b) w.r.t. (x,e), row-major.
+   */
+  static void PairCoordinates(unsigned short iPair, su2double x, su2double e, const su2double *val,
+                              const su2double *dvdx, const su2double *dvdy,
+                              su2double &a, su2double &b, su2double *jac);
+
+  /*!
+   * \brief Find the state corresponding to a value of an input pair with Newton iterations on the main table.
+   * \param[in] tables - Set of tables.
+   * \param[in] iPair - Input pair.
+   * \param[in] a, b - Value of the pair.
+   * \param[in,out] x, e - Initial guess and solution in the main table.
+   * \param[out] val - Properties of the solution.
+   * \return False if the iterations leave the table or do not converge.
+   */
+  static bool Newton(const CTableSet &tables, unsigned short iPair, su2double a, su2double b,
+                     su2double &x, su2double &e, su2double *val);
+
+  /*!
+   * \brief Compute the tables, the nodes are split among the ranks.
+   * \param[in,out] tables - Set of tables, the key must be set.
+   * \param[in] nRho, nEnergy - Number of points in each direction.
+   * \param[in] rhoRange, TRange - Dimensionless density and temperature ranges.
+   */
+  void BuildTables(CTableSet &tables, unsigned long nRho, unsigned long nEnergy,
+                   const su2double *rhoRange, const su2double *TRange);
+
+  /*!
+   * \brief Reuse, load or build the tables for the source model.
+   * \param[in] nDensity, nEnergy - Number of points in each direction.
+   * \param[in] rhoRange, TRange - Dimensionless density and temperature ranges.
+   * \param[in] fileName - File that stores the tables.
+   */
+  void SetTables(unsigned short nDensity, unsigned short nEnergy,
+                 const su2double *rhoRange, const su2double *TRange, string fileName);
+
+  /*!
+   * \brief Set the state from the properties interpolated in the main table.
+   * \param[in] rho, e - Density and static energy of the state.
+   * \param[in] val - Interpolated properties.
+   */
+  void SetState(su2double rho, su2double e, const su2double *val);
+
+  /*!
+   * \brief Copy the state of the source model.
+   */
+  void CopySourceState(void);
+
+  /*!
+   * \brief Solve a pair with the tables, or with the source model as a fallback.
+   * \return True if the tables were used.
+   */
+  bool SolvePair(unsigned short iPair, su2double a, su2double b);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] source - Fluid model to tabulate, the object takes ownership of it.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] rho_ref, T_ref - Dimensionless free-stream density and temperature, used for the default ranges.
+   */
+  CLookUpTableFluid(CFluidModel *source, CConfig *config, su2double rho_ref, su2double T_ref);
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] source - Fluid model to tabulate, the object takes ownership of it.
+   * \param[in] nDensity, nEnergy - Number of points in each direction.
+   * \param[in] rhoRange, TRange - Density and temperature ranges.
+   * \param[in] fileName - File that stores the tables.
+   */
+  CLookUpTableFluid(CFluidModel *source, unsigned short nDensity, unsigned short nEnergy,
+                    const su2double *rhoRange, const su2double *TRange, string fileName);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CLookUpTableFluid(void);
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe (su2double rho, su2double e );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT (su2double P, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless Energy using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho (su2double P, su2double rho );
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs (su2double h, su2double s );
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature (source model).
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT (su2double rho, su2double T );
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps (su2double P, su2double s );
+
+  /*!
+   * \brief Compute some derivatives of enthalpy and entropy needed for subsonic inflow BC (source model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void ComputeDerivativeNRBC_Prho (su2double P, su2double rho );
+
+};
+
 /*!
  * \class CConstantDensity
  * \brief Child class for defining a constant density gas model (incompressible only).
@@ -26,9 +26,280 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/omp_structure.hpp"
 
 
+/*!
+ * \brief Compute S := inv(R)*transpose(inv(R)), from the entries of the upper triangular
+ *        matrix R of the QR decomposition of the least-squares system.
+ * \note Returns a null matrix if R is singular.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] r11 ... r33 - Entries of the accumulated R matrix (see computeGradientsLeastSquares).
+ * \param[out] Smatrix - The resulting matrix.
+ */
+inline void computeLeastSquaresSmatrix(size_t nDim, su2double r11, su2double r12, su2double r13,
+                                       su2double r22, su2double r23_a, su2double r23_b,
+                                       su2double r33, su2double Smatrix[][3])
+{
+  su2double r23 = 0.0;
+
+  if (r11 >= 0.0) r11 = sqrt(r11);
+  if (r11 >= 0.0) r12 /= r11; else r12 = 0.0;
+  su2double tmp = r22-r12*r12;
+  if (tmp >= 0.0) r22 = sqrt(tmp); else r22 = 0.0;
+
+  if (nDim == 3) {
+    if (r11 >= 0.0) r13 /= r11; else r13 = 0.0;
+
+    if ((r22 >= 0.0) && (r11*r22 >= 0.0)) {
+      r23 = r23_a/r22 - r23_b*r12/(r11*r22);
+    } else {
+      r23 = 0.0;
+    }
+
+    tmp = r33 - r23*r23 - r13*r13;
+    if (tmp >= 0.0) r33 = sqrt(tmp); else r33 = 0.0;
+  }
+
+  /*--- Compute determinant ---*/
+
+  su2double detR2 = (r11*r22)*(r11*r22);
+  if (nDim == 3) detR2 *= r33*r33;
+
+  /*--- Detect singular matrices ---*/
+
+  bool singular = false;
+
+  if (detR2 <= EPS) {
+    detR2 = 1.0;
+    singular = true;
+  }
+
+  /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+
+  if (singular) {
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        Smatrix[iDim][jDim] = 0.0;
+  }
+  else {
+    if (nDim == 2) {
+      Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+      Smatrix[0][1] = -r11*r12/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = r11*r11/detR2;
+    }
+    else {
+      su2double z11 = r22*r33;
+      su2double z12 =-r12*r33;
+      su2double z13 = r12*r23-r13*r22;
+      su2double z22 = r11*r33;
+      su2double z23 =-r11*r23;
+      su2double z33 = r11*r22;
+
+      Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+      Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+      Smatrix[0][2] = (z13*z33)/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+      Smatrix[1][2] = (z23*z33)/detR2;
+      Smatrix[2][0] = Smatrix[0][2];
+      Smatrix[2][1] = Smatrix[1][2];
+      Smatrix[2][2] = (z33*z33)/detR2;
+    }
+  }
+}
+
+
+/*!
+ * \brief Compute the geometric weights of least-squares gradients, the gradient
+ *        at point i is then the sum over its neighbors j of w_ij * (u_j - u_i).
+ * \note The weights of each edge are stored as [w_ij (nDim values), w_ji (nDim values)],
+ *       with i = edge->GetNode(0), only the weights of domain points are computed.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[out] weights - The weights, nEdge x 2*nDim.
+ */
+inline void computeLeastSquaresWeights(CGeometry& geometry, bool weighted, su2activematrix& weights)
+{
+  constexpr size_t MAXNDIM = 3;
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const size_t nDim = geometry.GetnDim();
+
+  weights.resize(geometry.GetnEdge(), 2*nDim);
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    {
+      auto node = geometry.node[iPoint];
+      const su2double* coord_i = node->GetCoord();
+
+      /*--- Same accumulation of R as in computeGradientsLeastSquares. ---*/
+
+      su2double Rmatrix[MAXNDIM][MAXNDIM] = {{0.0}};
+
+      for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+      {
+        const su2double* coord_j = geometry.node[node->GetPoint(iNeigh)]->GetCoord();
+
+        su2double dist_ij[MAXNDIM] = {0.0};
+        su2double weight = (weighted)? 0.0 : 1.0;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          dist_ij[iDim] = coord_j[iDim] - coord_i[iDim];
+          if (weighted) weight += dist_ij[iDim] * dist_ij[iDim];
+        }
+
+        if (weight > 0.0)
+        {
+          weight = 1.0 / weight;
+
+          Rmatrix[0][0] += dist_ij[0]*dist_ij[0]*weight;
+          Rmatrix[0][1] += dist_ij[0]*dist_ij[1]*weight;
+          Rmatrix[1][1] += dist_ij[1]*dist_ij[1]*weight;
+
+          if (nDim == 3)
+          {
+            Rmatrix[0][2] += dist_ij[0]*dist_ij[2]*weight;
+            Rmatrix[1][2] += dist_ij[1]*dist_ij[2]*weight;
+            Rmatrix[2][1] += dist_ij[0]*dist_ij[2]*weight;
+            Rmatrix[2][2] += dist_ij[2]*dist_ij[2]*weight;
+          }
+        }
+      }
+
+      su2double Smatrix[MAXNDIM][MAXNDIM];
+
+      computeLeastSquaresSmatrix(nDim, Rmatrix[0][0], Rmatrix[0][1], Rmatrix[0][2], Rmatrix[1][1],
+                                 Rmatrix[1][2], Rmatrix[2][1], Rmatrix[2][2], Smatrix);
+
+      /*--- Weight of each neighbor, w_ij := S * dist_ij * weight. ---*/
+
+      for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+      {
+        const size_t iEdge = node->GetEdge(iNeigh);
+        const size_t offset = (geometry.edge[iEdge]->GetNode(0) == iPoint)? 0 : nDim;
+        const su2double* coord_j = geometry.node[node->GetPoint(iNeigh)]->GetCoord();
+
+        su2double dist_ij[MAXNDIM] = {0.0};
+        su2double weight = (weighted)? 0.0 : 1.0;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          dist_ij[iDim] = coord_j[iDim] - coord_i[iDim];
+          if (weighted) weight += dist_ij[iDim] * dist_ij[iDim];
+        }
+
+        if (weight > 0.0) weight = 1.0 / weight;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+        {
+          weights(iEdge, offset+iDim) = 0.0;
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            weights(iEdge, offset+iDim) += Smatrix[iDim][jDim] * dist_ij[jDim] * weight;
+        }
+      }
+    }
+  } // end SU2_OMP_PARALLEL
+}
+
+
+/*!
+ * \brief Compute the gradient of a field using precomputed least-squares weights.
+ * \note See computeGradientsLeastSquares, the result is the same (up to round-off)
+ *       when there are no periodic boundaries.
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication required.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] weights - Weights from computeLeastSquaresWeights.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ */
+template<class FieldType, class GradientType>
+void computeGradientsLeastSquaresPrecomputed(CSolver* solver,
+                                             MPI_QUANTITIES kindMpiComm,
+                                             CGeometry& geometry,
+                                             CConfig& config,
+                                             const su2activematrix& weights,
+                                             const FieldType& field,
+                                             size_t varBegin,
+                                             size_t varEnd,
+                                             GradientType& gradient)
+{
+  constexpr size_t MAXNVAR = 32;
+
+  size_t nPointDomain = geometry.GetnPointDomain();
+  size_t nDim = geometry.GetnDim();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    {
+      auto node = geometry.node[iPoint];
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
+
+      for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+      {
+        const size_t jPoint = node->GetPoint(iNeigh);
+        const size_t iEdge = node->GetEdge(iNeigh);
+        const size_t offset = (geometry.edge[iEdge]->GetNode(0) == iPoint)? 0 : nDim;
+        const su2double* w_ij = &weights(iEdge, offset);
+
+        /*--- Blocks of variables to keep the differences in registers. ---*/
+
+        for (size_t iVar = varBegin; iVar < varEnd; iVar += MAXNVAR)
+        {
+          const size_t nVarBlk = min(MAXNVAR, varEnd-iVar);
+          su2double delta_ij[MAXNVAR];
+
+          for (size_t k = 0; k < nVarBlk; ++k)
+            delta_ij[k] = field(jPoint,iVar+k) - field(iPoint,iVar+k);
+
+          for (size_t k = 0; k < nVarBlk; ++k)
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint, iVar+k, iDim) += w_ij[iDim] * delta_ij[k];
+        }
+      }
+    }
+  } // end SU2_OMP_PARALLEL
+
+  /*--- If no solver was provided we do not communicate ---*/
+
+  if (solver == nullptr) return;
+
+  /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+
+  solver->InitiateComms(&geometry, &config, kindMpiComm);
+  solver->CompleteComms(&geometry, &config, kindMpiComm);
+
+}
+
+
 /*!
  * \brief Compute the gradient of a field using inverse-distance-weighted or
  *        unweighted Least-Squares approximation.
@@ -60,6 +331,21 @@ void computeGradientsLeastSquares(CSolver* solver,
 {
   constexpr size_t MAXNDIM = 3;
 
+  /*--- The geometric part can be computed once if the periodic corrections to
+   R are not needed, and derivatives w.r.t. the coordinates are not recorded. ---*/
+
+  if (config.GetLeastSquaresPrecomputed() && !config.GetAD_Mode() &&
+      (config.GetnMarker_Periodic() == 0))
+  {
+    auto& weights = geometry.GetLeastSquaresWeights(weighted);
+
+    if (weights.empty()) computeLeastSquaresWeights(geometry, weighted, weights);
+
+    computeGradientsLeastSquaresPrecomputed(solver, kindMpiComm, geometry, config,
+                                            weights, field, varBegin, varEnd, gradient);
+    return;
+  }
+
   size_t nPointDomain = geometry.GetnPointDomain();
   size_t nDim = geometry.GetnDim();
 
@@ -192,18 +478,13 @@ void computeGradientsLeastSquares(CSolver* solver,
       su2double r11 = Rmatrix(iPoint,0,0);
       su2double r12 = Rmatrix(iPoint,0,1);
       su2double r22 = Rmatrix(iPoint,1,1);
-      su2double r13 = 0.0, r23 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
+      su2double r13 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
 
       AD::StartPreacc();
       AD::SetPreaccIn(r11);
       AD::SetPreaccIn(r12);
       AD::SetPreaccIn(r22);
 
-      if (r11 >= 0.0) r11 = sqrt(r11);
-      if (r11 >= 0.0) r12 /= r11; else r12 = 0.0;
-      su2double tmp = r22-r12*r12;
-      if (tmp >= 0.0) r22 = sqrt(tmp); else r22 = 0.0;
-
       if (nDim == 3) {
         r13   = Rmatrix(iPoint,0,2);
         r23_a = Rmatrix(iPoint,1,2);
@@ -214,68 +495,13 @@ void computeGradientsLeastSquares(CSolver* solver,
         AD::SetPreaccIn(r23_a);
         AD::SetPreaccIn(r23_b);
         AD::SetPreaccIn(r33);
-
-        if (r11 >= 0.0) r13 /= r11; else r13 = 0.0;
-
-        if ((r22 >= 0.0) && (r11*r22 >= 0.0)) {
-          r23 = r23_a/r22 - r23_b*r12/(r11*r22);
-        } else {
-          r23 = 0.0;
-        }
-
-        tmp = r33 - r23*r23 - r13*r13;
-        if (tmp >= 0.0) r33 = sqrt(tmp); else r33 = 0.0;
-      }
-
-      /*--- Compute determinant ---*/
-
-      su2double detR2 = (r11*r22)*(r11*r22);
-      if (nDim == 3) detR2 *= r33*r33;
-
-      /*--- Detect singular matrices ---*/
-
-      bool singular = false;
-
-      if (detR2 <= EPS) {
-        detR2 = 1.0;
-        singular = true;
       }
 
       /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
 
       su2double Smatrix[MAXNDIM][MAXNDIM];
 
-      if (singular) {
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          for (size_t jDim = 0; jDim < nDim; ++jDim)
-            Smatrix[iDim][jDim] = 0.0;
-      }
-      else {
-        if (nDim == 2) {
-          Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-          Smatrix[0][1] = -r11*r12/detR2;
-          Smatrix[1][0] = Smatrix[0][1];
-          Smatrix[1][1] = r11*r11/detR2;
-        }
-        else {
-          su2double z11 = r22*r33;
-          su2double z12 =-r12*r33;
-          su2double z13 = r12*r23-r13*r22;
-          su2double z22 = r11*r33;
-          su2double z23 =-r11*r23;
-          su2double z33 = r11*r22;
-
-          Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-          Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-          Smatrix[0][2] = (z13*z33)/detR2;
-          Smatrix[1][0] = Smatrix[0][1];
-          Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-          Smatrix[1][2] = (z23*z33)/detR2;
-          Smatrix[2][0] = Smatrix[0][2];
-          Smatrix[2][1] = Smatrix[1][2];
-          Smatrix[2][2] = (z33*z33)/detR2;
-        }
-      }
+      computeLeastSquaresSmatrix(nDim, r11, r12, r13, r22, r23_a, r23_b, r33, Smatrix);
 
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         for (size_t jDim = 0; jDim < nDim; ++jDim)
@@ -212,12 +212,12 @@ struct CLimiterDetails<VENKATAKRISHNAN_WANG>
 
       /*--- Global reduction, (re)using eps2 as the recv buffer. ---*/
 
-      SU2_MPI::Allreduce(fieldMin[0], eps2.data(), nCols, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(fieldMin[0], eps2.data(), nCols, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
 
       for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
         fieldMin(0,iVar) = eps2(iVar);
 
-      SU2_MPI::Allreduce(fieldMax[0], eps2.data(), nCols, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(fieldMax[0], eps2.data(), nCols, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 
       for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
         fieldMax(0,iVar) = eps2(iVar);
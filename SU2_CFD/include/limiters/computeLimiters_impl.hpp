@@ -76,7 +76,9 @@ void computeLimiters_impl(CSolver* solver,
   constexpr size_t MAXNDIM = 3;
   constexpr size_t MAXNVAR = 8;
 
-  if (varEnd > MAXNVAR)
+  const size_t nVar = varEnd - varBegin;
+
+  if (nVar > MAXNVAR)
     SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
 
   CLimiterDetails<LimiterKind> limiterDetails;
@@ -145,69 +147,78 @@ void computeLimiters_impl(CSolver* solver,
     for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
     {
       auto node = geometry.node[iPoint];
-      const su2double* coord_i = node->GetCoord();
 
       AD::StartPreacc();
-      AD::SetPreaccIn(coord_i, nDim);
 
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      /*--- Local (contiguous in the variables) buffers for the min/max values,
+       *    the min/max projections, and the gradient of iPoint. The latter is
+       *    transposed so that the projections vectorize across variables. ---*/
+
+      su2double valMax[MAXNVAR], valMin[MAXNVAR], projMax[MAXNVAR], projMin[MAXNVAR];
+      su2double gradT[MAXNDIM][MAXNVAR];
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
       {
-        AD::SetPreaccIn(field(iPoint,iVar));
+        AD::SetPreaccIn(field(iPoint,varBegin+iVar));
 
         if (periodic) {
           /*--- Started outside loop, so counts as input. ---*/
-          AD::SetPreaccIn(fieldMax(iPoint,iVar));
-          AD::SetPreaccIn(fieldMin(iPoint,iVar));
+          AD::SetPreaccIn(fieldMax(iPoint,varBegin+iVar));
+          AD::SetPreaccIn(fieldMin(iPoint,varBegin+iVar));
+          valMax[iVar] = fieldMax(iPoint,varBegin+iVar);
+          valMin[iVar] = fieldMin(iPoint,varBegin+iVar);
         }
         else {
           /*--- Initialize min/max now for iPoint if not periodic. ---*/
-          fieldMax(iPoint,iVar) = field(iPoint,iVar);
-          fieldMin(iPoint,iVar) = field(iPoint,iVar);
+          valMax[iVar] = valMin[iVar] = field(iPoint,varBegin+iVar);
         }
 
-        for(size_t iDim = 0; iDim < nDim; ++iDim)
-          AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
-      }
-
-      /*--- Initialize min/max projection out of iPoint. ---*/
-
-      su2double projMax[MAXNVAR], projMin[MAXNVAR];
-
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        /*--- Initialize min/max projection out of iPoint. ---*/
         projMax[iVar] = projMin[iVar] = 0.0;
 
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          AD::SetPreaccIn(gradient(iPoint,varBegin+iVar,iDim));
+          gradT[iDim][iVar] = gradient(iPoint,varBegin+iVar,iDim);
+        }
+      }
+
       /*--- Compute max/min projection and values over direct neighbors. ---*/
 
-      for(size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+      for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
       {
         size_t jPoint = node->GetPoint(iNeigh);
+        size_t iEdge = node->GetEdge(iNeigh);
 
-        const su2double* coord_j = geometry.node[jPoint]->GetCoord();
-        AD::SetPreaccIn(coord_j, nDim);
+        /*--- Distance vector from iPoint to face (middle of the edge),
+         *    precomputed by the geometry from the first node of the edge. ---*/
 
-        /*--- Distance vector from iPoint to face (middle of the edge). ---*/
+        const su2double* halfVector = geometry.GetEdgeHalfVector(iEdge);
+        AD::SetPreaccIn(halfVector, nDim);
+
+        const su2double sign = (geometry.edge[iEdge]->GetNode(0) == iPoint)? 1.0 : -1.0;
 
         su2double dist_ij[MAXNDIM] = {0.0};
 
-        for(size_t iDim = 0; iDim < nDim; ++iDim)
-          dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim] = sign * halfVector[iDim];
 
-        /*--- Project each variable, update min/max. ---*/
+        /*--- Project all variables, update min/max. ---*/
 
-        for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
-        {
-          su2double proj = 0.0;
+        su2double proj[MAXNVAR] = {0.0};
 
-          for(size_t iDim = 0; iDim < nDim; ++iDim)
-            proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          for (size_t iVar = 0; iVar < nVar; ++iVar)
+            proj[iVar] += dist_ij[iDim] * gradT[iDim][iVar];
 
-          projMax[iVar] = max(projMax[iVar], proj);
-          projMin[iVar] = min(projMin[iVar], proj);
+        for (size_t iVar = 0; iVar < nVar; ++iVar)
+        {
+          projMax[iVar] = max(projMax[iVar], proj[iVar]);
+          projMin[iVar] = min(projMin[iVar], proj[iVar]);
 
-          AD::SetPreaccIn(field(jPoint,iVar));
+          AD::SetPreaccIn(field(jPoint,varBegin+iVar));
 
-          fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
-          fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+          valMax[iVar] = max(valMax[iVar], field(jPoint,varBegin+iVar));
+          valMin[iVar] = min(valMin[iVar], field(jPoint,varBegin+iVar));
         }
       }
 
@@ -218,17 +229,20 @@ void computeLimiters_impl(CSolver* solver,
       /*--- Final limiter computation for each variable, get the min limiter
        *    out of the positive/negative projections and deltas. ---*/
 
-      for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
       {
-        su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
-                           fieldMax(iPoint,iVar) - field(iPoint,iVar));
+        const size_t kVar = varBegin+iVar;
+
+        fieldMax(iPoint,kVar) = valMax[iVar];
+        fieldMin(iPoint,kVar) = valMin[iVar];
+
+        su2double limMax = limiterDetails.limiterFunction(kVar, projMax[iVar], valMax[iVar] - field(iPoint,kVar));
 
-        su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
-                           fieldMin(iPoint,iVar) - field(iPoint,iVar));
+        su2double limMin = limiterDetails.limiterFunction(kVar, projMin[iVar], valMin[iVar] - field(iPoint,kVar));
 
-        limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+        limiter(iPoint,kVar) = geoFactor * min(limMax, limMin);
 
-        AD::SetPreaccOut(limiter(iPoint,iVar));
+        AD::SetPreaccOut(limiter(iPoint,kVar));
       }
 
       AD::EndPreacc();
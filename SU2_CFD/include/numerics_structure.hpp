@@ -59,6 +59,9 @@ protected:
   su2double *Enthalpy_formation; /*!< \brief Enthalpy of formation. */
   su2double Prandtl_Lam;         /*!< \brief Laminar Prandtl's number. */
   su2double Prandtl_Turb;        /*!< \brief Turbulent Prandtl's number. */
+  bool implicit;                 /*!< \brief Implicit calculation (compute Jacobians). */
+  bool jacobian_frozen;          /*!< \brief The Jacobians are skipped while the solver lags its Jacobian matrix. */
+  bool implicit_unfrozen;        /*!< \brief Value of implicit before the Jacobians were frozen. */
   
 public:
   
@@ -273,6 +276,17 @@ public:
    * \brief Destructor of the class.
    */
   virtual ~CNumerics(void);
+
+  /*!
+   * \brief Skip the computation of the Jacobians while the solver lags its Jacobian matrix (JACOBIAN_LAG_ITER).
+   * \param[in] frozen - True if the Jacobian matrix of the solver is not updated, false to compute the Jacobians again.
+   */
+  inline void SetJacobianFrozen(bool frozen) {
+    if (frozen == jacobian_frozen) return;
+    if (frozen) implicit_unfrozen = implicit;
+    implicit = frozen? false : implicit_unfrozen;
+    jacobian_frozen = frozen;
+  }
   
   /*!
    * \brief Compute the determinant of a 3 by 3 matrix.
@@ -1487,7 +1501,6 @@ class CUpwCUSP_Flow : public CNumerics {
   
 private:
   su2double *Velocity_i, *Velocity_j, *ProjFlux_i, *ProjFlux_j;
-  bool implicit;
   
 public:
   
@@ -1523,7 +1536,7 @@ public:
  */
 class CUpwRoeBase_Flow : public CNumerics {
 protected:
-  bool implicit, dynamic_grid, roe_low_dissipation;
+  bool dynamic_grid, roe_low_dissipation;
   su2double *Velocity_i, *Velocity_j, *ProjFlux_i, *ProjFlux_j, *Conservatives_i, *Conservatives_j;
   su2double *Diff_U, *Lambda, **P_Tensor, **invP_Tensor;
   su2double *RoeVelocity, RoeDensity, RoeEnthalpy, RoeSoundSpeed, ProjVelocity, RoeSoundSpeed2, kappa;
@@ -1609,7 +1622,7 @@ public:
 class CUpwGeneralRoe_Flow : public CNumerics {
 private:
 
-  bool implicit, dynamic_grid;
+  bool dynamic_grid;
 
   su2double *Diff_U;
   su2double *Velocity_i, *Velocity_j, *RoeVelocity;
@@ -1733,7 +1746,6 @@ public:
  */
 class CUpwMSW_Flow : public CNumerics {
 private:
-  bool implicit;
   su2double *Diff_U;
   su2double *u_i, *u_j, *ust_i, *ust_j;
   su2double *Fc_i, *Fc_j;
@@ -1777,7 +1789,7 @@ public:
  */
 class CUpwTurkel_Flow : public CNumerics {
 private:
-  bool implicit, dynamic_grid;
+  bool dynamic_grid;
   su2double *Diff_U;
   su2double *Velocity_i, *Velocity_j, *RoeVelocity;
   su2double *ProjFlux_i, *ProjFlux_j;
@@ -1826,8 +1838,7 @@ public:
  */
 class CUpwFDSInc_Flow : public CNumerics {
 private:
-  bool implicit,     /*!< \brief Implicit calculation. */
-  dynamic_grid,      /*!< \brief Modification for grid movement. */
+  bool dynamic_grid, /*!< \brief Modification for grid movement. */
   variable_density,  /*!< \brief Variable density incompressible flows. */
   energy;            /*!< \brief computation with the energy equation. */
   su2double *Diff_V;
@@ -1887,7 +1898,7 @@ private:
   su2double RoeDensity, RoeSoundSpeed, *RoeVelocity, *Lambda, *Velocity_i, *Velocity_j, **ProjFlux_i, **ProjFlux_j,
   Proj_ModJac_Tensor_ij, **Proj_ModJac_Tensor, Energy_i, Energy_j, **P_Tensor, **invP_Tensor;
   unsigned short iDim, iVar, jVar, kVar;
-  bool implicit, grid_movement;
+  bool grid_movement;
   
 public:
   
@@ -1926,7 +1937,6 @@ public:
  */
 class CUpwAUSM_Flow : public CNumerics {
 private:
-  bool implicit;
   su2double *Diff_U;
   su2double *Velocity_i, *Velocity_j, *RoeVelocity;
   su2double *ProjFlux_i, *ProjFlux_j;
@@ -1972,7 +1982,6 @@ public:
  */
 class CUpwAUSMPLUS_SLAU_Base_Flow : public CNumerics {
 protected:
-  bool implicit;
   bool UseAccurateJacobian;
   bool HasAnalyticalDerivatives;
   su2double FinDiffStep;
@@ -2170,7 +2179,7 @@ public:
  */
 class CUpwHLLC_Flow : public CNumerics {
 private:
-  bool implicit, dynamic_grid;
+  bool dynamic_grid;
   unsigned short iDim, jDim, iVar, jVar;
   
   su2double *IntermediateState;
@@ -2221,7 +2230,7 @@ public:
  */
 class CUpwGeneralHLLC_Flow : public CNumerics {
 private:
-  bool implicit, dynamic_grid;
+  bool dynamic_grid;
   unsigned short iDim, jDim, iVar, jVar;
   
   su2double *IntermediateState;
@@ -2281,7 +2290,7 @@ class CUpwLin_TransLM : public CNumerics {
 private:
   su2double *Velocity_i;
   su2double *Velocity_j;
-  bool implicit, incompressible;
+  bool incompressible;
   su2double Density_i, Density_j, q_ij, a0, a1;
   unsigned short iDim;
   
@@ -2382,7 +2391,7 @@ private:
 protected:
   su2double *Velocity_i, *Velocity_j; /*!< \brief Velocity, minus any grid movement. */
   su2double Density_i, Density_j;
-  bool implicit, dynamic_grid, incompressible;
+  bool dynamic_grid, incompressible;
   su2double q_ij, /*!< \brief Projected velocity at the face. */
             a0,   /*!< \brief The maximum of the face-normal velocity and 0 */
             a1;   /*!< \brief The minimum of the face-normal velocity and 0 */
@@ -2502,7 +2511,6 @@ public:
 class CUpwSca_TransLM : public CNumerics {
 private:
   su2double *Velocity_i, *Velocity_j;
-  bool implicit;
   su2double q_ij, a0, a1;
   unsigned short iDim;
   
@@ -2579,7 +2587,7 @@ public:
 class CUpwSca_Heat : public CNumerics {
 private:
   su2double *Velocity_i, *Velocity_j;
-  bool implicit, dynamic_grid;
+  bool dynamic_grid;
   su2double q_ij, a0, a1;
   unsigned short iDim;
 
@@ -2619,7 +2627,6 @@ class CCentBase_Flow : public CNumerics {
 protected:
   unsigned short iDim, iVar, jVar; /*!< \brief Iteration on dimension and variables. */
   bool dynamic_grid;               /*!< \brief Consider grid movement. */
-  bool implicit;                   /*!< \brief Implicit calculation (compute Jacobians). */
   su2double fix_factor;            /*!< \brief Fix factor for dissipation Jacobians (more diagonal dominance). */
 
   su2double *Velocity_i, *Velocity_j, *MeanVelocity; /*!< \brief Velocity at nodes i and j and mean. */
@@ -2843,8 +2850,7 @@ private:
   *ProjFlux,                      /*!< \brief Projected inviscid flux tensor. */
   Epsilon_2, Epsilon_4;           /*!< \brief Artificial dissipation values. */
   su2double **Precon;
-  bool implicit,         /*!< \brief Implicit calculation. */
-  dynamic_grid,          /*!< \brief Modification for grid movement. */
+  bool dynamic_grid,     /*!< \brief Modification for grid movement. */
   variable_density,      /*!< \brief Variable density incompressible flows. */
   energy;                /*!< \brief computation with the energy equation. */
 
@@ -2888,7 +2894,7 @@ private:
   su2double Residual, ProjVelocity_i, ProjVelocity_j, ProjPhi, ProjPhi_Vel, sq_vel, phis1, phis2;
   su2double MeanPsiRho, MeanPsiE, Param_p, Param_Kappa_4, Param_Kappa_2, Local_Lambda_i, Local_Lambda_j, MeanLambda;
   su2double Phi_i, Phi_j, sc4, StretchingFactor, Epsilon_4, Epsilon_2;
-  bool implicit, grid_movement;
+  bool grid_movement;
   
 public:
   
@@ -2940,8 +2946,7 @@ private:
   Local_Lambda_i, Local_Lambda_j,
   MeanLambda,                      /*!< \brief Local eingenvalues. */
   cte_0, cte_1;                    /*!< \brief Artificial dissipation values. */
-  bool implicit,                   /*!< \brief Implicit calculation. */
-  dynamic_grid;                    /*!< \brief Modification for grid movement. */
+  bool dynamic_grid;               /*!< \brief Modification for grid movement. */
 
 
 public:
@@ -2998,8 +3003,7 @@ private:
   StretchingFactor,                /*!< \brief Streching parameters. */
   Epsilon_0;                       /*!< \brief Artificial dissipation values. */
   su2double **Precon;
-  bool implicit,                   /*!< \brief Implicit calculation. */
-  dynamic_grid,                    /*!< \brief Modification for grid movement. */
+  bool dynamic_grid,               /*!< \brief Modification for grid movement. */
   variable_density,                /*!< \brief Variable density incompressible flows. */
   energy;                          /*!< \brief computation with the energy equation. */
   
@@ -3043,7 +3047,7 @@ private:
   su2double Residual, ProjVelocity_i, ProjVelocity_j, ProjPhi, ProjPhi_Vel, sq_vel, phis1, phis2,
   MeanPsiRho, MeanPsiE, Param_p, Param_Kappa_0, Local_Lambda_i, Local_Lambda_j, MeanLambda,
   Phi_i, Phi_j, sc2, StretchingFactor, Epsilon_0;
-  bool implicit, grid_movement;
+  bool grid_movement;
   
 public:
   
@@ -3094,7 +3098,6 @@ class CAvgGrad_Base : public CNumerics {
  protected:
   const unsigned short nPrimVar;  /*!< \brief The size of the primitive variable array used in the numerics class. */
   const bool correct_gradient; /*!< \brief Apply a correction to the gradient term */
-  bool implicit;               /*!< \brief Implicit calculus. */
   su2double *heat_flux_vector, /*!< \brief Flux of total energy due to molecular and turbulent diffusion */
   *heat_flux_jac_i,            /*!< \brief Jacobian of the molecular + turbulent heat flux vector, projected onto the normal vector. */
   **tau_jacobian_i;            /*!< \brief Jacobian of the viscous + turbulent stress tensor, projected onto the normal vector. */
@@ -3536,7 +3539,7 @@ class CAvgGrad_Scalar : public CNumerics {
                                   CConfig *config) = 0;
 
  protected:
-  bool implicit, incompressible;
+  bool incompressible;
   bool correct_gradient;
   unsigned short iVar, iDim;
   su2double **Mean_GradTurbVar;               /*!< \brief Average of gradients at cell face */
@@ -3674,7 +3677,7 @@ private:
   su2double **Mean_GradTransVar;
   su2double *Proj_Mean_GradTransVar_Kappa, *Proj_Mean_GradTransVar_Edge;
   su2double *Edge_Vector;
-  bool implicit, incompressible;
+  bool incompressible;
   su2double sigma;
   //su2double dist_ij_2;
   //su2double proj_vector_ij;
@@ -3719,7 +3722,6 @@ private:
   su2double *Mean_GradPsiE;  /*!< \brief Counter for dimensions of the problem. */
   su2double **Mean_GradPhi;  /*!< \brief Counter for dimensions of the problem. */
   su2double *Edge_Vector;    /*!< \brief Vector going from node i to node j. */
-  bool implicit;             /*!< \brief Implicit calculus. */
   
 public:
   
@@ -3757,7 +3759,7 @@ private:
   su2double **Mean_GradTurbVar;
   su2double *Proj_Mean_GradTurbVar_Kappa, *Proj_Mean_GradTurbVar_Edge, *Proj_Mean_GradTurbVar_Corrected;
   su2double *Edge_Vector;
-  bool implicit, incompressible;
+  bool incompressible;
   su2double sigma;
   
 public:
@@ -3859,7 +3861,6 @@ private:
   su2double *Proj_Mean_GradPsiVar_Edge;  /*!< \brief Projection of Mean_GradPsiVar onto Edge_Vector. */
   su2double *Mean_GradPsiE;              /*!< \brief Counter for dimensions of the problem. */
   su2double **Mean_GradPhi;              /*!< \brief Counter for dimensions of the problem. */
-  bool implicit;                         /*!< \brief Boolean controlling Jacobian calculations. */
   
 public:
   
@@ -4005,7 +4006,6 @@ private:
   su2double **Mean_GradHeatVar;
   su2double *Proj_Mean_GradHeatVar_Normal, *Proj_Mean_GradHeatVar_Corrected;
   su2double *Edge_Vector;
-  bool implicit;
   su2double dist_ij_2, proj_vector_ij, Thermal_Diffusivity_Mean;
   unsigned short iVar, iDim;
 
@@ -4046,7 +4046,6 @@ private:
   su2double **Mean_GradHeatVar;
   su2double *Proj_Mean_GradHeatVar_Kappa, *Proj_Mean_GradHeatVar_Edge, *Proj_Mean_GradHeatVar_Corrected;
   su2double *Edge_Vector;
-  bool implicit;
   su2double dist_ij_2, proj_vector_ij, Thermal_Diffusivity_Mean;
   unsigned short iVar, iDim;
 
@@ -4650,7 +4649,6 @@ private:
   su2double alpha_global;
   su2double Vorticity;
 
-  bool implicit;
   
 public:
   bool debugme; // For debugging only, remove this. -AA
@@ -4885,7 +4883,6 @@ class CSourceIncRotatingFrame_Flow : public CNumerics {
 
 private:
   su2double Omega[3];  /*!< \brief Angular velocity */
-  bool implicit; /*!< \brief Implicit calculation. */
 
 public:
 
@@ -4952,8 +4949,7 @@ public:
  * \author T. Economon
  */
 class CSourceIncAxisymmetric_Flow : public CNumerics {
-  bool implicit, /*!< \brief Implicit calculation. */
-  viscous, /*!< \brief Viscous incompressible flows. */
+  bool viscous, /*!< \brief Viscous incompressible flows. */
   energy; /*!< \brief computation with the energy equation. */
 
 public:
@@ -5307,7 +5303,6 @@ class CConvective_Template : public CNumerics {
 private:
   
   /* define private variables here */
-  bool implicit;
   su2double *Diff_U;
   su2double *Velocity_i, *Velocity_j, *RoeVelocity;
   su2double *ProjFlux_i, *ProjFlux_j;
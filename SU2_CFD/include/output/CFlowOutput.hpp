@@ -29,8 +29,12 @@
 
 #include "COutput.hpp"
 #include "../variables/CVariable.hpp"
+#include "tools/CInSituExtraction.hpp"
 
 class CFlowOutput : public COutput{
+protected:
+  CProbeInterpolator* probes = nullptr;  /*!< \brief Interpolation of the flow at the probes (PROBE_COORDS). */
+
 public:
   /*!
    * \brief Constructor of the class
@@ -86,6 +90,29 @@ protected:
    */
   void Set_CpInverseDesign(CSolver *solver, CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Add the flow probes as history fields (group PROBE).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AddProbeOutput(CConfig *config);
+
+  /*!
+   * \brief Interpolate the flow at the probes (every PROBE_WRT_FREQ iterations) and set the history fields.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The flow solver.
+   */
+  void SetProbes(CConfig *config, CGeometry *geometry, CSolver *solver);
+
+  /*!
+   * \brief Write the slices of the flow solution (every SLICE_WRT_FREQ iterations).
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   * \param[in] iter - Current iteration index.
+   */
+  void WriteInSituFiles(CConfig *config, CGeometry *geometry, CSolver **solver_container, unsigned long iter) override;
+
   /*!
    * \brief Compute value of the Q criteration for vortex idenfitication
    * \param[in] VelocityGradient - Velocity gradients
@@ -790,6 +790,15 @@ protected:
    */
   inline virtual void WriteAdditionalFiles(CConfig *config, CGeometry* geometry, CSolver** solver_container){}
 
+  /*!
+   * \brief Extract and write reduced data (e.g. slices) that does not depend on the volume output frequency.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   * \param[in] iter - Current iteration index.
+   */
+  inline virtual void WriteInSituFiles(CConfig *config, CGeometry* geometry, CSolver** solver_container, unsigned long iter){}
+
   /*!
    * \brief Write any additional output defined for the current solver.
    * \param[in] config - Definition of the particular problem per zone.
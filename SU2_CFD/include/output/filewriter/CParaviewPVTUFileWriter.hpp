@@ -0,0 +1,112 @@
+/*!
+ * \file CParaviewPVTUFileWriter.hpp
+ * \brief Headers of the partitioned paraview XML (vtu pieces + pvtu index) file writer class.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CFileWriter.hpp"
+
+class CGeometry;
+
+/*!
+ * \class CParaviewPVTUFileWriter
+ * \brief Writes the volume solution as one vtu piece per rank, directly from the partition of
+ *        the rank, and a pvtu index file (master node) that references all the pieces.
+ * \note Unlike the other volume writers this one works on the unsorted data of the data sorter,
+ *       i.e. no sorting of the data nor of the connectivity is required. The halo points needed by the
+ *       elements of a piece are obtained from the neighbor ranks with the point-to-point
+ *       communication pattern of the geometry. Each element is written by exactly one rank, the one
+ *       that owns the point of the element with the lowest global index.
+ */
+class CParaviewPVTUFileWriter final: public CFileWriter{
+
+private:
+
+  CGeometry* geometry;            /*!< \brief Geometry of the partition of this rank. */
+  vector<passivedouble> haloData; /*!< \brief Output data of the halo points (nPoint-nPointDomain x nField). */
+
+  /*!
+   * \brief Get the output data of a local (domain or halo) point.
+   * \param[in] iPoint - Local index of the point.
+   * \param[in] iField - Index of the field.
+   */
+  passivedouble GetPointData(unsigned long iPoint, unsigned short iField) const;
+
+  /*!
+   * \brief Obtain the output data of the halo points from the neighbor ranks.
+   */
+  void CommunicateHaloData();
+
+  /*!
+   * \brief Write the vtu piece of this rank.
+   * \param[in] pieceName - Name of the piece file.
+   */
+  void WritePiece(const string& pieceName);
+
+  /*!
+   * \brief Write the pvtu index file (only master node).
+   * \param[in] pieceBaseName - Name of the piece files without rank suffix and path.
+   */
+  void WriteIndex(const string& pieceBaseName) const;
+
+  /*!
+   * \brief Loop over the output fields grouping vector components ("_x", "_y", "_z").
+   * \param[in] func - Called with the name, index of the first field and number of components of each array.
+   */
+  template<class Functor>
+  void ForEachPointArray(const Functor& func) const;
+
+public:
+
+  /*!
+   * \brief File extension of the index file.
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief File extension of the pieces.
+   */
+  const static string pieceExt;
+
+  /*!
+   * \brief Construct a file writer using field names, the data sorter and the geometry.
+   * \param[in] valFileName - The name of the file
+   * \param[in] valDataSorter - The data sorter, only the unsorted (partition) data is used.
+   * \param[in] valGeometry - Geometrical definition of the partition.
+   */
+  CParaviewPVTUFileWriter(string valFileName, CParallelDataSorter* valDataSorter, CGeometry* valGeometry);
+
+  /*!
+   * \brief Destructor
+   */
+  ~CParaviewPVTUFileWriter() override;
+
+  /*!
+   * \brief Write the pieces and the index file.
+   */
+  void Write_Data() override;
+
+};
+
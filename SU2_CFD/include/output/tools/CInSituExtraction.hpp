@@ -0,0 +1,166 @@
+/*!
+ * \file CInSituExtraction.hpp
+ * \brief Headers of the classes that extract flow probes and slices during the solution.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include "../../../../Common/include/CConfig.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+#include "../../variables/CVariable.hpp"
+
+/*!
+ * \class CInSituExtraction
+ * \brief Common functionality of the in-situ extraction of flow data (probes and slices),
+ *        a cheap alternative to frequent volume output for monitoring purposes.
+ * \note The sampled fields are pressure, density, temperature and the velocity components.
+ */
+class CInSituExtraction {
+protected:
+  unsigned short nDim;    /*!< \brief Number of spatial dimensions. */
+  unsigned short nField;  /*!< \brief Number of sampled fields. */
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of spatial dimensions.
+   */
+  CInSituExtraction(unsigned short val_nDim) : nDim(val_nDim), nField(3+val_nDim) {}
+
+  /*!
+   * \brief Load the sampled fields of a point.
+   * \param[in] nodes - Flow variables.
+   * \param[in] iPoint - Index of the point.
+   * \param[out] fields - Values of the fields (nField).
+   */
+  void LoadFields(const CVariable* nodes, unsigned long iPoint, su2double* fields) const;
+
+  /*!
+   * \brief Whether an element is owned by this rank, i.e. if the point with the lowest
+   *        global index is a domain point. Each element is owned by exactly one rank.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iElem - Index of the element.
+   */
+  static bool IsOwnedElement(CGeometry* geometry, unsigned long iElem);
+
+public:
+  /*!
+   * \brief Names of the sampled fields.
+   * \param[in] nDim - Number of spatial dimensions.
+   */
+  static std::vector<std::string> GetFieldNames(unsigned short nDim);
+
+  /*!
+   * \brief Number of sampled fields.
+   */
+  inline unsigned short GetnField() const { return nField; }
+};
+
+/*!
+ * \class CProbeInterpolator
+ * \brief Interpolates the flow at user defined points (PROBE_COORDS).
+ * \note The probes are located once, with an ADT of the elements owned by each rank, the
+ *       interpolation is then local to the owner of each probe and one reduction makes the
+ *       values available on all ranks.
+ */
+class CProbeInterpolator final : public CInSituExtraction {
+private:
+  unsigned short nProbe;                  /*!< \brief Number of probes. */
+  std::vector<unsigned short> localProbe; /*!< \brief Probes owned by this rank. */
+  std::vector<unsigned long> donorStart;  /*!< \brief Start of the donors of each local probe (CSR format). */
+  std::vector<unsigned long> donorPoint;  /*!< \brief Donor points of the local probes. */
+  std::vector<su2double> donorWeight;     /*!< \brief Interpolation weights of the donor points. */
+  std::vector<su2double> values;          /*!< \brief Interpolated values of all probes (nProbe x nField). */
+  std::vector<bool> found;                /*!< \brief Whether each probe is inside the domain. */
+
+public:
+  /*!
+   * \brief Constructor of the class, locates the probes (collective).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  CProbeInterpolator(const CConfig* config, CGeometry* geometry);
+
+  /*!
+   * \brief Interpolate the flow at the probes (collective).
+   * \param[in] nodes - Flow variables.
+   */
+  void Interpolate(const CVariable* nodes);
+
+  /*!
+   * \brief Number of probes.
+   */
+  inline unsigned short GetnProbe() const { return nProbe; }
+
+  /*!
+   * \brief Whether a probe was found inside the domain.
+   */
+  inline bool GetFound(unsigned short iProbe) const { return found[iProbe]; }
+
+  /*!
+   * \brief Interpolated value of a field at a probe.
+   * \param[in] iProbe - Index of the probe.
+   * \param[in] iField - Index of the field.
+   */
+  inline su2double GetValue(unsigned short iProbe, unsigned short iField) const {
+    return values[iProbe*nField+iField];
+  }
+};
+
+/*!
+ * \class CSliceExtractor
+ * \brief Cuts the volume solution with a plane (SLICE_PLANES) and writes the result as a
+ *        small legacy VTK polydata file (polygons in 3D, line segments in 2D).
+ * \note Each rank cuts the elements it owns, only the cut is sent to the master node.
+ */
+class CSliceExtractor final : public CInSituExtraction {
+private:
+  std::vector<su2double> pointData;     /*!< \brief Coordinates (always 3) and fields of the cut points. */
+  std::vector<unsigned long> cellStart; /*!< \brief Start of each cut cell in cellPoints (CSR format). */
+  std::vector<unsigned long> cellPoint; /*!< \brief Local point indices of the cut cells. */
+
+  /*!
+   * \brief Cut the owned elements with a plane, the result is stored in the members.
+   */
+  void Cut(CGeometry* geometry, const CVariable* nodes, const su2double* origin, const su2double* normal);
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of spatial dimensions.
+   */
+  CSliceExtractor(unsigned short val_nDim) : CInSituExtraction(val_nDim) {}
+
+  /*!
+   * \brief Extract one slice and write it to file (collective).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] nodes - Flow variables.
+   * \param[in] iSlice - Index of the slice in SLICE_PLANES.
+   * \param[in] fileName - Name of the file (with extension).
+   */
+  void WriteSlice(const CConfig* config, CGeometry* geometry, const CVariable* nodes,
+                  unsigned short iSlice, const std::string& fileName);
+};
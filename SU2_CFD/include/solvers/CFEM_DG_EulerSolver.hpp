@@ -29,6 +29,7 @@
 #pragma once
 
 #include "CSolver.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 /*!
  * \class CFEM_DG_EulerSolver
@@ -44,6 +45,8 @@ protected:
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
   CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel *> FluidModelThreads; /*!< \brief Copies of the fluid model for the additional OpenMP
+                                                       threads, which carry out the task list concurrently. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -208,6 +211,9 @@ protected:
   vector<unsigned long> startLocResInternalFacesWithHaloElem; /*!< \brief The starting location in the residual of the
                                                                           faces for the time levels of internal faces
                                                                           between an owned and a halo element. */
+  vector<unsigned long> startLocResInternalFaces; /*!< \brief The starting location in the residual of the faces
+                                                              for every internal matching face. Needed to split
+                                                              a range of faces over several threads. */
 
   bool symmetrizingTermsPresent;    /*!< \brief Whether or not symmetrizing terms are present in the
                                                 discretization. */
@@ -321,10 +327,13 @@ public:
   inline unsigned long GetnDOFsGlobal(void) const final { return nDOFsGlobal; }
 
   /*!
-   * \brief Compute the pressure at the infinity.
-   * \return Value of the pressure at the infinity.
+   * \brief Get the fluid model of the calling thread.
+   * \return Pointer to the fluid model.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final {
+    const int thread = omp_get_thread_num();
+    return (thread == 0) ? FluidModel : FluidModelThreads[thread-1];
+  }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -1291,6 +1300,46 @@ protected:
                                          const unsigned short timeLevel,
                                          const bool commMustBeCompleted);
 
+  /*!
+   * \brief Routine that tests the outstanding non-blocking communication of the
+            task list, such that the MPI library makes progress while the threads
+            carry out a task. The received data is not copied yet, this is done
+            when the corresponding task of the list is carried out.
+   * \param[in] taskCompleted     - Whether or not the tasks of the list have been completed.
+   * \param[in] lowestIndexInList - Lowest index in the task list that is not completed.
+   */
+  void Progress_MPI_Communication(const vector<bool>  &taskCompleted,
+                                  const unsigned long lowestIndexInList);
+
+  /*!
+   * \brief Function, which determines the range of elements or faces of a task.
+   * \param[in]  task   - Task for which the range must be determined.
+   * \param[out] indBeg - Begin index of the range.
+   * \param[out] indEnd - End index (not included) of the range.
+   * \return Whether or not the task works on a range and can be split in chunks.
+   */
+  bool TaskRange_DG(const CTaskDefinition &task,
+                    unsigned long         &indBeg,
+                    unsigned long         &indEnd) const;
+
+  /*!
+   * \brief Function, which carries out a chunk of a task that works on a range
+            of elements or faces. The chunks of a task can be carried out
+            simultaneously by different threads.
+   * \param[in]  config    - Definition of the particular problem.
+   * \param[in]  numerics  - Description of the numerical method.
+   * \param[in]  task      - Task of which a chunk must be carried out.
+   * \param[in]  indBeg    - Begin index of the chunk.
+   * \param[in]  indEnd    - End index (not included) of the chunk.
+   * \param[out] workArray - Work array of the calling thread.
+   */
+  void ProcessTaskChunk_DG(CConfig               *config,
+                           CNumerics             **numerics,
+                           const CTaskDefinition &task,
+                           const unsigned long   indBeg,
+                           const unsigned long   indEnd,
+                           su2double             *workArray);
+
   /*!
    * \brief Function, which computes the inviscid fluxes in face points.
    * \param[in]  config       - Definition of the particular problem.
@@ -72,6 +72,19 @@ protected:
   vector<su2double> NonLinRes_Series;      /*!< \brief Vector holding the nonlinear residual indicator series. */
   su2double Old_Func,  /*!< \brief Old value of the nonlinear residual indicator. */
   New_Func;      /*!< \brief Current value of the nonlinear residual indicator. */
+  vector<su2double> CFLCheckpoint_Flow;    /*!< \brief Flow solution saved by the CFL controller to restart from. */
+  vector<su2double> CFLCheckpoint_Turb;    /*!< \brief Turbulence solution saved by the CFL controller to restart from. */
+  vector<su2double> CFLCheckpoint_CFL;     /*!< \brief Local CFL numbers of the saved solution. */
+  su2double CFLCheckpoint_Res = 0.0;       /*!< \brief Nonlinear residual indicator of the saved solution. */
+  su2double CFLCheckpoint_MaxCFL = 0.0;    /*!< \brief Maximum local CFL of the saved solution. */
+  unsigned long CFLAdapt_Iter = 0;         /*!< \brief Number of CFL adaptions since the last reset. */
+  bool LimitersComputed = false;           /*!< \brief The limiters were computed at least once (see LIMITER_FREEZE_ITER). */
+  unsigned long JacobianLag_Age = 0;       /*!< \brief Consecutive iterations solved with a lagged Jacobian. */
+  unsigned long JacobianLag_RefIter = 0;   /*!< \brief Linear iterations of the first solve with the current Jacobian. */
+  su2double JacobianLag_RefRes = 0.0;      /*!< \brief Linear residual of the first solve with the current Jacobian. */
+  su2double JacobianLag_Res = 0.0;         /*!< \brief Nonlinear residual indicator of the previous iteration. */
+  unsigned long JacobianLag_nAssembled = 0; /*!< \brief Number of Jacobian assemblies (and preconditioner factorizations). */
+  unsigned long JacobianLag_nSkipped = 0;  /*!< \brief Number of assemblies (and factorizations) skipped by lagging. */
   unsigned short nVar,           /*!< \brief Number of variables of the problem. */
   nPrimVar,                      /*!< \brief Number of primitive variables of the problem. */
   nPrimVarGrad,                  /*!< \brief Number of primitive variables of the problem in the gradient computation. */
@@ -200,6 +213,14 @@ public:
     return base_nodes;
   }
 
+  /*!
+   * \brief Get the memory used by the containers of the nodes (nothing if the solver has no nodes).
+   * \param[in,out] containers - Name and size in bytes of each container.
+   */
+  inline void GetNodesMemory(vector<pair<string,unsigned long> >& containers) const {
+    if (base_nodes != nullptr) base_nodes->GetContainerMemory(containers);
+  }
+
   /*!
    * \brief Routine to load a solver quantity into the data structures for MPI point-to-point communication and to launch non-blocking sends and recvs.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -618,6 +639,14 @@ public:
    */
   void SetSolution_Limiter(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Check if the limiters of the previous iteration can be reused (see LIMITER_FREEZE_ITER).
+   * \note The limiters are always computed on the first call, they are not frozen for discrete adjoints.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if the computation of the limiters should be skipped.
+   */
+  bool FrozenLimiters(const CConfig *config);
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1558,11 +1587,40 @@ public:
    */
   void AdaptCFLNumber(CGeometry **geometry, CSolver ***solver_container, CConfig *config);
 
+  /*!
+   * \brief Global CFL factor from the convergence of the linear solvers and the trend of the
+   *        nonlinear residual, saves the solution periodically and restores it if the residual diverges.
+   * \param[in] geometry - Geometrical definition of the problem (finest grid).
+   * \param[in] solver_container - Container vector with all the solutions (finest grid).
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] restart - True if the saved solution was restored.
+   * \return Factor applied to the CFL of the points that are not under-relaxed.
+   */
+  su2double CFLFeedbackFactor(CGeometry *geometry, CSolver **solver_container, CConfig *config, bool &restart);
+
   /*!
    * \brief Reset the local CFL adaption variables
    */
   void ResetCFLAdapt();
 
+  /*!
+   * \brief Decide if the Jacobian (and its preconditioner) of the next iteration is lagged, from the
+   *        age of the current one, the convergence of the linear solver, and the nonlinear residual.
+   * \note Call after solving the linear system and computing the RMS residual (see JACOBIAN_LAG_ITER).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdateJacobianLag(CConfig *config);
+
+  /*!
+   * \brief Get the number of Jacobian assemblies and of those skipped by lagging.
+   * \param[out] nAssembled - Number of assemblies.
+   * \param[out] nSkipped - Number of skipped assemblies.
+   */
+  inline void GetJacobianLagCounts(unsigned long &nAssembled, unsigned long &nSkipped) const {
+    nAssembled = JacobianLag_nAssembled;
+    nSkipped = JacobianLag_nSkipped;
+  }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
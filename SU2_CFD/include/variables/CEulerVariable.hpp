@@ -73,6 +73,12 @@ public:
    */
   virtual ~CEulerVariable() = default;
 
+  /*!
+   * \brief Get the memory used by the containers of the variables.
+   * \param[in,out] containers - Name and size in bytes of each container.
+   */
+  void GetContainerMemory(vector<pair<string,unsigned long> >& containers) const override;
+
   /*!
    * \brief Get the new solution of the problem (Classical RK4).
    * \param[in] iVar - Index of the variable.
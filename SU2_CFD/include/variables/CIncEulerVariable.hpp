@@ -64,6 +64,12 @@ public:
    */
   virtual ~CIncEulerVariable() = default;
 
+  /*!
+   * \brief Get the memory used by the containers of the variables.
+   * \param[in,out] containers - Name and size in bytes of each container.
+   */
+  void GetContainerMemory(vector<pair<string,unsigned long> >& containers) const override;
+
   /*!
    * \brief Get the primitive variable gradients for all points.
    * \return Reference to primitive variable gradient.
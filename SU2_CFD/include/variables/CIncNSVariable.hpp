@@ -62,6 +62,12 @@ public:
    */
   ~CIncNSVariable() = default;
 
+  /*!
+   * \brief Get the memory used by the containers of the variables.
+   * \param[in,out] containers - Name and size in bytes of each container.
+   */
+  void GetContainerMemory(vector<pair<string,unsigned long> >& containers) const override;
+
   /*!
    * \brief Set the laminar viscosity.
    */
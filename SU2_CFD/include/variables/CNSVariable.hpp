@@ -44,7 +44,6 @@ private:
   VectorType Tau_Wall;        /*!< \brief Magnitude of the wall shear stress from a wall function. */
   VectorType DES_LengthScale; /*!< \brief DES Length Scale. */
   VectorType Roe_Dissipation; /*!< \brief Roe low dissipation coefficient. */
-  VectorType Vortex_Tilting;  /*!< \brief Value of the vortex tilting variable for DES length scale computation. */
 
 public:
   /*!
@@ -65,6 +64,12 @@ public:
    */
   ~CNSVariable() = default;
 
+  /*!
+   * \brief Get the memory used by the containers of the variables.
+   * \param[in,out] containers - Name and size in bytes of each container.
+   */
+  void GetContainerMemory(vector<pair<string,unsigned long> >& containers) const override;
+
   /*!
    * \brief Set the laminar viscosity.
    */
@@ -61,6 +61,12 @@ public:
    */
   ~CTurbSAVariable() = default;
 
+  /*!
+   * \brief Get the memory used by the containers of the variables.
+   * \param[in,out] containers - Name and size in bytes of each container.
+   */
+  void GetContainerMemory(vector<pair<string,unsigned long> >& containers) const override;
+
   /*!
    * \brief Set the harmonic balance source term.
    * \param[in] iPoint - Point index.
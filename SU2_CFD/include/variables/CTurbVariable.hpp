@@ -58,6 +58,12 @@ public:
    */
   virtual ~CTurbVariable() = default;
 
+  /*!
+   * \brief Get the memory used by the containers of the variables.
+   * \param[in,out] containers - Name and size in bytes of each container.
+   */
+  void GetContainerMemory(vector<pair<string,unsigned long> >& containers) const override;
+
   /*!
    * \brief Get the value of the eddy viscosity.
    * \param[in] iPoint - Point index.
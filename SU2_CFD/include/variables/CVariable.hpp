@@ -129,6 +129,21 @@ protected:
   unsigned long nSecondaryVar = {0};     /*!< \brief Number of secondary variables. */
   unsigned long nSecondaryVarGrad = {0};   /*!< \brief Number of secondaries for which a gradient is computed. */
 
+  /*!
+   * \brief Size in bytes of a container (C2DContainer based types).
+   */
+  template<class Container_t>
+  static unsigned long ContainerBytes(const Container_t& container) {
+    return container.size()*sizeof(*container.data());
+  }
+
+  /*!
+   * \overload
+   */
+  static unsigned long ContainerBytes(const VectorOfMatrix& container) {
+    return ContainerBytes(container.storage) + ContainerBytes(container.interface);
+  }
+
 public:
 
   /*--- Disable default construction copy and assignment. ---*/
@@ -160,6 +175,14 @@ public:
    */
   virtual ~CVariable() = default;
 
+  /*!
+   * \brief Get the memory used by the containers of the variables (for the memory report).
+   * \note Containers that are not allocated are also listed (0 bytes) so that the list is the same on all
+   *       ranks, derived classes append their own containers to the ones of the parent class.
+   * \param[in,out] containers - Name and size in bytes of each container.
+   */
+  virtual void GetContainerMemory(vector<pair<string,unsigned long> >& containers) const;
+
   /*!
    * \brief Set the value of the solution, all variables.
    * \param[in] iPoint - Point index.
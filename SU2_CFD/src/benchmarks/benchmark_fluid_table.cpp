@@ -0,0 +1,148 @@
+/*!
+ * \file benchmark_fluid_table.cpp
+ * \brief Benchmark of the tabulated fluid model against the Peng-Robinson model
+ *        it is built from, for the input pairs used by the compressible solvers.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/fluid_model.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+/*--- Thermodynamic state of a sample. ---*/
+struct CSample {
+  su2double rho, e, P, T, h, s;
+};
+
+/*--- Kind of call being measured. ---*/
+enum ENUM_BENCH_PAIR {BENCH_RHOE, BENCH_PRHO, BENCH_PT, BENCH_HS, BENCH_PS};
+
+/* Evaluate all the samples with one input pair, returns the time per call in
+   seconds and the maximum relative error in pressure and temperature. */
+static double TimePair(CFluidModel *model, const vector<CSample> &samples, int pair, double &maxError) {
+
+  maxError = 0.0;
+  double checksum = 0.0;
+
+  auto start = chrono::high_resolution_clock::now();
+  for(const auto &smp : samples) {
+    switch(pair) {
+      case BENCH_RHOE: model->SetTDState_rhoe(smp.rho, smp.e); break;
+      case BENCH_PRHO: model->SetTDState_Prho(smp.P, smp.rho); break;
+      case BENCH_PT:   model->SetTDState_PT(smp.P, smp.T);     break;
+      case BENCH_HS:   model->SetTDState_hs(smp.h, smp.s);     break;
+      case BENCH_PS:   model->SetTDState_Ps(smp.P, smp.s);     break;
+    }
+    checksum += SU2_TYPE::GetValue(model->GetSoundSpeed2());
+  }
+  auto stop = chrono::high_resolution_clock::now();
+
+  /* The error is evaluated separately to not affect the timing. */
+  for(const auto &smp : samples) {
+    switch(pair) {
+      case BENCH_RHOE: model->SetTDState_rhoe(smp.rho, smp.e); break;
+      case BENCH_PRHO: model->SetTDState_Prho(smp.P, smp.rho); break;
+      case BENCH_PT:   model->SetTDState_PT(smp.P, smp.T);     break;
+      case BENCH_HS:   model->SetTDState_hs(smp.h, smp.s);     break;
+      case BENCH_PS:   model->SetTDState_Ps(smp.P, smp.s);     break;
+    }
+    const double errP = fabs(SU2_TYPE::GetValue(model->GetPressure()/smp.P - 1.0));
+    const double errT = fabs(SU2_TYPE::GetValue(model->GetTemperature()/smp.T - 1.0));
+    maxError = max(maxError, max(errP, errT));
+  }
+
+  if(checksum == 0.0) printf("Invalid states.\n");
+
+  return chrono::duration<double>(stop-start).count()/samples.size();
+}
+
+int main(int argc, char **argv) {
+
+  SU2_MPI::Init(&argc, &argv);
+  SU2_MPI::SetComm(MPI_COMM_WORLD);
+
+  /* Number of points of the table, can be overruled on the command line. */
+  const unsigned short nPoints = (argc > 1) ? atoi(argv[1]) : 200;
+  const int nSamples = 100000;
+
+  /* Siloxane MDM near the critical point, as in the NICFD test cases (dimensional). */
+  const su2double Gamma = 1.0125, R = 35.152, Pc = 1415200.0, Tc = 564.1, w = 0.529;
+  const su2double rho_ref = 230.0, T_ref = 564.1;
+
+  CPengRobinson exact(Gamma, R, Pc, Tc, w);
+
+  const su2double rhoRange[] = {0.01*rho_ref, 10.0*rho_ref}, TRange[] = {0.5*T_ref, 2.0*T_ref};
+
+  auto start = chrono::high_resolution_clock::now();
+  CLookUpTableFluid table(new CPengRobinson(Gamma, R, Pc, Tc, w), nPoints, nPoints,
+                          rhoRange, TRange, "benchmark_fluid_table.dat");
+  auto stop = chrono::high_resolution_clock::now();
+
+  printf("Table of %dx%d points (or loaded from file) in %.3f s.\n", nPoints, nPoints,
+         chrono::duration<double>(stop-start).count());
+
+  /* Random supercritical states in a sub-range of the table. */
+  vector<CSample> samples;
+  srand(0);
+  while(int(samples.size()) < nSamples) {
+    const su2double rho = rho_ref*exp(log(0.02) + rand()/double(RAND_MAX)*log(100.0));
+    const su2double T = T_ref*(1.02 + 0.6*rand()/double(RAND_MAX));
+    exact.SetTDState_rhoT(rho, T);
+    const su2double P = exact.GetPressure();
+    if(!(P > 0.0) || !(exact.GetSoundSpeed2() > 0.0) || !(exact.GetTemperature() > 0.0)) continue;
+    samples.push_back({rho, exact.GetStaticEnergy(), P, exact.GetTemperature(),
+                       exact.GetStaticEnergy()+P/rho, exact.GetEntropy()});
+  }
+
+  /* Consecutive calls of a solver are for neighboring points, i.e. similar states,
+     the samples are sorted to have a similar locality in the tables. */
+  sort(samples.begin(), samples.end(), [](const CSample &a, const CSample &b) {
+    const int binA = int(SU2_TYPE::GetValue(16.0*log(a.rho))), binB = int(SU2_TYPE::GetValue(16.0*log(b.rho)));
+    return (binA != binB) ? (binA < binB) : (a.T < b.T);
+  });
+
+  const char* names[] = {"rhoe", "Prho", "PT", "hs", "Ps"};
+
+  printf("%-6s %14s %14s %8s %12s %12s\n", "pair", "exact ns/call", "table ns/call",
+         "speedup", "exact error", "table error");
+
+  for(int pair = BENCH_RHOE; pair <= BENCH_PS; ++pair) {
+    double errExact, errTable;
+    const double tExact = TimePair(&exact, samples, pair, errExact);
+    const double tTable = TimePair(&table, samples, pair, errTable);
+
+    printf("%-6s %14.1f %14.1f %8.2f %12.2e %12.2e\n", names[pair], 1.e9*tExact, 1.e9*tTable,
+           tExact/tTable, errExact, errTable);
+  }
+
+  SU2_MPI::Finalize();
+
+  return 0;
+}
@@ -111,6 +111,9 @@ CDriver::CDriver(char* confFile,
 
   Output_Preprocessing(config_container, driver_config, output_container, driver_output);
 
+  /*--- Configurations and communicators of the concurrent harmonic balance instances. ---*/
+
+  ConcurrentInstance_Preprocessing();
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -137,7 +140,20 @@ CDriver::CDriver(char* confFile,
 
     for (iInst = 0; iInst < nInst[iZone]; iInst++){
 
-      config_container[iZone]->SetiInst(iInst);
+      /*--- Concurrent instances are preprocessed with their own configuration and communicator,
+       the configuration is copied once the first instance has set the marker and reference values. ---*/
+
+      if (config_instance != NULL) {
+        if (iInst != INST_0) {
+          config_instance[iInst] = config_container[iZone]->CopyInstance();
+          config_instance[iInst]->SetMPICommunicator(comm_instance[iInst]);
+        }
+        SU2_MPI::SetThreadComm(comm_instance[iInst]);
+      }
+
+      CConfig *config = GetInstance_Config(iInst)[iZone];
+
+      config->SetiInst(iInst);
 
       geometry_container[iZone][iInst]    = NULL;
       iteration_container[iZone][iInst]   = NULL;
@@ -150,7 +166,21 @@ CDriver::CDriver(char* confFile,
        identified and linked, face areas and volumes of the dual mesh cells are
        computed, and the multigrid levels are created using an agglomeration procedure. ---*/
 
-      Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dummy_geometry);
+      /*--- Instances whose mesh does not change reuse the geometry of the first one. ---*/
+
+      const bool shared_geometry = (iInst != INST_0) && Shared_InstanceGeometry(config);
+
+      if (shared_geometry)
+        geometry_container[iZone][iInst] = geometry_container[iZone][INST_0];
+      else
+        Geometrical_Preprocessing(config, geometry_container[iZone][iInst], dummy_geometry);
+
+      /*--- The buffers of the MPI comms of a shared geometry are selected by the communicator
+       of the instance, their first use is collective hence it cannot be in the concurrent region. ---*/
+
+      if (config_instance != NULL)
+        for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++)
+          geometry_container[iZone][iInst][iMesh]->GetCommBuffers();
 
       /*--- Definition of the solver class: solver_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS].
        The solver classes are specific to a particular set of governing equations,
@@ -159,7 +189,7 @@ CDriver::CDriver(char* confFile,
        fluxes, loops over the nodes to compute source terms, and routines for
        imposing various boundary condition type for the PDE. ---*/
 
-      Solver_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst]);
+      Solver_Preprocessing(config, geometry_container[iZone][iInst], solver_container[iZone][iInst]);
 
       /*--- Definition of the numerical method class:
        numerics_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS][#EQ_TERMS].
@@ -168,7 +198,7 @@ CDriver::CDriver(char* confFile,
        data structure (centered, upwind, galerkin), as well as any source terms
        (piecewise constant reconstruction) evaluated in each dual mesh volume. ---*/
 
-      Numerics_Preprocessing(config_container[iZone], geometry_container[iZone][iInst],
+      Numerics_Preprocessing(config, geometry_container[iZone][iInst],
                              solver_container[iZone][iInst], numerics_container[iZone][iInst]);
 
       /*--- Definition of the integration class: integration_container[#ZONES][#INSTANCES][#EQ_SYSTEMS].
@@ -177,25 +207,28 @@ CDriver::CDriver(char* confFile,
        the residual at each node, R(U) and then integrates the equations to a
        steady state or time-accurately. ---*/
 
-      Integration_Preprocessing(config_container[iZone], integration_container[iZone][iInst]);
+      Integration_Preprocessing(config, integration_container[iZone][iInst]);
 
       /*--- Instantiate the type of physics iteration to be executed within each zone. For
        example, one can execute the same physics across multiple zones (mixing plane),
        different physics in different zones (fluid-structure interaction), or couple multiple
        systems tightly within a single zone by creating a new iteration class (e.g., RANS). ---*/
 
-      Iteration_Preprocessing(config_container[iZone], iteration_container[iZone][iInst]);
+      Iteration_Preprocessing(config, iteration_container[iZone][iInst]);
 
       /*--- Dynamic mesh processing.  ---*/
 
-      DynamicMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst],
+      DynamicMesh_Preprocessing(config, geometry_container[iZone][iInst], solver_container[iZone][iInst],
                                  iteration_container[iZone][iInst], grid_movement[iZone][iInst], surface_movement[iZone]);
       /*--- Static mesh processing.  ---*/
 
-      StaticMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], surface_movement[iZone]);
+      if (!shared_geometry)
+        StaticMesh_Preprocessing(config, geometry_container[iZone][iInst], surface_movement[iZone]);
 
     }
 
+    if (config_instance != NULL) SU2_MPI::ClearThreadComm();
+
   }
 
   /*--- Definition of the interface and transfer conditions between different zones.
@@ -331,6 +364,8 @@ void CDriver::SetContainers_Null(){
   nInst                          = new unsigned short[nZone];
   driver_config                  = NULL;
   driver_output                  = NULL;
+  config_instance                = NULL;
+  comm_instance                  = NULL;
 
 
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -371,6 +406,43 @@ void CDriver::Postprocessing() {
       cout << "Warning: " << config_container[ZONE_0]->GetNonphysical_Reconstr() << " reconstructed states for upwinding are non-physical." << endl;
   }
 
+  /*--- Report the load imbalance measured during the run. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (config_container[iZone]->GetWrt_Load_Imbalance())
+      geometry_container[iZone][INST_0][MESH_0]->ReportLoadImbalance(config_container[iZone]);
+  }
+
+  /*--- Summary of the iterations saved by recycling Krylov subspaces, and of the
+   Jacobian assemblies (and preconditioner factorizations) skipped by lagging. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const bool lagging = (config_container[iZone]->GetJacobian_Lag_Iter() > 0);
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+      if (solver_container[iZone][iInst] == nullptr) continue;
+      for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+        CSolver* solver = solver_container[iZone][iInst][MESH_0][iSol];
+        if (solver == nullptr) continue;
+        string name = solver->GetSolverName();
+        if (name.empty()) name = "Solver " + to_string(iSol);
+        solver->System.WriteRecycleSummary(name);
+
+        if (!lagging) continue;
+        unsigned long nAssembled = 0, nSkipped = 0;
+        for (unsigned short iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+          if (solver_container[iZone][iInst][iMesh][iSol] == nullptr) continue;
+          unsigned long nAssembledMesh, nSkippedMesh;
+          solver_container[iZone][iInst][iMesh][iSol]->GetJacobianLagCounts(nAssembledMesh, nSkippedMesh);
+          nAssembled += nAssembledMesh;
+          nSkipped += nSkippedMesh;
+        }
+        if ((rank == MASTER_NODE) && (nAssembled > 0))
+          cout << name << ": " << nAssembled << " iterations with a new Jacobian, " << nSkipped
+               << " iterations with the lagged Jacobian and preconditioner (summed over the grid levels)." << endl;
+      }
+    }
+  }
+
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------- Solver Postprocessing -------------------------" << endl;
 
@@ -453,6 +525,8 @@ void CDriver::Postprocessing() {
   for (iZone = 0; iZone < nZone; iZone++) {
     if (geometry_container[iZone] != NULL) {
       for (iInst = 0; iInst < nInst[iZone]; iInst++){
+        /*--- Shared geometries are deleted with the first instance. ---*/
+        if ((iInst != INST_0) && (geometry_container[iZone][iInst] == geometry_container[iZone][INST_0])) continue;
         for (unsigned short iMGlevel = 0; iMGlevel < config_container[iZone]->GetnMGLevels()+1; iMGlevel++) {
           if (geometry_container[iZone][iInst][iMGlevel] != NULL) delete geometry_container[iZone][iInst][iMGlevel];
         }
@@ -492,6 +566,17 @@ void CDriver::Postprocessing() {
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
 
+  /*--- Deallocate the configurations (the first instance uses the one of the zone)
+   and the communicators of the concurrent instances. ---*/
+  if (config_instance != NULL) {
+    for (iInst = 0; iInst < nInst[ZONE_0]; iInst++) {
+      if (iInst != INST_0) delete config_instance[iInst];
+      SU2_MPI::Comm_free(&comm_instance[iInst]);
+    }
+    delete [] config_instance;
+    delete [] comm_instance;
+  }
+
   /*--- Deallocate config container ---*/
   if (config_container!= NULL) {
     for (iZone = 0; iZone < nZone; iZone++) {
@@ -562,6 +647,8 @@ void CDriver::Postprocessing() {
       cout << setw(20) << "Avg. s/iter:" << setw(12)<< UsedTimeCompute/(su2double)IterCount << endl;
       cout << setw(25) << "Core-s/iter/Mpoints:" << setw(12)<< (su2double)size*UsedTimeCompute/(su2double)IterCount/Mpoints << " | ";
       cout << setw(20) << "Mpoints/s:" << setw(12)<< Mpoints*(su2double)IterCount/UsedTimeCompute << endl;
+      cout << setw(25) << "MDOFs/s:" << setw(12)<< MDOFs*(su2double)IterCount/UsedTimeCompute << " | ";
+      cout << setw(20) << "MDOFs/s/core:" << setw(12)<< MDOFs*(su2double)IterCount/UsedTimeCompute/(su2double)size << endl;
     } else cout << endl;
     cout << endl;
     cout << "Output phase:" << endl;
@@ -641,8 +728,71 @@ void CDriver::Input_Preprocessing(CConfig **&config, CConfig *&driver_config) {
   fsi = config_container[ZONE_0]->GetFSI_Simulation();
 }
 
+bool CDriver::Shared_InstanceGeometry(CConfig *config) const {
+
+  if (config->GetTime_Marching() != HARMONIC_BALANCE) return false;
+
+  /*--- The grid velocities of these motions are the same for all instances,
+   any kind of deformation or rigid motion moves the mesh of each instance. ---*/
+
+  const unsigned short Kind_Grid_Movement = config->GetKind_GridMovement();
+
+  const bool static_mesh = ((Kind_Grid_Movement == NO_MOVEMENT)    ||
+                            (Kind_Grid_Movement == ROTATING_FRAME) ||
+                            (Kind_Grid_Movement == STEADY_TRANSLATION));
+
+  return static_mesh && !config->GetVolumetric_Movement() && !fem_solver;
+
+}
+
+void CDriver::ConcurrentInstance_Preprocessing() {
+
+  CConfig *config = config_container[ZONE_0];
+
+  if ((config->GetTime_Marching() != HARMONIC_BALANCE) || !config->GetHB_Concurrent_Instances()) return;
+
+  /*--- The instances run in OpenMP threads that communicate at the same time. ---*/
+
+#ifndef HAVE_OMP
+  SU2_MPI::Error("HB_CONCURRENT_INSTANCES requires SU2 to be compiled with OpenMP (and without AD).", CURRENT_FUNCTION);
+#endif
+#ifdef HAVE_MPI
+  int provided;
+  MPI_Query_thread(&provided);
+  if (provided < MPI_THREAD_MULTIPLE)
+    SU2_MPI::Error("HB_CONCURRENT_INSTANCES requires MPI_THREAD_MULTIPLE, run SU2_CFD with --thread_multiple.", CURRENT_FUNCTION);
+#endif
+  if (nZone > 1)
+    SU2_MPI::Error("HB_CONCURRENT_INSTANCES is only available for single zone problems.", CURRENT_FUNCTION);
+
+  const unsigned short nInstance = config->GetnTimeInstances();
+
+  config_instance = new CConfig* [nInstance];
+  comm_instance = new SU2_MPI::Comm [nInstance];
+
+  for (unsigned short jInst = 0; jInst < nInstance; jInst++) {
+
+    /*--- The iterations modify the configuration (e.g. SetGlobalParam), hence each instance
+     needs its own, the first one keeps the configuration of the zone and the others are
+     copied from it during the preprocessing of the instances. ---*/
+
+    config_instance[jInst] = (jInst == INST_0)? config : NULL;
+
+    /*--- A duplicate of the communicator keeps the messages of the instances apart. ---*/
+
+    SU2_MPI::Comm_dup(SU2_MPI::GetComm(), &comm_instance[jInst]);
+  }
+
+  if (rank == MASTER_NODE)
+    cout << "The " << nInstance << " time instances are iterated concurrently, on up to "
+         << omp_get_max_threads() << " threads." << endl;
+
+}
+
 void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry, bool dummy){
 
+  CGeometryCache *geometry_cache = NULL;
+
   if (!dummy){
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Geometry Preprocessing ( Zone " << config->GetiZone() <<" ) -------------------" << endl;
@@ -656,7 +806,7 @@ void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry,
       }
     }
     else {
-      Geometrical_Preprocessing_FVM(config, geometry);
+      Geometrical_Preprocessing_FVM(config, geometry, geometry_cache);
     }
   } else {
     if (rank == MASTER_NODE)
@@ -687,10 +837,15 @@ void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry,
       (config->GetKind_Solver() == FEM_RANS) ||
       (config->GetKind_Solver() == FEM_LES) ) {
 
-    if (rank == MASTER_NODE)
-      cout << "Computing wall distances." << endl;
+    if ((geometry_cache == NULL) || !geometry_cache->GetWallDistance(geometry[MESH_0])) {
+
+      if (rank == MASTER_NODE)
+        cout << "Computing wall distances." << endl;
 
-    geometry[MESH_0]->ComputeWall_Distance(config);
+      geometry[MESH_0]->ComputeWall_Distance(config);
+
+      if (geometry_cache != NULL) geometry_cache->SetWallDistance(geometry[MESH_0]);
+    }
   }
 
   /*--- Computation of positive surface area in the z-plane which is used for
@@ -750,9 +905,16 @@ void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry,
 
   }
 
+  /*--- Store the preprocessed geometry for the next run, if it was not restored from it. ---*/
+
+  if (geometry_cache != NULL) {
+    if (!geometry_cache->IsLoaded()) geometry_cache->WriteFile();
+    delete geometry_cache;
+  }
+
 }
 
-void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geometry) {
+void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geometry, CGeometryCache *&geometry_cache) {
 
   unsigned short iZone = config->GetiZone(), iMGlevel;
   unsigned short requestedMGlevels = config->GetnMGLevels();
@@ -772,9 +934,18 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   nDim = geometry_aux->GetnDim();
 
-  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+  /*--- Look for the preprocessed geometry of a previous run with the same mesh and settings. ---*/
+
+  if (config->GetGeometry_Cache())
+    geometry_cache = new CGeometryCache(geometry_aux, config);
 
-  geometry_aux->SetColorGrid_Parallel(config);
+  /*--- Color the initial grid and set the send-receive domains (ParMETIS),
+     unless the coloring can be restored from the cache. ---*/
+
+  if ((geometry_cache == NULL) || !geometry_cache->GetColoring(geometry_aux)) {
+    geometry_aux->SetColorGrid_Parallel(config);
+    if (geometry_cache != NULL) geometry_cache->SetColoring(geometry_aux);
+  }
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -885,11 +1056,19 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   /*--- Loop over all the new grid ---*/
 
+  vector<su2double> MGLevelTime;
+
   for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
 
+#ifndef HAVE_MPI
+    su2double LevelStartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+    su2double LevelStartTime = MPI_Wtime();
+#endif
+
     /*--- Create main agglomeration structure ---*/
 
-    geometry[iMGlevel] = new CMultiGridGeometry(geometry, config, iMGlevel);
+    geometry[iMGlevel] = new CMultiGridGeometry(geometry, config, iMGlevel, geometry_cache);
 
     /*--- Compute points surrounding points. ---*/
 
@@ -924,6 +1103,22 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
       break;
     }
 
+    if ((geometry_cache != NULL) && !geometry_cache->IsLoaded())
+      geometry_cache->SetAgglomeration(iMGlevel, geometry[iMGlevel-1], geometry[iMGlevel]);
+
+#ifndef HAVE_MPI
+    MGLevelTime.push_back(su2double(clock())/su2double(CLOCKS_PER_SEC) - LevelStartTime);
+#else
+    MGLevelTime.push_back(MPI_Wtime() - LevelStartTime);
+#endif
+
+  }
+
+  /*--- Report the time spent constructing each coarse level. ---*/
+
+  if (rank == MASTER_NODE) {
+    for (iMGlevel = 0; iMGlevel < MGLevelTime.size(); iMGlevel++)
+      cout << "Multigrid level " << iMGlevel+1 << " built in " << MGLevelTime[iMGlevel] << " s." << endl;
   }
 
   /*--- For unsteady simulations, initialize the grid volumes
@@ -1319,6 +1514,23 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
 
   }
 
+  /*--- The matrices of the different solvers share the ILU fill-in patterns of each grid,
+   report how much index data this saves (over all grid levels and ranks). ---*/
+
+  unsigned long patternMemorySaved = 0, totalPatternMemorySaved = 0;
+  for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++)
+    patternMemorySaved += geometry[iMesh]->GetSparsePatternMemorySaved();
+
+  SU2_MPI::Allreduce(&patternMemorySaved, &totalPatternMemorySaved, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if ((rank == MASTER_NODE) && (totalPatternMemorySaved > 0))
+    cout << "ILU fill-in patterns shared between matrices, saving " << totalPatternMemorySaved/1048576.0
+         << " MB of index data." << endl;
+
+  /*--- Report the memory used by the nodes of each solver. ---*/
+
+  Solver_MemoryReport(solver, config);
+
   /*--- Check for restarts and use the LoadRestart() routines. ---*/
 
   bool update_geo = true;
@@ -1332,6 +1544,68 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
 
 }
 
+void CDriver::Solver_MemoryReport(CSolver ***solver, CConfig *config) const {
+
+  unsigned short iSol, iMGlevel;
+
+  for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+
+    if (solver[MESH_0][iSol] == nullptr) continue;
+
+    /*--- Gather the containers of all grid levels, the list of containers is the same
+     on all levels and ranks, the unallocated ones are listed with 0 bytes. ---*/
+
+    vector<pair<string,unsigned long> > containers;
+
+    for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+      if (solver[iMGlevel][iSol] == nullptr) continue;
+
+      vector<pair<string,unsigned long> > levelContainers;
+      solver[iMGlevel][iSol]->GetNodesMemory(levelContainers);
+
+      if (containers.empty()) containers = levelContainers;
+      else for (size_t i = 0; i < min(containers.size(), levelContainers.size()); ++i)
+        containers[i].second += levelContainers[i].second;
+    }
+
+    if (containers.empty()) continue;
+
+    vector<unsigned long> localBytes(containers.size()), globalBytes(containers.size());
+    for (size_t i = 0; i < containers.size(); ++i) localBytes[i] = containers[i].second;
+
+    SU2_MPI::Allreduce(localBytes.data(), globalBytes.data(), containers.size(),
+                       MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+    if (rank != MASTER_NODE) continue;
+
+    /*--- Print only the containers that are allocated. ---*/
+
+    string solverName = solver[MESH_0][iSol]->GetSolverName();
+    if (solverName.empty()) solverName = "Solver " + to_string(iSol);
+
+    PrintingToolbox::CTablePrinter MemoryTable(&std::cout);
+    MemoryTable.AddColumn("Container", 25);
+    MemoryTable.AddColumn("Memory [MB]", 14);
+    MemoryTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+
+    cout << "Memory used by the variables of " << solverName << " (all grid levels and ranks):" << endl;
+    MemoryTable.PrintHeader();
+
+    unsigned long totalBytes = 0, nSkipped = 0;
+    for (size_t i = 0; i < containers.size(); ++i) {
+      totalBytes += globalBytes[i];
+      if (globalBytes[i] > 0) MemoryTable << containers[i].first << globalBytes[i]/1048576.0;
+      else ++nSkipped;
+    }
+    MemoryTable.PrintFooter();
+    MemoryTable << "Total" << totalBytes/1048576.0;
+    MemoryTable.PrintFooter();
+
+    cout << nSkipped << " containers are not allocated for this setup." << endl;
+  }
+
+}
+
 void CDriver::Inlet_Preprocessing(CSolver ***solver, CGeometry **geometry,
                                   CConfig *config) {
 
@@ -2934,7 +3208,7 @@ void CDriver::Interface_Preprocessing(CConfig **config, CSolver***** solver, CGe
         /*--- We gather a vector in MASTER_NODE that determines if the boundary is not on the processor because
          * of the partition or because the zone does not include it ---*/
 
-        SU2_MPI::Gather(&markDonor , 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(&markDonor , 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
       if (rank == MASTER_NODE) {
         for (iRank = 0; iRank < nProcessor; iRank++) {
@@ -2946,9 +3220,9 @@ void CDriver::Interface_Preprocessing(CConfig **config, CSolver***** solver, CGe
           }
         }
 
-        SU2_MPI::Bcast(&Donor_check , 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Bcast(&Donor_check , 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
-        SU2_MPI::Gather(&markTarget, 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(&markTarget, 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
       if (rank == MASTER_NODE){
         for (iRank = 0; iRank < nProcessor; iRank++){
@@ -2960,7 +3234,7 @@ void CDriver::Interface_Preprocessing(CConfig **config, CSolver***** solver, CGe
           }
         }
 
-        SU2_MPI::Bcast(&Target_check, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Bcast(&Target_check, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
 #else
       Donor_check  = markDonor;
@@ -4040,7 +4314,8 @@ CHBDriver::CHBDriver(char* confFile,
       ConvHist_file[iZone] = new ofstream[nInst[iZone]];
       for (iInst = 0; iInst < nInst[iZone]; iInst++) {
         output_legacy->SetConvHistory_Header(&ConvHist_file[iZone][iInst], config_container[iZone], iZone, iInst);
-        config_container[iZone]->SetHistFile(&ConvHist_file[iZone][iInst]);
+        /*--- Concurrent instances write the history with their own configuration. ---*/
+        GetInstance_Config(iInst)[iZone]->SetHistFile(&ConvHist_file[iZone][iInst]);
       }
     }
   }
@@ -4074,22 +4349,70 @@ void CHBDriver::Run() {
   /*--- Run a single iteration of a Harmonic Balance problem. Preprocess all
    all zones before beginning the iteration. ---*/
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
-    iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
-        surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+  if (config_instance == NULL) {
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
-    iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
-        surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+    for (iInst = 0; iInst < nInstHB; iInst++)
+      iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, config_container,
+          surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+
+    for (iInst = 0; iInst < nInstHB; iInst++)
+      iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, config_container,
+          surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+  }
+  else {
+
+    /*--- The instances are only coupled by the source terms (SetHarmonicBalance), hence they
+     iterate concurrently, each with its own configuration and communicator. The threads
+     that are left over are shared by the loops over points of each instance. Each instance
+     runs in a team of one thread, otherwise the worksharing, master, and barrier constructs
+     that the solvers use outside of their parallel regions would bind to the team of instances. ---*/
+
+    for (iInst = 1; iInst < nInstHB; iInst++) {
+      config_instance[iInst]->SetInnerIter(config_container[ZONE_0]->GetInnerIter());
+      config_instance[iInst]->SetPhysicalTime(config_container[ZONE_0]->GetPhysicalTime());
+    }
+
+    const int nThread = min<int>(nInstHB, omp_get_max_threads());
+    const int nThreadInst = max(1, omp_get_max_threads()/nThread);
+#ifdef HAVE_OMP
+    const int maxLevels = omp_get_max_active_levels();
+    omp_set_max_active_levels(2);
+#endif
+
+    SU2_OMP_PARALLEL_(for schedule(static,1) num_threads(nThread))
+    for (unsigned short jInst = 0; jInst < nInstHB; jInst++) {
+      SU2_OMP_PARALLEL_ON(1)
+      {
+      omp_set_num_threads(nThreadInst);
+      SU2_MPI::SetThreadComm(comm_instance[jInst]);
+
+      iteration_container[ZONE_0][jInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, GetInstance_Config(jInst),
+          surface_movement, grid_movement, FFDBox, ZONE_0, jInst);
+
+      iteration_container[ZONE_0][jInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, GetInstance_Config(jInst),
+          surface_movement, grid_movement, FFDBox, ZONE_0, jInst);
+
+      /*--- The thread may run other parallel regions, which communicate over the zone. ---*/
+
+      SU2_MPI::ClearThreadComm();
+      }
+    }
+
+#ifdef HAVE_OMP
+    omp_set_max_active_levels(maxLevels);
+#endif
+  }
 
   /*--- Update the convergence history file (serial and parallel computations). ---*/
 
   for (iZone = 0; iZone < nZone; iZone++) {
     for (iInst = 0; iInst < nInst[iZone]; iInst++)
       output_legacy->SetConvHistory_Body(&ConvHist_file[iZone][iInst], geometry_container, solver_container,
-          config_container, integration_container, false, UsedTime, iZone, iInst);
+          GetInstance_Config(iInst), integration_container, false, UsedTime, iZone, iInst);
   }
 
 }
@@ -4112,7 +4435,7 @@ void CHBDriver::Update() {
 
     /*--- Update the harmonic balance terms across all zones ---*/
     iteration_container[ZONE_0][iInst]->Update(output_container[ZONE_0], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
+        solver_container, numerics_container, GetInstance_Config(iInst),
         surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
 
   }
@@ -4146,86 +4469,61 @@ void CHBDriver::ResetConvergence() {
 
 void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
 
-  unsigned short iVar, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
-  unsigned long iPoint;
+  const unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
   bool implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
+  const bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
   if (adjoint) {
     implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   }
 
   unsigned long InnerIter = config_container[ZONE_0]->GetInnerIter();
 
-  /*--- Retrieve values from the config file ---*/
-  su2double *U = new su2double[nVar];
-  su2double *U_old = new su2double[nVar];
-  su2double *Psi = new su2double[nVar];
-  su2double *Psi_old = new su2double[nVar];
-  su2double *Source = new su2double[nVar];
-  su2double deltaU, deltaPsi;
-
-  /*--- Compute period of oscillation ---*/
-  su2double period = config_container[ZONE_0]->GetHarmonicBalance_Period();
-
-  /*--- Non-dimensionalize the input period, if necessary.  */
-  period /= config_container[ZONE_0]->GetTime_Ref();
-
   if (InnerIter == 0)
     ComputeHB_Operator();
 
+  const unsigned short Kind_Sol = adjoint? ADJFLOW_SOL : FLOW_SOL;
+
   /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
   /*--- Loop over all grid levels ---*/
-  for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
+  for (unsigned short iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint(); iPoint++) {
+    const unsigned long nPoint = geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint();
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Source[iVar] = 0.0;
-      }
+    /*--- The points are independent, they are divided among the threads. ---*/
 
-      /*--- Step across the columns ---*/
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+    SU2_OMP_PARALLEL
+    {
+    vector<su2double> Source(nVar);
 
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(nPoint, omp_get_num_threads(), OMP_MAX_SIZE))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
-          if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += U[iVar]*D[iInst][jInst];
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) Source[iVar] = 0.0;
 
-            if (implicit) {
-              U_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaU = U[iVar] - U_old[iVar];
-              Source[iVar] += deltaU*D[iInst][jInst];
-            }
+      /*--- Step across the columns ---*/
+      for (unsigned short jInst = 0; jInst < nInstHB; jInst++) {
 
-          }
+        const CVariable* nodes = solver_container[ZONE_0][jInst][iMGlevel][Kind_Sol]->GetNodes();
 
-          else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += Psi[iVar]*D[jInst][iInst];
+        /*--- The adjoint uses the transposed operator. ---*/
+        const su2double D_ij = adjoint? D[jInst][iInst] : D[iInst][jInst];
 
-            if (implicit) {
-              Psi_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaPsi = Psi[iVar] - Psi_old[iVar];
-              Source[iVar] += deltaPsi*D[jInst][iInst];
-            }
-          }
-        }
+        /*--- Retrieve solution at this node in current zone ---*/
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          const su2double U = nodes->GetSolution(iPoint, iVar);
+          Source[iVar] += U*D_ij;
 
-        /*--- Store sources for current row ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
+          if (implicit) {
+            const su2double deltaU = U - nodes->GetSolution_Old(iPoint, iVar);
+            Source[iVar] += deltaU*D_ij;
           }
         }
-
       }
+
+      /*--- Store sources for current row ---*/
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        solver_container[ZONE_0][iInst][iMGlevel][Kind_Sol]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
+    }
     }
   }
 
@@ -4233,95 +4531,88 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
   if (config_container[ZONE_0]->GetKind_Solver() == RANS) {
 
     /*--- Extra variables needed if we have a turbulence model. ---*/
-    unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
-    su2double *U_Turb = new su2double[nVar_Turb];
-    su2double *Source_Turb = new su2double[nVar_Turb];
+    const unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
+    const unsigned long nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
 
     /*--- Loop over only the finest mesh level (turbulence is always solved
      on the original grid only). ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+
+    SU2_OMP_PARALLEL
+    {
+    vector<su2double> Source_Turb(nVar_Turb);
+
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(nPoint, omp_get_num_threads(), OMP_MAX_SIZE))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
+      for (unsigned short jInst = 0; jInst < nInstHB; jInst++) {
 
         /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar_Turb; iVar++) {
-          U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-          Source_Turb[iVar] += U_Turb[iVar]*D[iInst][jInst];
+        for (unsigned short iVar = 0; iVar < nVar_Turb; iVar++) {
+          const su2double U_Turb = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
+          Source_Turb[iVar] += U_Turb*D[iInst][jInst];
         }
       }
 
       /*--- Store sources for current iZone ---*/
-      for (iVar = 0; iVar < nVar_Turb; iVar++)
+      for (unsigned short iVar = 0; iVar < nVar_Turb; iVar++)
         solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source_Turb[iVar]);
     }
-
-    delete [] U_Turb;
-    delete [] Source_Turb;
+    }
   }
 
-  delete [] Source;
-  delete [] U;
-  delete [] U_old;
-  delete [] Psi;
-  delete [] Psi_old;
-
 }
 
 void CHBDriver::StabilizeHarmonicBalance() {
 
-  unsigned short i, j, k, iVar, iInst, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
-  unsigned long iPoint;
-  bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
+  const unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+  const bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
+  const unsigned short Kind_Sol = adjoint? ADJFLOW_SOL : FLOW_SOL;
 
-  /*--- Retrieve values from the config file ---*/
-  su2double *Source     = new su2double[nInstHB];
-  su2double *Source_old = new su2double[nInstHB];
-  su2double Delta;
+  /*--- Loop over all grid levels ---*/
+  for (unsigned short iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
-  su2double **Pinv     = new su2double*[nInstHB];
-  su2double **P        = new su2double*[nInstHB];
-  for (iInst = 0; iInst < nInstHB; iInst++) {
-    Pinv[iInst]       = new su2double[nInstHB];
-    P[iInst]          = new su2double[nInstHB];
-  }
+    const unsigned long nPoint = geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint();
 
-  /*--- Loop over all grid levels ---*/
-  for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
+    /*--- The points are independent, they are divided among the threads. ---*/
 
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint(); iPoint++) {
+    SU2_OMP_PARALLEL
+    {
+    unsigned short i, j, k, iVar, iInst, jInst;
+
+    /*--- Work arrays of this thread. ---*/
+    vector<su2double> Source(nInstHB), Source_old(nInstHB);
+    su2activematrix Pinv(nInstHB, nInstHB), P(nInstHB, nInstHB);
+
+    /*--  A temporary matrix to hold the inverse ---*/
+    su2activematrix temp(nInstHB, 2*nInstHB);
+
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(nPoint, omp_get_num_threads(), OMP_MAX_SIZE))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
       /*--- Get time step for current node ---*/
-      Delta = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
+      const su2double Delta = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
 
       /*--- Setup stabilization matrix for this node ---*/
       for (iInst = 0; iInst < nInstHB; iInst++) {
         for (jInst = 0; jInst < nInstHB; jInst++) {
           if (jInst == iInst ) {
-            Pinv[iInst][jInst] = 1.0 + Delta*D[iInst][jInst];
+            Pinv(iInst,jInst) = 1.0 + Delta*D[iInst][jInst];
           }
           else {
-            Pinv[iInst][jInst] = Delta*D[iInst][jInst];
+            Pinv(iInst,jInst) = Delta*D[iInst][jInst];
           }
         }
       }
 
       /*--- Invert stabilization matrix Pinv with Gauss elimination---*/
 
-      /*--  A temporary matrix to hold the inverse, dynamically allocated ---*/
-      su2double **temp = new su2double*[nInstHB];
-      for (i = 0; i < nInstHB; i++) {
-        temp[i] = new su2double[2 * nInstHB];
-      }
-
       /*---  Copy the desired matrix into the temporary matrix ---*/
       for (i = 0; i < nInstHB; i++) {
         for (j = 0; j < nInstHB; j++) {
-          temp[i][j] = Pinv[i][j];
-          temp[i][nInstHB + j] = 0;
+          temp(i,j) = Pinv(i,j);
+          temp(i,nInstHB + j) = 0;
         }
-        temp[i][nInstHB + i] = 1;
+        temp(i,nInstHB + i) = 1;
       }
 
       su2double max_val;
@@ -4330,37 +4621,37 @@ void CHBDriver::StabilizeHarmonicBalance() {
       /*---  Pivot each column such that the largest number possible divides the other rows  ---*/
       for (k = 0; k < nInstHB - 1; k++) {
         max_idx = k;
-        max_val = abs(temp[k][k]);
+        max_val = abs(temp(k,k));
         /*---  Find the largest value (pivot) in the column  ---*/
         for (j = k; j < nInstHB; j++) {
-          if (abs(temp[j][k]) > max_val) {
+          if (abs(temp(j,k)) > max_val) {
             max_idx = j;
-            max_val = abs(temp[j][k]);
+            max_val = abs(temp(j,k));
           }
         }
 
         /*---  Move the row with the highest value up  ---*/
         for (j = 0; j < (nInstHB * 2); j++) {
-          su2double d = temp[k][j];
-          temp[k][j] = temp[max_idx][j];
-          temp[max_idx][j] = d;
+          su2double d = temp(k,j);
+          temp(k,j) = temp(max_idx,j);
+          temp(max_idx,j) = d;
         }
         /*---  Subtract the moved row from all other rows ---*/
         for (i = k + 1; i < nInstHB; i++) {
-          su2double c = temp[i][k] / temp[k][k];
+          su2double c = temp(i,k) / temp(k,k);
           for (j = 0; j < (nInstHB * 2); j++) {
-            temp[i][j] = temp[i][j] - temp[k][j] * c;
+            temp(i,j) = temp(i,j) - temp(k,j) * c;
           }
         }
       }
 
       /*---  Back-substitution  ---*/
       for (k = nInstHB - 1; k > 0; k--) {
-        if (temp[k][k] != su2double(0.0)) {
+        if (temp(k,k) != su2double(0.0)) {
           for (int i = k - 1; i > -1; i--) {
-            su2double c = temp[i][k] / temp[k][k];
+            su2double c = temp(i,k) / temp(k,k);
             for (j = 0; j < (nInstHB * 2); j++) {
-              temp[i][j] = temp[i][j] - temp[k][j] * c;
+              temp(i,j) = temp(i,j) - temp(k,j) * c;
             }
           }
         }
@@ -4368,25 +4659,19 @@ void CHBDriver::StabilizeHarmonicBalance() {
 
       /*---  Normalize the inverse  ---*/
       for (i = 0; i < nInstHB; i++) {
-        su2double c = temp[i][i];
+        su2double c = temp(i,i);
         for (j = 0; j < nInstHB; j++) {
-          temp[i][j + nInstHB] = temp[i][j + nInstHB] / c;
+          temp(i,j + nInstHB) = temp(i,j + nInstHB) / c;
         }
       }
 
       /*---  Copy the inverse back to the main program flow ---*/
       for (i = 0; i < nInstHB; i++) {
         for (j = 0; j < nInstHB; j++) {
-          P[i][j] = temp[i][j + nInstHB];
+          P(i,j) = temp(i,j + nInstHB);
         }
       }
 
-      /*---  Delete dynamic template  ---*/
-      for (iInst = 0; iInst < nInstHB; iInst++) {
-        delete[] temp[iInst];
-      }
-      delete[] temp;
-
       /*--- Loop through variables to precondition ---*/
       for (iVar = 0; iVar < nVar; iVar++) {
 
@@ -4399,32 +4684,18 @@ void CHBDriver::StabilizeHarmonicBalance() {
         /*--- Step through columns ---*/
         for (iInst = 0; iInst < nInstHB; iInst++) {
           for (jInst = 0; jInst < nInstHB; jInst++) {
-            Source[iInst] += P[iInst][jInst]*Source_old[jInst];
+            Source[iInst] += P(iInst,jInst)*Source_old[jInst];
           }
 
           /*--- Store updated source terms for current node ---*/
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iInst]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iInst]);
-          }
+          solver_container[ZONE_0][iInst][iMGlevel][Kind_Sol]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iInst]);
         }
 
       }
     }
+    }
   }
 
-  /*--- Deallocate dynamic memory ---*/
-  for (iInst = 0; iInst < nInstHB; iInst++){
-    delete [] P[iInst];
-    delete [] Pinv[iInst];
-  }
-  delete [] P;
-  delete [] Pinv;
-  delete [] Source;
-  delete [] Source_old;
-
 }
 
 void CHBDriver::ComputeHB_Operator() {
@@ -5861,7 +6132,7 @@ bool CDiscAdjFSIDriver::CheckConvergence(unsigned long IntIter,
   /*--- Convergence criteria ---*/
 
   sbuf_conv[0] = adjoint_convergence;
-  SU2_MPI::Reduce(sbuf_conv, rbuf_conv, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Reduce(sbuf_conv, rbuf_conv, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 
   /*-- Compute global convergence criteria in the master node --*/
 
@@ -5871,7 +6142,7 @@ bool CDiscAdjFSIDriver::CheckConvergence(unsigned long IntIter,
     else sbuf_conv[0] = 0;
   }
 
-  SU2_MPI::Bcast(sbuf_conv, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(sbuf_conv, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, SU2_MPI::GetComm());
 
   if (sbuf_conv[0] == 1) { adjoint_convergence = true;}
   else { adjoint_convergence = false;}
@@ -6095,7 +6366,7 @@ bool CDiscAdjFSIDriver::BGSConvergence(unsigned long IntIter,
   /*--- Convergence criteria ---*/
 
   sbuf_conv[0] = Convergence;
-  SU2_MPI::Reduce(sbuf_conv, rbuf_conv, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Reduce(sbuf_conv, rbuf_conv, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 
   /*-- Compute global convergence criteria in the master node --*/
 
@@ -6105,7 +6376,7 @@ bool CDiscAdjFSIDriver::BGSConvergence(unsigned long IntIter,
     else sbuf_conv[0] = 0;
   }
 
-  SU2_MPI::Bcast(sbuf_conv, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(sbuf_conv, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, SU2_MPI::GetComm());
 
   if (sbuf_conv[0] == 1) { Convergence = true;}
   else { Convergence = false;}
@@ -137,7 +137,7 @@ void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
   }
 
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 #endif
 
   /*--- Run a predictor step ---*/
@@ -175,6 +175,7 @@ void CPengRobinson::SetTDState_PT (su2double P, su2double T ) {
     F1 = 3*Z*Z + 2*Z*(B - 1.0) + (A - 2*B - 3*B*B);
     DZ = F/F1;
     Z-= DZ;
+    count++;
   } while(abs(DZ)>toll && count < nmax);
 
   if (count == nmax) {
@@ -27,6 +27,19 @@
 
 
 #include "../include/integration_structure.hpp"
+#include <ctime>
+
+/*--- CPU time of the calling thread where available, it measures the work of
+ a rank even if other processes or threads share its core. ---*/
+static double WorkTime() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  timespec now;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return now.tv_sec + 1e-9*now.tv_nsec;
+#else
+  return SU2_MPI::Wtime();
+#endif
+}
 
 CIntegration::CIntegration(CConfig *config) {
   rank = SU2_MPI::GetRank();
@@ -59,6 +72,17 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
                     (config->GetTime_Marching() == DT_STEPPING_2ND));
 
+  /*--- Measure the work of this rank on the fine grid (WRT_LOAD_IMBALANCE). ---*/
+
+  const bool measure_work = config->GetWrt_Load_Imbalance() && (iMesh == MESH_0);
+  const double StartTime = measure_work? WorkTime() : 0.0;
+
+  /*--- While the Jacobian matrix is lagged the numerics do not compute the Jacobians. ---*/
+
+  const bool frozen = solver_container[MainSolver]->Jacobian.GetFrozen();
+  for (unsigned short iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+    if (numerics[iTerm] != NULL) numerics[iTerm]->SetJacobianFrozen(frozen);
+
   /*--- Compute inviscid residuals ---*/
   
   switch (config->GetKind_ConvNumScheme()) {
@@ -178,6 +202,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
         }
         break;
     }
+
+  if (measure_work) geometry->AddWorkTime(WorkTime()-StartTime);
   
   /*--- Complete residuals for periodic boundary conditions. We loop over
    the periodic BCs in matching pairs so that, in the event that there are
@@ -494,9 +520,9 @@ void CIntegration::SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CCon
       
       /*--- Gather the data on the master node. ---*/
       
-      SU2_MPI::Gather(&plunge, 1, MPI_DOUBLE, plunge_all, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(&pitch, 1, MPI_DOUBLE, pitch_all, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(&owner, 1, MPI_UNSIGNED_LONG, owner_all, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(&plunge, 1, MPI_DOUBLE, plunge_all, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+      SU2_MPI::Gather(&pitch, 1, MPI_DOUBLE, pitch_all, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+      SU2_MPI::Gather(&owner, 1, MPI_UNSIGNED_LONG, owner_all, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
       
       /*--- Set plunge and pitch on the master node ---*/
       
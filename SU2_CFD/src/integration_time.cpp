@@ -27,6 +27,7 @@
 
 
 #include "../include/integration_structure.hpp"
+#include "../../Common/include/omp_structure.hpp"
 
 CMultiGridIntegration::CMultiGridIntegration(CConfig *config) : CIntegration(config) {}
 
@@ -228,371 +229,375 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
 void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                                                       CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short Boundary, iMarker, iChildren, iVar;
-  su2double Area_Parent, Area_Children, *Solution_Fine, *Solution_Coarse;
-  
+  unsigned long Point_Coarse, iVertex;
+  unsigned short Boundary, iMarker;
+
   const unsigned short nVar = sol_coarse->GetnVar();
-  
-  su2double *Solution = new su2double[nVar];
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
-    
-    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
-    
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
-      for (iVar = 0; iVar < nVar; iVar++)
-        Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
+  const unsigned long nPointDomain = geo_coarse->GetnPointDomain();
+  const auto& children = geo_coarse->GetChildrenCV();
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  CVariable* nodes_fine = sol_fine->GetNodes();
+  CVariable* nodes_coarse = sol_coarse->GetNodes();
+
+  SU2_OMP_PARALLEL
+  {
+    vector<su2double> Solution(nVar);
+
+    SU2_OMP_FOR_STAT(chunkSize)
+    for (unsigned long iCoarse = 0; iCoarse < nPointDomain; iCoarse++) {
+
+      su2double Area_Parent = geo_coarse->node[iCoarse]->GetVolume();
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
+
+      for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(iCoarse); iChildren++) {
+        auto Point_Fine = children.getInnerIdx(iCoarse, iChildren);
+        su2double Area_Children = geo_fine->node[Point_Fine]->GetVolume();
+        const su2double *Solution_Fine = nodes_fine->GetSolution(Point_Fine);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
+      }
+
+      const su2double *Solution_Coarse = nodes_coarse->GetSolution(iCoarse);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) Solution[iVar] += Solution_Coarse[iVar];
+
+      nodes_coarse->SetSolution_Old(iCoarse, Solution.data());
     }
-    
-    Solution_Coarse = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      Solution[iVar] += Solution_Coarse[iVar];
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse,Solution);
-    
   }
-  
+
   /*--- Remove any contributions from no-slip walls. ---*/
-  
+
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     Boundary = config->GetMarker_All_KindBC(iMarker);
     if ((Boundary == HEAT_FLUX             ) ||
         (Boundary == ISOTHERMAL            ) ||
         (Boundary == CHT_WALL_INTERFACE    )) {
-      
+
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
-        
+
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        
+
         /*--- For dirichlet boundary condtions, set the correction to zero.
          Note that Solution_Old stores the correction not the actual value ---*/
-        
-        sol_coarse->GetNodes()->SetVelSolutionOldZero(Point_Coarse);
-        
+
+        nodes_coarse->SetVelSolutionOldZero(Point_Coarse);
+
       }
-      
+
     }
   }
-  
+
   /*--- MPI the set solution old ---*/
-  
+
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION_OLD);
   sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_OLD);
 
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
+  /*--- Each fine point has a single parent, thus the injection is free of races. ---*/
+
+  SU2_OMP_PARALLEL_(for schedule(static,chunkSize))
+  for (unsigned long iCoarse = 0; iCoarse < nPointDomain; iCoarse++) {
+    for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(iCoarse); iChildren++) {
+      auto Point_Fine = children.getInnerIdx(iCoarse, iChildren);
+      sol_fine->LinSysRes.SetBlock(Point_Fine, nodes_coarse->GetSolution_Old(iCoarse));
     }
   }
-  
-  delete [] Solution;
-  
+
 }
 
 void CMultiGridIntegration::SmoothProlongated_Correction (unsigned short RunTime_EqSystem, CSolver *solver, CGeometry *geometry,
                                                           unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) {
-  su2double *Residual_Old, *Residual_Sum, *Residual, *Residual_i, *Residual_j;
-  unsigned short iVar, iSmooth, iMarker, nneigh;
-  unsigned long iEdge, iPoint, jPoint, iVertex;
-  
+
+  if (val_nSmooth == 0) return;
+
   const unsigned short nVar = solver->GetnVar();
-  
-  if (val_nSmooth > 0) {
-    
-    Residual = new su2double [nVar];
-    
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-      Residual_Old = solver->LinSysRes.GetBlock(iPoint);
-      solver->GetNodes()->SetResidual_Old(iPoint,Residual_Old);
-    }
-    
+  const unsigned long nPoint = geometry->GetnPoint();
+  const auto chunkSize = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  CVariable* nodes = solver->GetNodes();
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(chunkSize)
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      nodes->SetResidual_Old(iPoint, solver->LinSysRes.GetBlock(iPoint));
+
     /*--- Jacobi iterations ---*/
-    
-    for (iSmooth = 0; iSmooth < val_nSmooth; iSmooth++) {
-      solver->GetNodes()->SetResidualSumZero();
-      
-      /*--- Loop over Interior edges ---*/
-      
-      for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-        iPoint = geometry->edge[iEdge]->GetNode(0);
-        jPoint = geometry->edge[iEdge]->GetNode(1);
-        
-        Residual_i = solver->LinSysRes.GetBlock(iPoint);
-        Residual_j = solver->LinSysRes.GetBlock(jPoint);
-        
-        /*--- Accumulate nearest neighbor Residual to Res_sum for each variable ---*/
-        
-        solver->GetNodes()->AddResidual_Sum(iPoint,Residual_j);
-        solver->GetNodes()->AddResidual_Sum(jPoint,Residual_i);
+
+    for (unsigned short iSmooth = 0; iSmooth < val_nSmooth; iSmooth++) {
+
+      /*--- Accumulate nearest neighbor Residual to Res_sum for each variable, the
+       loop is over points (not edges) so that each thread only updates its points. ---*/
+
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        su2double *Residual_Sum = nodes->GetResidual_Sum(iPoint);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) Residual_Sum[iVar] = 0.0;
+
+        for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+          const su2double *Residual_j = solver->LinSysRes.GetBlock(geometry->node[iPoint]->GetPoint(iNeigh));
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) Residual_Sum[iVar] += Residual_j[iVar];
+        }
       }
-      
+
       /*--- Loop over all mesh points (Update Residuals with averaged sum) ---*/
-      
-      for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-        nneigh = geometry->node[iPoint]->GetnPoint();
-        Residual_Sum = solver->GetNodes()->GetResidual_Sum(iPoint);
-        Residual_Old = solver->GetNodes()->GetResidual_Old(iPoint);
-        for (iVar = 0; iVar < nVar; iVar++) {
-          Residual[iVar] =(Residual_Old[iVar] + val_smooth_coeff*Residual_Sum[iVar])
-          /(1.0 + val_smooth_coeff*su2double(nneigh));
+
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        su2double nneigh = geometry->node[iPoint]->GetnPoint();
+        const su2double *Residual_Sum = nodes->GetResidual_Sum(iPoint);
+        const su2double *Residual_Old = nodes->GetResidual_Old(iPoint);
+        su2double *Residual = solver->LinSysRes.GetBlock(iPoint);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          Residual[iVar] = (Residual_Old[iVar] + val_smooth_coeff*Residual_Sum[iVar])
+                           /(1.0 + val_smooth_coeff*nneigh);
         }
-        solver->LinSysRes.SetBlock(iPoint, Residual);
       }
-      
+
       /*--- Copy boundary values ---*/
-      
-      for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++)
+
+      for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++)
         if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
             (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
-          for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          Residual_Old = solver->GetNodes()->GetResidual_Old(iPoint);
-          solver->LinSysRes.SetBlock(iPoint, Residual_Old);
-        }
+          SU2_OMP_FOR_STAT(OMP_MAX_SIZE)
+          for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+            unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            solver->LinSysRes.SetBlock(iPoint, nodes->GetResidual_Old(iPoint));
+          }
         }
     }
-    
-    delete [] Residual;
-    
   }
+
 }
 
 void CMultiGridIntegration::Smooth_Solution(unsigned short RunTime_EqSystem, CSolver *solver, CGeometry *geometry,
                                             unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) {
-  su2double *Solution_Old, *Solution_Sum, *Solution, *Solution_i, *Solution_j;
-  unsigned short iVar, iSmooth, iMarker, nneigh;
-  unsigned long iEdge, iPoint, jPoint, iVertex;
-  
+
+  if (val_nSmooth == 0) return;
+
   const unsigned short nVar = solver->GetnVar();
-  
-  if (val_nSmooth > 0) {
-    
-    Solution = new su2double [nVar];
-    
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-      Solution_Old = solver->GetNodes()->GetSolution(iPoint);
-      solver->GetNodes()->SetResidual_Old(iPoint,Solution_Old);
-    }
-    
+  const unsigned long nPoint = geometry->GetnPoint();
+  const auto chunkSize = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  CVariable* nodes = solver->GetNodes();
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(chunkSize)
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      nodes->SetResidual_Old(iPoint, nodes->GetSolution(iPoint));
+
     /*--- Jacobi iterations ---*/
-    
-    for (iSmooth = 0; iSmooth < val_nSmooth; iSmooth++) {
-      solver->GetNodes()->SetResidualSumZero();
-      
-      /*--- Loop over Interior edges ---*/
-      
-      for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-        iPoint = geometry->edge[iEdge]->GetNode(0);
-        jPoint = geometry->edge[iEdge]->GetNode(1);
-        
-        Solution_i = solver->GetNodes()->GetSolution(iPoint);
-        Solution_j = solver->GetNodes()->GetSolution(jPoint);
-        
-        /*--- Accumulate nearest neighbor Residual to Res_sum for each variable ---*/
-        
-        solver->GetNodes()->AddResidual_Sum(iPoint,Solution_j);
-        solver->GetNodes()->AddResidual_Sum(jPoint,Solution_i);
+
+    for (unsigned short iSmooth = 0; iSmooth < val_nSmooth; iSmooth++) {
+
+      /*--- Accumulate nearest neighbor Solution to Res_sum for each variable, the
+       loop is over points (not edges) so that each thread only updates its points. ---*/
+
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        su2double *Solution_Sum = nodes->GetResidual_Sum(iPoint);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) Solution_Sum[iVar] = 0.0;
+
+        for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+          const su2double *Solution_j = nodes->GetSolution(geometry->node[iPoint]->GetPoint(iNeigh));
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) Solution_Sum[iVar] += Solution_j[iVar];
+        }
       }
-      
-      /*--- Loop over all mesh points (Update Residuals with averaged sum) ---*/
-      
-      for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-        nneigh = geometry->node[iPoint]->GetnPoint();
-        Solution_Sum = solver->GetNodes()->GetResidual_Sum(iPoint);
-        Solution_Old = solver->GetNodes()->GetResidual_Old(iPoint);
-        for (iVar = 0; iVar < nVar; iVar++) {
-          Solution[iVar] =(Solution_Old[iVar] + val_smooth_coeff*Solution_Sum[iVar])
-          /(1.0 + val_smooth_coeff*su2double(nneigh));
+
+      /*--- Loop over all mesh points (Update Solution with averaged sum) ---*/
+
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        su2double nneigh = geometry->node[iPoint]->GetnPoint();
+        const su2double *Solution_Sum = nodes->GetResidual_Sum(iPoint);
+        const su2double *Solution_Old = nodes->GetResidual_Old(iPoint);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          nodes->SetSolution(iPoint, iVar, (Solution_Old[iVar] + val_smooth_coeff*Solution_Sum[iVar])
+                                           /(1.0 + val_smooth_coeff*nneigh));
         }
-        solver->GetNodes()->SetSolution(iPoint,Solution);
       }
-      
+
       /*--- Copy boundary values ---*/
-      
-      for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++)
+
+      for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++)
         if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
             (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
-          for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          Solution_Old = solver->GetNodes()->GetResidual_Old(iPoint);
-          solver->GetNodes()->SetSolution(iPoint,Solution_Old);
-        }
+          SU2_OMP_FOR_STAT(OMP_MAX_SIZE)
+          for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+            unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            nodes->SetSolution(iPoint, nodes->GetResidual_Old(iPoint));
+          }
         }
     }
-    
-    delete [] Solution;
-    
   }
-  
+
 }
 
 void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config, unsigned short iMesh) {
-  unsigned long Point_Fine;
-  unsigned short iVar;
-  su2double *Solution_Fine, *Residual_Fine;
-  
+
   const unsigned short nVar = sol_fine->GetnVar();
-  su2double factor = config->GetDamp_Correc_Prolong(); //pow(config->GetDamp_Correc_Prolong(), iMesh+1);
-  
-  su2double *Solution = new su2double [nVar];
-  
-  for (Point_Fine = 0; Point_Fine < geo_fine->GetnPointDomain(); Point_Fine++) {
-    Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
-    Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
-    for (iVar = 0; iVar < nVar; iVar++) {
+  const unsigned long nPointDomain = geo_fine->GetnPointDomain();
+  const su2double factor = config->GetDamp_Correc_Prolong(); //pow(config->GetDamp_Correc_Prolong(), iMesh+1);
+
+  CVariable* nodes_fine = sol_fine->GetNodes();
+
+  SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE)))
+  for (unsigned long Point_Fine = 0; Point_Fine < nPointDomain; Point_Fine++) {
+    su2double *Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+    su2double *Solution_Fine = nodes_fine->GetSolution(Point_Fine);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       /*--- Prevent a fine grid divergence due to a coarse grid divergence ---*/
       if (Residual_Fine[iVar] != Residual_Fine[iVar]) Residual_Fine[iVar] = 0.0;
-      Solution[iVar] = Solution_Fine[iVar]+factor*Residual_Fine[iVar];
+      Solution_Fine[iVar] += factor*Residual_Fine[iVar];
     }
-    sol_fine->GetNodes()->SetSolution(Point_Fine,Solution);
   }
-  
+
   /*--- MPI the new interpolated solution ---*/
-  
+
   sol_fine->InitiateComms(geo_fine, config, SOLUTION);
   sol_fine->CompleteComms(geo_fine, config, SOLUTION);
-  
-  delete [] Solution;
+
 }
 
 
 void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iChildren;
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
+
+  const unsigned long nPointDomain = geo_coarse->GetnPointDomain();
+  const auto& children = geo_coarse->GetChildrenCV();
+
+  SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE)))
+  for (unsigned long Point_Coarse = 0; Point_Coarse < nPointDomain; Point_Coarse++) {
+    for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(Point_Coarse); iChildren++) {
+      auto Point_Fine = children.getInnerIdx(Point_Coarse, iChildren);
       sol_fine->GetNodes()->SetSolution(Point_Fine, sol_coarse->GetNodes()->GetSolution(Point_Coarse));
     }
   }
 }
 
 void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iVar, iChildren;
-  su2double *Residual_Fine;
-  
+  unsigned long Point_Coarse, iVertex;
+  unsigned short iMarker;
+
   const unsigned short nVar = sol_coarse->GetnVar();
-  su2double factor = config->GetDamp_Res_Restric(); //pow(config->GetDamp_Res_Restric(), iMesh);
-  
-  su2double *Residual = new su2double[nVar];
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
-    
-    for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
-      for (iVar = 0; iVar < nVar; iVar++)
+  const unsigned long nPointDomain = geo_coarse->GetnPointDomain();
+  const su2double factor = config->GetDamp_Res_Restric(); //pow(config->GetDamp_Res_Restric(), iMesh);
+  const auto& children = geo_coarse->GetChildrenCV();
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  CVariable* nodes_coarse = sol_coarse->GetNodes();
+
+  SU2_OMP_PARALLEL_(for schedule(static,chunkSize))
+  for (unsigned long iCoarse = 0; iCoarse < nPointDomain; iCoarse++) {
+    nodes_coarse->SetRes_TruncErrorZero(iCoarse);
+    su2double *Residual = nodes_coarse->GetResTruncError(iCoarse);
+
+    for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(iCoarse); iChildren++) {
+      auto Point_Fine = children.getInnerIdx(iCoarse, iChildren);
+      const su2double *Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
         Residual[iVar] += factor*Residual_Fine[iVar];
     }
-    sol_coarse->GetNodes()->AddRes_TruncError(Point_Coarse,Residual);
   }
-  
+
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
         (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
         (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE    )) {
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+        nodes_coarse->SetVel_ResTruncError_Zero(Point_Coarse);
       }
     }
   }
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    sol_coarse->GetNodes()->SubtractRes_TruncError(Point_Coarse, sol_coarse->LinSysRes.GetBlock(Point_Coarse));
+
+  SU2_OMP_PARALLEL_(for schedule(static,chunkSize))
+  for (unsigned long iCoarse = 0; iCoarse < nPointDomain; iCoarse++) {
+    nodes_coarse->SubtractRes_TruncError(iCoarse, sol_coarse->LinSysRes.GetBlock(iCoarse));
   }
-  
-  delete [] Residual;
+
 }
 
 void CMultiGridIntegration::SetResidual_Term(CGeometry *geometry, CSolver *solver) {
-  unsigned long iPoint;
-  
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+  SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE)))
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
     solver->LinSysRes.AddBlock(iPoint, solver->GetNodes()->GetResTruncError(iPoint));
-  
+
 }
 
 void CMultiGridIntegration::SetRestricted_Residual(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iVar, iChildren;
-  su2double *Residual_Fine;
-  
+  unsigned long iVertex, Point_Coarse;
+  unsigned short iMarker;
+
   const unsigned short nVar = sol_coarse->GetnVar();
-  
-  su2double *Residual = new su2double[nVar];
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
-    
-    for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
-      for (iVar = 0; iVar < nVar; iVar++)
+  const unsigned long nPointDomain = geo_coarse->GetnPointDomain();
+  const auto& children = geo_coarse->GetChildrenCV();
+
+  CVariable* nodes_coarse = sol_coarse->GetNodes();
+
+  SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE)))
+  for (unsigned long iCoarse = 0; iCoarse < nPointDomain; iCoarse++) {
+    nodes_coarse->SetRes_TruncErrorZero(iCoarse);
+    su2double *Residual = nodes_coarse->GetResTruncError(iCoarse);
+
+    for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(iCoarse); iChildren++) {
+      auto Point_Fine = children.getInnerIdx(iCoarse, iChildren);
+      const su2double *Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
         Residual[iVar] += Residual_Fine[iVar];
     }
-    sol_coarse->GetNodes()->AddRes_TruncError(Point_Coarse,Residual);
   }
-  
+
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
         (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
         (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE    )) {
       for (iVertex = 0; iVertex<geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+        nodes_coarse->SetVel_ResTruncError_Zero(Point_Coarse);
       }
     }
   }
-  
-  delete [] Residual;
+
 }
 
 void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iVar, iChildren, iDim;
-  su2double Area_Parent, Area_Children, *Solution_Fine, *Grid_Vel, Vector[3];
+  unsigned long iVertex, Point_Coarse;
+  unsigned short iMarker, iDim;
+  su2double *Grid_Vel, Vector[3];
   
   const unsigned short SolContainer_Position = config->GetContainerPosition(RunTime_EqSystem);
   const unsigned short nVar = sol_coarse->GetnVar();
   const unsigned short nDim = geo_fine->GetnDim();
   const bool grid_movement  = config->GetGrid_Movement();
   
-  su2double *Solution = new su2double[nVar];
-  
+  const unsigned long nPointDomain = geo_coarse->GetnPointDomain();
+  const auto& children = geo_coarse->GetChildrenCV();
+
   /*--- Compute coarse solution from fine solution ---*/
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
-    
-    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
-    
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
-      for (iVar = 0; iVar < nVar; iVar++) {
+
+  SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE)))
+  for (unsigned long iCoarse = 0; iCoarse < nPointDomain; iCoarse++) {
+    su2double Area_Parent = geo_coarse->node[iCoarse]->GetVolume();
+
+    su2double *Solution = sol_coarse->GetNodes()->GetSolution(iCoarse);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
+
+    for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(iCoarse); iChildren++) {
+
+      auto Point_Fine = children.getInnerIdx(iCoarse, iChildren);
+      su2double Area_Children = geo_fine->node[Point_Fine]->GetVolume();
+      const su2double *Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
         Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
       }
     }
-    
-    sol_coarse->GetNodes()->SetSolution(Point_Coarse,Solution);
-    
+
   }
   
   /*--- Update the solution at the no-slip walls ---*/
@@ -635,47 +640,38 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION);
   sol_coarse->CompleteComms(geo_coarse, config, SOLUTION);
-  
-  delete [] Solution;
-  
+
 }
 
 void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                                                    CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iVar, iDim, iChildren;
-  su2double Area_Parent, Area_Children, **Gradient_fine;
-  
+
   const unsigned short nDim = geo_coarse->GetnDim();
   const unsigned short nVar = sol_coarse->GetnVar();
-  
-  su2double **Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Gradient[iVar] = new su2double [nDim];
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPoint(); Point_Coarse++) {
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      for (iDim = 0; iDim < nDim; iDim++)
+  const unsigned long nPoint = geo_coarse->GetnPoint();
+  const auto& children = geo_coarse->GetChildrenCV();
+
+  SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE)))
+  for (unsigned long iCoarse = 0; iCoarse < nPoint; iCoarse++) {
+    su2double Area_Parent = geo_coarse->node[iCoarse]->GetVolume();
+
+    su2double **Gradient = sol_coarse->GetNodes()->GetGradient(iCoarse);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
         Gradient[iVar][iDim] = 0.0;
-    
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Gradient_fine = sol_fine->GetNodes()->GetGradient(Point_Fine);
-      
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (iDim = 0; iDim < nDim; iDim++)
+
+    for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(iCoarse); iChildren++) {
+      auto Point_Fine = children.getInnerIdx(iCoarse, iChildren);
+      su2double Area_Children = geo_fine->node[Point_Fine]->GetVolume();
+      su2double **Gradient_fine = sol_fine->GetNodes()->GetGradient(Point_Fine);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
           Gradient[iVar][iDim] += Gradient_fine[iVar][iDim]*Area_Children/Area_Parent;
     }
-    sol_coarse->GetNodes()->SetGradient(Point_Coarse,Gradient);
   }
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
+
 }
 
 void CMultiGridIntegration::NonDimensional_Parameters(CGeometry **geometry, CSolver ***solver_container, CNumerics ****numerics_container,
@@ -770,65 +766,64 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 }
 
 void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iVar, iChildren;
-  su2double Area_Parent, Area_Children, *Solution_Fine, *Solution;
-  
-  unsigned short nVar = sol_coarse->GetnVar();
-  
-  Solution = new su2double[nVar];
-  
+
+  const unsigned short nVar = sol_coarse->GetnVar();
+  const unsigned long nPointDomain = geo_coarse->GetnPointDomain();
+  const auto& children = geo_coarse->GetChildrenCV();
+
   /*--- Compute coarse solution from fine solution ---*/
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
-    
-    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
-    
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
-      for (iVar = 0; iVar < nVar; iVar++)
+
+  SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE)))
+  for (unsigned long iCoarse = 0; iCoarse < nPointDomain; iCoarse++) {
+    su2double Area_Parent = geo_coarse->node[iCoarse]->GetVolume();
+
+    su2double *Solution = sol_coarse->GetNodes()->GetSolution(iCoarse);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
+
+    for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(iCoarse); iChildren++) {
+
+      auto Point_Fine = children.getInnerIdx(iCoarse, iChildren);
+      su2double Area_Children = geo_fine->node[Point_Fine]->GetVolume();
+      const su2double *Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
         Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
     }
-    
-    sol_coarse->GetNodes()->SetSolution(Point_Coarse,Solution);
-    
+
   }
-  
+
   /*--- MPI the new interpolated solution ---*/
-  
+
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION);
   sol_coarse->CompleteComms(geo_coarse, config, SOLUTION);
-  
-  delete [] Solution;
-  
+
 }
 
 void CSingleGridIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
   
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iChildren;
-  su2double Area_Parent, Area_Children, EddyVisc_Fine, EddyVisc;
-  
+  unsigned long iVertex, Point_Coarse;
+  unsigned short iMarker;
+
+  const unsigned long nPointDomain = geo_coarse->GetnPointDomain();
+  const auto& children = geo_coarse->GetChildrenCV();
+
   /*--- Compute coarse Eddy Viscosity from fine solution ---*/
-  
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
-    
-    EddyVisc = 0.0;
-    
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      EddyVisc_Fine = sol_fine->GetNodes()->GetmuT(Point_Fine);
+
+  SU2_OMP_PARALLEL_(for schedule(static,computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE)))
+  for (unsigned long iCoarse = 0; iCoarse < nPointDomain; iCoarse++) {
+    su2double Area_Parent = geo_coarse->node[iCoarse]->GetVolume();
+
+    su2double EddyVisc = 0.0;
+
+    for (auto iChildren = 0ul; iChildren < children.getNumNonZeros(iCoarse); iChildren++) {
+      auto Point_Fine = children.getInnerIdx(iCoarse, iChildren);
+      su2double Area_Children = geo_fine->node[Point_Fine]->GetVolume();
+      su2double EddyVisc_Fine = sol_fine->GetNodes()->GetmuT(Point_Fine);
       EddyVisc += EddyVisc_Fine*Area_Children/Area_Parent;
     }
-    
-    sol_coarse->GetNodes()->SetmuT(Point_Coarse,EddyVisc);
-    
+
+    sol_coarse->GetNodes()->SetmuT(iCoarse,EddyVisc);
+
   }
   
   /*--- Update solution at the no slip wall boundary, only the first
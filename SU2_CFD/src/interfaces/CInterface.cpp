@@ -183,7 +183,7 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
     /*--- We gather a vector in MASTER_NODE that determines if the boundary is not on the processor
      * because of the partition or because the zone does not include it  ---*/
 
-    SU2_MPI::Gather(&Marker_Donor , 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(&Marker_Donor , 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
     if (rank == MASTER_NODE) {
       for (iRank = 0; iRank < nProcessor; iRank++) {
@@ -194,9 +194,9 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
       }
     }
 
-    SU2_MPI::Bcast(&Donor_check , 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&Donor_check , 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
-    SU2_MPI::Gather(&Marker_Target, 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(&Marker_Target, 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
     if (rank == MASTER_NODE) {
       for (iRank = 0; iRank < nProcessor; iRank++) {
@@ -207,7 +207,7 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
       }
     }
 
-    SU2_MPI::Bcast(&Target_check, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&Target_check, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
 #else
     Donor_check  = Marker_Donor;
@@ -239,14 +239,14 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
 #ifdef HAVE_MPI
     /*--- We receive MaxLocalVertexDonor as the maximum number of vertices
      * in one single processor on the donor side---*/
-    SU2_MPI::Allreduce(&nLocalVertexDonor, &MaxLocalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&nLocalVertexDonor, &MaxLocalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
     /*--- We receive TotalVertexDonorOwned as the total (real) number of vertices
      * in one single interface marker on the donor side ---*/
-    SU2_MPI::Allreduce(&nLocalVertexDonorOwned, &TotalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&nLocalVertexDonorOwned, &TotalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
     /*--- We gather a vector in MASTER_NODE that determines how many elements are there
      * on each processor on the structural side ---*/
     SU2_MPI::Gather(&Buffer_Send_nVertexDonor, 1, MPI_UNSIGNED_LONG, Buffer_Recv_nVertexDonor, 1,
-                    MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+                    MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
 #else
     MaxLocalVertexDonor         = nLocalVertexDonor;
     TotalVertexDonor            = nLocalVertexDonorOwned;
@@ -311,9 +311,9 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
 #ifdef HAVE_MPI
     /*--- Once all the messages have been prepared, we gather them all into the MASTER_NODE ---*/
     SU2_MPI::Gather(Buffer_Send_DonorVariables, nBuffer_DonorVariables, MPI_DOUBLE, Buffer_Recv_DonorVariables,
-                    nBuffer_DonorVariables, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+                    nBuffer_DonorVariables, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
     SU2_MPI::Gather(Buffer_Send_DonorIndices, nBuffer_DonorIndices, MPI_LONG, Buffer_Recv_DonorIndices,
-                    nBuffer_DonorIndices, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
+                    nBuffer_DonorIndices, MPI_LONG, MASTER_NODE, SU2_MPI::GetComm());
 
 #else
     for (unsigned long iVariable = 0; iVariable < nBuffer_DonorVariables; iVariable++)
@@ -353,8 +353,8 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
     }
 
 #ifdef HAVE_MPI
-    SU2_MPI::Bcast(Buffer_Bcast_Variables, nBuffer_BcastVariables, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(Buffer_Bcast_Indices, nBuffer_BcastIndices, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(Buffer_Bcast_Variables, nBuffer_BcastVariables, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Bcast(Buffer_Bcast_Indices, nBuffer_BcastIndices, MPI_LONG, MASTER_NODE, SU2_MPI::GetComm());
 #endif
 
     long indexPoint_iVertex;
@@ -485,8 +485,8 @@ void CInterface::PreprocessAverage(CGeometry *donor_geometry, CGeometry *target_
     BuffDonorFlag[iSize]              = -1;
   }
 
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(&Donor_Flag, 1 , MPI_INT, BuffDonorFlag, 1, MPI_INT, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(&Donor_Flag, 1 , MPI_INT, BuffDonorFlag, 1, MPI_INT, SU2_MPI::GetComm());
 
 
   Marker_Donor= -1;
@@ -712,22 +712,22 @@ void CInterface::AllgatherAverage(CSolver *donor_solution, CSolver *target_solut
   }
 
   SU2_MPI::Allgather(avgDensityDonor, nSpanDonor , MPI_DOUBLE, BuffAvgDensityDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
+                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
   SU2_MPI::Allgather(avgPressureDonor, nSpanDonor , MPI_DOUBLE, BuffAvgPressureDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
+                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
   SU2_MPI::Allgather(avgNormalVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNormalVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
+                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
   SU2_MPI::Allgather(avgTangVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgTangVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
+                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
   SU2_MPI::Allgather(avg3DVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvg3DVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
+                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
   SU2_MPI::Allgather(avgNuDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNuDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
+                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
   SU2_MPI::Allgather(avgKineDonor, nSpanDonor , MPI_DOUBLE, BuffAvgKineDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
+                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
   SU2_MPI::Allgather(avgOmegaDonor, nSpanDonor , MPI_DOUBLE, BuffAvgOmegaDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, MPI_COMM_WORLD);
+                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, SU2_MPI::GetComm());
 
   for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
     avgDensityDonor[iSpan]            = -1.0;
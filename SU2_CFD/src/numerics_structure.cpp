@@ -58,6 +58,10 @@ CNumerics::CNumerics(void) {
   
   using_uq = false;
 
+  implicit = false;
+  jacobian_frozen = false;
+  implicit_unfrozen = false;
+
 }
 
 CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
@@ -108,6 +112,10 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
   Prandtl_Turb = config->GetPrandtl_Turb();
   Gas_Constant = config->GetGas_ConstantND();
 
+  implicit = false;
+  jacobian_frozen = false;
+  implicit_unfrozen = false;
+
   UnitNormal = new su2double [nDim];
   UnitNormald = new su2double [nDim];
 
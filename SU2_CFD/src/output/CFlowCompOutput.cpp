@@ -272,6 +272,8 @@ void CFlowCompOutput::SetHistoryOutputFields(CConfig *config){
 
   AddAerodynamicCoefficients(config);
 
+  AddProbeOutput(config);
+
   /*--- Add Cp diff fields ---*/
 
   Add_CpInverseDesignOutput(config);
@@ -675,6 +677,8 @@ void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
 
   SetAerodynamicCoefficients(config, flow_solver);
 
+  SetProbes(config, geometry, flow_solver);
+
   /*--- Set Cp diff fields ---*/
 
   Set_CpInverseDesign(flow_solver, geometry, config);
@@ -213,6 +213,8 @@ void CFlowIncOutput::SetHistoryOutputFields(CConfig *config){
 
   AddAerodynamicCoefficients(config);
 
+  AddProbeOutput(config);
+
 }
 
 void CFlowIncOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolver **solver) {
@@ -318,6 +320,8 @@ void CFlowIncOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolv
 
   SetAerodynamicCoefficients(config, flow_solver);
 
+  SetProbes(config, geometry, flow_solver);
+
 }
 
 
@@ -34,7 +34,11 @@ CFlowOutput::CFlowOutput(CConfig *config, unsigned short nDim, bool fem_output)
 }
 
 
-CFlowOutput::~CFlowOutput(void){}
+CFlowOutput::~CFlowOutput(void){
+
+  delete probes;
+
+}
 
 void CFlowOutput::AddAnalyzeSurfaceOutput(CConfig *config){
 
@@ -373,19 +377,19 @@ void CFlowOutput::SetAnalyzeSurface(CSolver *solver, CGeometry *geometry, CConfi
 
 #ifdef HAVE_MPI
 
-  SU2_MPI::Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Mach_Local, Surface_Mach_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Temperature_Local, Surface_Temperature_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Density_Local, Surface_Density_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Enthalpy_Local, Surface_Enthalpy_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Pressure_Local, Surface_Pressure_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TotalPressure_Local, Surface_TotalPressure_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Area_Local, Surface_Area_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_Mach_Local, Surface_Mach_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_Temperature_Local, Surface_Temperature_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_Density_Local, Surface_Density_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_Enthalpy_Local, Surface_Enthalpy_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_Pressure_Local, Surface_Pressure_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_TotalPressure_Local, Surface_TotalPressure_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_Area_Local, Surface_Area_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
 #else
 
@@ -805,7 +809,7 @@ void CFlowOutput::Set_CpInverseDesign(CSolver *solver, CGeometry *geometry, CCon
 
     nPointLocal = geometry->GetnPoint();
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&nPointLocal, &nPointGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&nPointLocal, &nPointGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 #else
     nPointGlobal = nPointLocal;
 #endif
@@ -900,7 +904,7 @@ void CFlowOutput::Set_CpInverseDesign(CSolver *solver, CGeometry *geometry, CCon
 
 #ifdef HAVE_MPI
     su2double MyPressDiff = PressDiff;
-    SU2_MPI::Allreduce(&MyPressDiff, &PressDiff, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyPressDiff, &PressDiff, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 #endif
 
   }
@@ -946,6 +950,60 @@ su2double CFlowOutput::GetQ_Criterion(su2double** VelocityGradient) const {
   return Q;
 }
 
+void CFlowOutput::AddProbeOutput(CConfig *config){
+
+  const auto fieldNames = CInSituExtraction::GetFieldNames(nDim);
+  const vector<string> shortNames = {"P", "Rho", "T", "U", "V", "W"};
+
+  for (unsigned short iProbe = 0; iProbe < config->GetnProbes(); iProbe++) {
+    const string probe = to_string(iProbe);
+    for (unsigned short iField = 0; iField < fieldNames.size(); iField++) {
+      /// DESCRIPTION: Flow variables interpolated at the probes.
+      AddHistoryOutput("PROBE" + probe + "_" + fieldNames[iField], shortNames[iField] + "(probe" + probe + ")",
+                       ScreenOutputFormat::SCIENTIFIC, "PROBE", "Flow variable at probe " + probe + " of PROBE_COORDS");
+    }
+  }
+}
+
+void CFlowOutput::SetProbes(CConfig *config, CGeometry *geometry, CSolver *solver){
+
+  if (config->GetnProbes() == 0) return;
+
+  /*--- The probes are located on the first call, and interpolated at the same time. ---*/
+
+  const unsigned long iter = config->GetTime_Domain()? curTimeIter : curInnerIter;
+  bool interpolate = (iter % config->GetProbe_Wrt_Freq() == 0);
+
+  if (probes == nullptr) {
+    probes = new CProbeInterpolator(config, geometry);
+    interpolate = true;
+  }
+
+  if (!interpolate) return;
+
+  probes->Interpolate(solver->GetNodes());
+
+  const auto fieldNames = CInSituExtraction::GetFieldNames(nDim);
+
+  for (unsigned short iProbe = 0; iProbe < probes->GetnProbe(); iProbe++) {
+    for (unsigned short iField = 0; iField < fieldNames.size(); iField++) {
+      SetHistoryOutputValue("PROBE" + to_string(iProbe) + "_" + fieldNames[iField], probes->GetValue(iProbe, iField));
+    }
+  }
+}
+
+void CFlowOutput::WriteInSituFiles(CConfig *config, CGeometry *geometry, CSolver **solver_container, unsigned long iter){
+
+  if ((config->GetnSlices() == 0) || (iter % config->GetSlice_Wrt_Freq() != 0)) return;
+
+  CSliceExtractor slice(nDim);
+
+  for (unsigned short iSlice = 0; iSlice < config->GetnSlices(); iSlice++) {
+    const string fileName = config->GetFilename("slice_" + to_string(iSlice), ".vtk", iter);
+    slice.WriteSlice(config, geometry, solver_container[FLOW_SOL]->GetNodes(), iSlice, fileName);
+  }
+}
+
 void CFlowOutput::WriteAdditionalFiles(CConfig *config, CGeometry *geometry, CSolver **solver_container){
 
   if (config->GetFixed_CL_Mode() || config->GetFixed_CM_Mode()){
@@ -35,6 +35,7 @@
 #include "../../include/output/filewriter/CParaviewBinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CParaviewXMLFileWriter.hpp"
 #include "../../include/output/filewriter/CParaviewVTMFileWriter.hpp"
+#include "../../include/output/filewriter/CParaviewPVTUFileWriter.hpp"
 #include "../../include/output/filewriter/CTecplotFileWriter.hpp"
 #include "../../include/output/filewriter/CTecplotBinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CCSVFileWriter.hpp"
@@ -484,6 +485,25 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
+    case PARAVIEW_PVTU:
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+
+      if (femOutput) {
+        SU2_MPI::Error("PARAVIEW_PVTU output is only available for finite volume solvers.", CURRENT_FUNCTION);
+      }
+
+      /*--- Written directly from the unsorted data of each partition, no sorting required. ---*/
+
+      if (rank == MASTER_NODE) {
+        (*fileWritingTable) << "Paraview partitioned" << fileName + CParaviewPVTUFileWriter::fileExt;
+      }
+
+      fileWriter = new CParaviewPVTUFileWriter(fileName, volumeDataSorter, geometry);
+
+      break;
+
     case PARAVIEW_MULTIBLOCK:
       {
 
@@ -554,7 +574,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           /*--- Only sort if there is at least one processor that has this marker ---*/
 
           int globalMarkerSize = 0, localMarkerSize = marker.size();
-          SU2_MPI::Allreduce(&localMarkerSize, &globalMarkerSize, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+          SU2_MPI::Allreduce(&localMarkerSize, &globalMarkerSize, 1, MPI_INT, MPI_SUM, SU2_MPI::GetComm());
 
           if (globalMarkerSize > 0){
 
@@ -749,6 +769,10 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
   bool writeFiles = WriteVolume_Output(config, iter, force_writing);
 
+  /*--- Write the in-situ extractions, they have their own frequency. ---*/
+
+  WriteInSituFiles(config, geometry, solver_container, iter);
+
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
 
   AllocateDataSorters(config, geometry);
@@ -762,13 +786,17 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
   if (writeFiles){
 
-    /*--- Partition and sort the data --- */
-
-    volumeDataSorter->SortOutputData();
-
     unsigned short nVolumeFiles = config->GetnVolumeOutputFiles();
     unsigned short *VolumeFiles = config->GetVolumeOutputFiles();
 
+    /*--- Partition and sort the data, unless only partitioned files are requested. --- */
+
+    bool sortData = false;
+    for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++)
+      sortData |= (VolumeFiles[iFile] != PARAVIEW_PVTU);
+
+    if (sortData) volumeDataSorter->SortOutputData();
+
     if (rank == MASTER_NODE && nVolumeFiles != 0){
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
       fileWritingTable->PrintHeader();
@@ -921,7 +949,7 @@ bool COutput::Convergence_Monitoring(CConfig *config, unsigned long Iteration) {
   /*--- Convergence criteria ---*/
 
   sbuf_conv[0] = convergence;
-  SU2_MPI::Reduce(sbuf_conv, rbuf_conv, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Reduce(sbuf_conv, rbuf_conv, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 
   /*-- Compute global convergence criteria in the master node --*/
 
@@ -931,7 +959,7 @@ bool COutput::Convergence_Monitoring(CConfig *config, unsigned long Iteration) {
     else sbuf_conv[0] = 0;
   }
 
-  SU2_MPI::Bcast(sbuf_conv, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(sbuf_conv, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, SU2_MPI::GetComm());
 
   if (sbuf_conv[0] == 1) { convergence = true; }
   else { convergence = false;  }
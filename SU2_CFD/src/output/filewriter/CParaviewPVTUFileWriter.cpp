@@ -0,0 +1,334 @@
+/*!
+ * \file CParaviewPVTUFileWriter.cpp
+ * \brief Filewriter class for the partitioned paraview XML format (vtu pieces + pvtu index).
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CParaviewPVTUFileWriter.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+#include <algorithm>
+
+const string CParaviewPVTUFileWriter::fileExt = ".pvtu";
+const string CParaviewPVTUFileWriter::pieceExt = ".vtu";
+
+namespace {
+
+/*--- Minimal buffered writer of the appended raw data of a vtu file. ---*/
+
+class CAppendedData {
+  string header;
+  vector<char> data;
+public:
+  template<class T>
+  void AddArray(const string& type, const string& name, unsigned short nComp, const vector<T>& values) {
+    header += "<DataArray type=\"" + type + "\" Name=\"" + name + "\" NumberOfComponents=\"" +
+              to_string(nComp) + "\" offset=\"" + to_string(data.size()) + "\" format=\"appended\"/>\n";
+    const int nBytes = values.size()*sizeof(T);
+    const char* size = reinterpret_cast<const char*>(&nBytes);
+    const char* begin = reinterpret_cast<const char*>(values.data());
+    data.insert(data.end(), size, size+sizeof(int));
+    data.insert(data.end(), begin, begin+nBytes);
+  }
+  string Flush() { string tmp; tmp.swap(header); return tmp; }
+  const vector<char>& GetData() const { return data; }
+};
+
+su2double WallTime() {
+#ifdef HAVE_MPI
+  return MPI_Wtime();
+#else
+  return su2double(clock())/su2double(CLOCKS_PER_SEC);
+#endif
+}
+
+}
+
+CParaviewPVTUFileWriter::CParaviewPVTUFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                                 CGeometry *valGeometry) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt), geometry(valGeometry) {}
+
+CParaviewPVTUFileWriter::~CParaviewPVTUFileWriter(){
+
+}
+
+passivedouble CParaviewPVTUFileWriter::GetPointData(unsigned long iPoint, unsigned short iField) const {
+
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+  if (iPoint < nPointDomain)
+    return SU2_TYPE::GetValue(dataSorter->GetUnsorted_Data(iPoint, iField));
+
+  return haloData[(iPoint-nPointDomain)*dataSorter->GetFieldNames().size() + iField];
+}
+
+void CParaviewPVTUFileWriter::CommunicateHaloData(){
+
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nField = dataSorter->GetFieldNames().size();
+
+  haloData.assign((geometry->GetnPoint()-nPointDomain)*nField, 0.0);
+
+#ifdef HAVE_MPI
+
+  /*--- Same pattern as the solution comms, the data of the send points is
+   packed per neighbor and unpacked into the halo points. ---*/
+
+  const int nSend = geometry->nP2PSend, nRecv = geometry->nP2PRecv;
+  const int *sendStart = geometry->nPoint_P2PSend, *recvStart = geometry->nPoint_P2PRecv;
+
+  vector<passivedouble> sendBuf(sendStart[nSend]*nField), recvBuf(recvStart[nRecv]*nField);
+  vector<SU2_MPI::Request> request(nSend+nRecv);
+
+  for (int iRecv = 0; iRecv < nRecv; iRecv++) {
+    const int count = (recvStart[iRecv+1]-recvStart[iRecv])*nField;
+    SU2_MPI::Irecv(&recvBuf[recvStart[iRecv]*nField], count, MPI_DOUBLE,
+                   geometry->Neighbors_P2PRecv[iRecv], geometry->Neighbors_P2PRecv[iRecv]+1,
+                   SU2_MPI::GetComm(), &request[iRecv]);
+  }
+
+  for (int iSend = 0; iSend < nSend; iSend++) {
+    for (int iMsg = sendStart[iSend]; iMsg < sendStart[iSend+1]; iMsg++) {
+      const unsigned long iPoint = geometry->Local_Point_P2PSend[iMsg];
+      for (unsigned short iField = 0; iField < nField; iField++)
+        sendBuf[iMsg*nField+iField] = GetPointData(iPoint, iField);
+    }
+    const int count = (sendStart[iSend+1]-sendStart[iSend])*nField;
+    SU2_MPI::Isend(&sendBuf[sendStart[iSend]*nField], count, MPI_DOUBLE,
+                   geometry->Neighbors_P2PSend[iSend], rank+1, SU2_MPI::GetComm(), &request[nRecv+iSend]);
+  }
+
+  SU2_MPI::Waitall(nSend+nRecv, request.data(), MPI_STATUSES_IGNORE);
+
+  for (int iMsg = 0; iMsg < recvStart[nRecv]; iMsg++) {
+    const unsigned long iPoint = geometry->Local_Point_P2PRecv[iMsg];
+    for (unsigned short iField = 0; iField < nField; iField++)
+      haloData[(iPoint-nPointDomain)*nField+iField] = recvBuf[iMsg*nField+iField];
+  }
+
+#endif
+}
+
+template<class Functor>
+void CParaviewPVTUFileWriter::ForEachPointArray(const Functor& func) const {
+
+  /*--- Same convention as the other paraview writers, the coordinates are skipped
+   and the components of vectors (names ending in _x, _y, _z) are grouped. ---*/
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned short nDim = dataSorter->GetnDim();
+
+  for (unsigned short iField = nDim; iField < fieldNames.size(); iField++) {
+
+    string fieldname = fieldNames[iField];
+    fieldname.erase(remove(fieldname.begin(), fieldname.end(), '"'), fieldname.end());
+
+    if ((fieldNames[iField].find("_y") != string::npos) ||
+        (fieldNames[iField].find("_z") != string::npos)) continue;
+
+    if (fieldNames[iField].find("_x") != string::npos) {
+      fieldname.erase(fieldname.end()-2, fieldname.end());
+      func(fieldname, iField, nDim);
+    } else {
+      func(fieldname, iField, 1);
+    }
+  }
+}
+
+void CParaviewPVTUFileWriter::WritePiece(const string& pieceName){
+
+  /*--- We always have 3 coords, independent of the actual value of nDim ---*/
+
+  const int NCOORDS = 3;
+  const unsigned short nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = geometry->GetnPoint();
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+  /*--- The piece contains the elements owned by this rank (lowest global index
+   is a domain point), all domain points, and the halo points of those elements. ---*/
+
+  vector<long> pieceIndex(nPoint, -1);
+  vector<unsigned long> piecePoint;
+  piecePoint.reserve(nPoint);
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    pieceIndex[iPoint] = piecePoint.size();
+    piecePoint.push_back(iPoint);
+  }
+
+  vector<int> connBuf, offsetBuf;
+  vector<uint8_t> typeBuf;
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+
+    const auto elem = geometry->elem[iElem];
+    const unsigned short nNodes = elem->GetnNodes();
+
+    unsigned long ownerPoint = elem->GetNode(0);
+    for (unsigned short iNode = 1; iNode < nNodes; iNode++) {
+      const unsigned long jPoint = elem->GetNode(iNode);
+      if (geometry->node[jPoint]->GetGlobalIndex() < geometry->node[ownerPoint]->GetGlobalIndex())
+        ownerPoint = jPoint;
+    }
+    if (!geometry->node[ownerPoint]->GetDomain()) continue;
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const unsigned long jPoint = elem->GetNode(iNode);
+      if (pieceIndex[jPoint] < 0) {
+        pieceIndex[jPoint] = piecePoint.size();
+        piecePoint.push_back(jPoint);
+      }
+      connBuf.push_back(pieceIndex[jPoint]);
+    }
+    offsetBuf.push_back(connBuf.size());
+    typeBuf.push_back(elem->GetVTK_Type());
+  }
+
+  const unsigned long nPiecePoint = piecePoint.size();
+
+  /*--- Load the arrays. ---*/
+
+  CAppendedData appended;
+  string xml;
+
+  const bool bigEndian = [](){ unsigned int i = 1; return !(*reinterpret_cast<char*>(&i)); }();
+
+  xml += string("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"") +
+         (bigEndian? "BigEndian" : "LittleEndian") + "\">\n";
+  xml += "<UnstructuredGrid>\n";
+  xml += "<Piece NumberOfPoints=\"" + to_string(nPiecePoint) + "\" NumberOfCells=\"" +
+         to_string(typeBuf.size()) + "\">\n";
+
+  vector<float> floatBuf(nPiecePoint*NCOORDS, 0.0f);
+
+  for (unsigned long iPiece = 0; iPiece < nPiecePoint; iPiece++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      floatBuf[iPiece*NCOORDS + iDim] = float(GetPointData(piecePoint[iPiece], iDim));
+
+  xml += "<Points>\n";
+  appended.AddArray("Float32", "", NCOORDS, floatBuf);
+  xml += appended.Flush();
+  xml += "</Points>\n";
+
+  xml += "<Cells>\n";
+  appended.AddArray("Int32", "connectivity", 1, connBuf);
+  appended.AddArray("Int32", "offsets", 1, offsetBuf);
+  appended.AddArray("UInt8", "types", 1, typeBuf);
+  xml += appended.Flush();
+  xml += "</Cells>\n";
+
+  xml += "<PointData>\n";
+
+  ForEachPointArray([&](const string& name, unsigned short iField, unsigned short nComp) {
+    const unsigned short nCompFile = (nComp == 1)? 1 : NCOORDS;
+    floatBuf.assign(nPiecePoint*nCompFile, 0.0f);
+    for (unsigned long iPiece = 0; iPiece < nPiecePoint; iPiece++)
+      for (unsigned short iComp = 0; iComp < nComp; iComp++)
+        floatBuf[iPiece*nCompFile + iComp] = float(GetPointData(piecePoint[iPiece], iField+iComp));
+    appended.AddArray("Float32", name, nCompFile, floatBuf);
+  });
+  xml += appended.Flush();
+
+  xml += "</PointData>\n";
+  xml += "</Piece>\n";
+  xml += "</UnstructuredGrid>\n";
+  xml += "<AppendedData encoding=\"raw\">\n_";
+
+  /*--- Write the piece. ---*/
+
+  ofstream file(pieceName, ios::out | ios::binary);
+
+  if (!file.is_open()) {
+    SU2_MPI::Error(string("Unable to open file ") + pieceName, CURRENT_FUNCTION);
+  }
+
+  const string footer = "</AppendedData>\n</VTKFile>\n";
+
+  file.write(xml.data(), xml.size());
+  file.write(appended.GetData().data(), appended.GetData().size());
+  file.write(footer.data(), footer.size());
+  file.close();
+
+  fileSize += xml.size() + appended.GetData().size() + footer.size();
+}
+
+void CParaviewPVTUFileWriter::WriteIndex(const string& pieceBaseName) const {
+
+  ofstream file(fileName);
+
+  if (!file.is_open()) {
+    SU2_MPI::Error(string("Unable to open file ") + fileName, CURRENT_FUNCTION);
+  }
+
+  const bool bigEndian = [](){ unsigned int i = 1; return !(*reinterpret_cast<char*>(&i)); }();
+
+  file << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << (bigEndian? "BigEndian" : "LittleEndian") << "\">\n";
+  file << "<PUnstructuredGrid GhostLevel=\"0\">\n";
+  file << "<PPoints>\n<PDataArray type=\"Float32\" NumberOfComponents=\"3\"/>\n</PPoints>\n";
+  file << "<PPointData>\n";
+
+  ForEachPointArray([&](const string& name, unsigned short, unsigned short nComp) {
+    file << "<PDataArray type=\"Float32\" Name=\"" << name << "\" NumberOfComponents=\""
+         << ((nComp == 1)? 1 : 3) << "\"/>\n";
+  });
+
+  file << "</PPointData>\n";
+
+  for (int iRank = 0; iRank < size; iRank++)
+    file << "<Piece Source=\"" << pieceBaseName << "_" << iRank << pieceExt << "\"/>\n";
+
+  file << "</PUnstructuredGrid>\n</VTKFile>\n";
+}
+
+void CParaviewPVTUFileWriter::Write_Data(){
+
+  startTime = WallTime();
+  fileSize = 0.0;
+
+  /*--- Name of the pieces, the index references them relative to its own location. ---*/
+
+  const string baseName = fileName.substr(0, fileName.size()-fileExt.size());
+  const string pieceBaseName = baseName.substr(baseName.find_last_of("/\\")+1);
+
+  CommunicateHaloData();
+
+  WritePiece(baseName + "_" + to_string(rank) + pieceExt);
+
+  if (rank == MASTER_NODE) WriteIndex(pieceBaseName);
+
+  haloData.clear();
+
+  /*--- Communicate the total file size and the slowest writing time for the bandwidth. ---*/
+
+  stopTime = WallTime();
+  usedTime = stopTime - startTime;
+
+  su2double myValues[] = {fileSize, usedTime}, values[2];
+  SU2_MPI::Allreduce(&myValues[0], &values[0], 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&myValues[1], &values[1], 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  fileSize = values[0];
+  usedTime = values[1];
+
+  bandwidth = fileSize/(1.0e6)/max(usedTime, su2double(1e-12));
+
+}
@@ -0,0 +1,345 @@
+/*!
+ * \file CInSituExtraction.cpp
+ * \brief Implementation of the classes that extract flow probes and slices during the solution.
+ * \version 7.0.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CInSituExtraction.hpp"
+#include "../../../../Common/include/adt_structure.hpp"
+#include "../../../../Common/include/toolboxes/CReductionAccumulator.hpp"
+#include <algorithm>
+#include <fstream>
+
+namespace {
+  /*--- Upper bounds used to size local arrays. ---*/
+  const unsigned short MAX_FIELDS = 6, MAX_ELEM_NODES = 8, MAX_CUT_POINTS = 12;
+}
+
+std::vector<std::string> CInSituExtraction::GetFieldNames(unsigned short nDim) {
+  std::vector<std::string> names = {"PRESSURE", "DENSITY", "TEMPERATURE", "VELOCITY-X", "VELOCITY-Y"};
+  if (nDim == 3) names.push_back("VELOCITY-Z");
+  return names;
+}
+
+void CInSituExtraction::LoadFields(const CVariable* nodes, unsigned long iPoint, su2double* fields) const {
+  fields[0] = nodes->GetPressure(iPoint);
+  fields[1] = nodes->GetDensity(iPoint);
+  fields[2] = nodes->GetTemperature(iPoint);
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    fields[3+iDim] = nodes->GetVelocity(iPoint, iDim);
+}
+
+bool CInSituExtraction::IsOwnedElement(CGeometry* geometry, unsigned long iElem) {
+
+  const auto elem = geometry->elem[iElem];
+  unsigned long minPoint = elem->GetNode(0);
+
+  for (unsigned short iNode = 1; iNode < elem->GetnNodes(); iNode++) {
+    const auto iPoint = elem->GetNode(iNode);
+    if (geometry->node[iPoint]->GetGlobalIndex() < geometry->node[minPoint]->GetGlobalIndex())
+      minPoint = iPoint;
+  }
+  return geometry->node[minPoint]->GetDomain();
+}
+
+CProbeInterpolator::CProbeInterpolator(const CConfig* config, CGeometry* geometry) :
+  CInSituExtraction(geometry->GetnDim()),
+  nProbe(config->GetnProbes()) {
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  /*--- Local ADT of the elements owned by this rank. ---*/
+
+  std::vector<su2double> coor(nDim*geometry->GetnPoint());
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coor[iPoint*nDim+iDim] = geometry->node[iPoint]->GetCoord(iDim);
+
+  std::vector<unsigned long> elemConn, elemID;
+  std::vector<unsigned short> elemType, elemMarker;
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    if (!IsOwnedElement(geometry, iElem)) continue;
+    const auto elem = geometry->elem[iElem];
+    elemType.push_back(elem->GetVTK_Type());
+    elemMarker.push_back(0);
+    elemID.push_back(iElem);
+    for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++)
+      elemConn.push_back(elem->GetNode(iNode));
+  }
+
+  /*--- Search the probes, the lowest rank that contains a probe owns it. ---*/
+
+  std::vector<int> owner(nProbe, size), globalOwner(nProbe, size);
+  std::vector<unsigned long> donorElem(nProbe);
+  std::vector<su2double> weights(nProbe*MAX_ELEM_NODES);
+
+  if (!elemType.empty()) {
+    CADTElemClass localADT(nDim, coor, elemConn, elemType, elemMarker, elemID, false);
+
+    for (unsigned short iProbe = 0; iProbe < nProbe; iProbe++) {
+      unsigned short markerID;
+      int rankID;
+      su2double parCoor[3] = {0.0};
+      if (localADT.DetermineContainingElement(config->GetProbe_Coord(iProbe), markerID, donorElem[iProbe],
+                                              rankID, parCoor, &weights[iProbe*MAX_ELEM_NODES]))
+        owner[iProbe] = rank;
+    }
+  }
+
+  SU2_MPI::Allreduce(owner.data(), globalOwner.data(), nProbe, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  /*--- Store the donor points and weights of the probes owned by this rank. ---*/
+
+  found.resize(nProbe);
+  donorStart.push_back(0);
+
+  for (unsigned short iProbe = 0; iProbe < nProbe; iProbe++) {
+    found[iProbe] = (globalOwner[iProbe] < size);
+
+    if (globalOwner[iProbe] == rank) {
+      const auto elem = geometry->elem[donorElem[iProbe]];
+      localProbe.push_back(iProbe);
+      for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++) {
+        donorPoint.push_back(elem->GetNode(iNode));
+        donorWeight.push_back(weights[iProbe*MAX_ELEM_NODES+iNode]);
+      }
+      donorStart.push_back(donorPoint.size());
+    }
+
+    if (!found[iProbe] && rank == MASTER_NODE) {
+      const su2double* probeCoor = config->GetProbe_Coord(iProbe);
+      cout << "WARNING: Probe " << iProbe << " (" << probeCoor[0] << ", " << probeCoor[1];
+      if (nDim == 3) cout << ", " << probeCoor[2];
+      cout << ") is outside the domain, its values are set to zero." << endl;
+    }
+  }
+
+  values.resize(nProbe*nField, 0.0);
+}
+
+void CProbeInterpolator::Interpolate(const CVariable* nodes) {
+
+  su2double fields[MAX_FIELDS];
+
+  values.assign(nProbe*nField, 0.0);
+
+  for (unsigned long iLocal = 0; iLocal < localProbe.size(); iLocal++) {
+    su2double* probeValues = &values[localProbe[iLocal]*nField];
+
+    for (auto iDonor = donorStart[iLocal]; iDonor < donorStart[iLocal+1]; iDonor++) {
+      LoadFields(nodes, donorPoint[iDonor], fields);
+      for (unsigned short iField = 0; iField < nField; iField++)
+        probeValues[iField] += donorWeight[iDonor]*fields[iField];
+    }
+  }
+
+  /*--- Each probe has one owner, the others contribute zeros. ---*/
+
+  CReductionAccumulator reduction;
+  reduction.Add(values.data(), values.size());
+  reduction.Reduce();
+}
+
+void CSliceExtractor::Cut(CGeometry* geometry, const CVariable* nodes, const su2double* origin, const su2double* normal) {
+
+  const unsigned short stride = 3+nField;
+  unsigned short iDim, iNode, jNode, iField;
+
+  pointData.clear();
+  cellPoint.clear();
+  cellStart.assign(1, 0);
+
+  /*--- Unit normal (the z component is ignored in 2D). ---*/
+
+  su2double unitNormal[3] = {0.0}, norm = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) norm += normal[iDim]*normal[iDim];
+  norm = sqrt(norm);
+  if (norm == 0.0) SU2_MPI::Error("The normal of a slice plane cannot be zero.", CURRENT_FUNCTION);
+  for (iDim = 0; iDim < nDim; iDim++) unitNormal[iDim] = normal[iDim]/norm;
+
+  su2double dist[MAX_ELEM_NODES], fieldsI[MAX_FIELDS], fieldsJ[MAX_FIELDS], angle[MAX_CUT_POINTS];
+  unsigned long order[MAX_CUT_POINTS];
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+
+    if (!IsOwnedElement(geometry, iElem)) continue;
+
+    const auto elem = geometry->elem[iElem];
+    const unsigned short nNode = elem->GetnNodes();
+
+    /*--- Signed distances of the nodes to the plane, points on the plane count as positive. ---*/
+
+    bool hasNegative = false, hasPositive = false;
+    for (iNode = 0; iNode < nNode; iNode++) {
+      const su2double* coord = geometry->node[elem->GetNode(iNode)]->GetCoord();
+      dist[iNode] = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) dist[iNode] += (coord[iDim]-origin[iDim])*unitNormal[iDim];
+      if (dist[iNode] < 0.0) hasNegative = true;
+      else hasPositive = true;
+    }
+    if (!hasNegative || !hasPositive) continue;
+
+    /*--- Intersect the edges that cross the plane, interpolating linearly along them. ---*/
+
+    const unsigned long firstPoint = pointData.size()/stride;
+    unsigned short nCut = 0;
+
+    for (iNode = 0; iNode < nNode; iNode++) {
+      for (unsigned short iNeigh = 0; iNeigh < elem->GetnNeighbor_Nodes(iNode); iNeigh++) {
+        jNode = elem->GetNeighbor_Nodes(iNode, iNeigh);
+        if ((jNode < iNode) || ((dist[iNode] < 0.0) == (dist[jNode] < 0.0))) continue;
+        if (nCut == MAX_CUT_POINTS) break;
+
+        const unsigned long iPoint = elem->GetNode(iNode), jPoint = elem->GetNode(jNode);
+        const su2double t = dist[iNode]/(dist[iNode]-dist[jNode]);
+        const su2double *coordI = geometry->node[iPoint]->GetCoord(), *coordJ = geometry->node[jPoint]->GetCoord();
+
+        for (iDim = 0; iDim < 3; iDim++)
+          pointData.push_back((iDim < nDim)? coordI[iDim] + t*(coordJ[iDim]-coordI[iDim]) : su2double(0.0));
+
+        LoadFields(nodes, iPoint, fieldsI);
+        LoadFields(nodes, jPoint, fieldsJ);
+        for (iField = 0; iField < nField; iField++)
+          pointData.push_back(fieldsI[iField] + t*(fieldsJ[iField]-fieldsI[iField]));
+
+        nCut++;
+      }
+    }
+
+    /*--- In 3D the cut of a convex element is a convex polygon, order its points by the
+     *    angle around their centroid in the plane. In 2D the cut is a segment. ---*/
+
+    for (iNode = 0; iNode < nCut; iNode++) order[iNode] = firstPoint+iNode;
+
+    if (nDim == 3 && nCut > 3) {
+      su2double center[3] = {0.0}, axis1[3], axis2[3];
+      for (iNode = 0; iNode < nCut; iNode++)
+        for (iDim = 0; iDim < 3; iDim++) center[iDim] += pointData[(firstPoint+iNode)*stride+iDim]/nCut;
+
+      for (iDim = 0; iDim < 3; iDim++) axis1[iDim] = pointData[firstPoint*stride+iDim]-center[iDim];
+      axis2[0] = unitNormal[1]*axis1[2] - unitNormal[2]*axis1[1];
+      axis2[1] = unitNormal[2]*axis1[0] - unitNormal[0]*axis1[2];
+      axis2[2] = unitNormal[0]*axis1[1] - unitNormal[1]*axis1[0];
+
+      for (iNode = 0; iNode < nCut; iNode++) {
+        su2double x = 0.0, y = 0.0;
+        for (iDim = 0; iDim < 3; iDim++) {
+          const su2double delta = pointData[(firstPoint+iNode)*stride+iDim]-center[iDim];
+          x += delta*axis1[iDim];
+          y += delta*axis2[iDim];
+        }
+        angle[iNode] = atan2(y, x);
+      }
+      std::sort(order, order+nCut, [&](unsigned long a, unsigned long b) {
+        return angle[a-firstPoint] < angle[b-firstPoint];
+      });
+    }
+
+    cellPoint.insert(cellPoint.end(), order, order+nCut);
+    cellStart.push_back(cellPoint.size());
+  }
+}
+
+void CSliceExtractor::WriteSlice(const CConfig* config, CGeometry* geometry, const CVariable* nodes,
+                                 unsigned short iSlice, const std::string& fileName) {
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const unsigned short stride = 3+nField;
+
+  Cut(geometry, nodes, config->GetSlice_Origin(iSlice), config->GetSlice_Normal(iSlice));
+
+  /*--- Send the local cut to the master node. ---*/
+
+  unsigned long nLocal[3] = {pointData.size()/stride, cellStart.size()-1, cellPoint.size()};
+
+  if (rank != MASTER_NODE) {
+    SU2_MPI::Send(nLocal, 3, MPI_UNSIGNED_LONG, MASTER_NODE, 0, SU2_MPI::GetComm());
+    SU2_MPI::Send(pointData.data(), pointData.size(), MPI_DOUBLE, MASTER_NODE, 1, SU2_MPI::GetComm());
+    SU2_MPI::Send(cellStart.data(), cellStart.size(), MPI_UNSIGNED_LONG, MASTER_NODE, 2, SU2_MPI::GetComm());
+    SU2_MPI::Send(cellPoint.data(), cellPoint.size(), MPI_UNSIGNED_LONG, MASTER_NODE, 3, SU2_MPI::GetComm());
+    return;
+  }
+
+  /*--- The master node appends the cuts of the other ranks, offsetting their point indices. ---*/
+
+  std::vector<su2double> recvData;
+  std::vector<unsigned long> recvStart, recvPoint;
+
+  for (int iRank = 1; iRank < size; iRank++) {
+    unsigned long nRecv[3];
+    SU2_MPI::Recv(nRecv, 3, MPI_UNSIGNED_LONG, iRank, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+
+    recvData.resize(nRecv[0]*stride);
+    recvStart.resize(nRecv[1]+1);
+    recvPoint.resize(nRecv[2]);
+    SU2_MPI::Recv(recvData.data(), recvData.size(), MPI_DOUBLE, iRank, 1, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+    SU2_MPI::Recv(recvStart.data(), recvStart.size(), MPI_UNSIGNED_LONG, iRank, 2, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+    SU2_MPI::Recv(recvPoint.data(), recvPoint.size(), MPI_UNSIGNED_LONG, iRank, 3, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+
+    const unsigned long pointOffset = pointData.size()/stride, connOffset = cellPoint.size();
+
+    pointData.insert(pointData.end(), recvData.begin(), recvData.end());
+    for (unsigned long iCell = 1; iCell <= nRecv[1]; iCell++)
+      cellStart.push_back(recvStart[iCell]+connOffset);
+    for (auto iPoint : recvPoint)
+      cellPoint.push_back(iPoint+pointOffset);
+  }
+
+  /*--- Write the legacy VTK polydata file. ---*/
+
+  const unsigned long nPoint = pointData.size()/stride, nCell = cellStart.size()-1;
+
+  std::ofstream file(fileName);
+  if (!file.is_open())
+    SU2_MPI::Error(std::string("Unable to open slice file ") + fileName, CURRENT_FUNCTION);
+
+  file.precision(10);
+  file << "# vtk DataFile Version 3.0\n";
+  file << "SU2 slice " << iSlice << "\n";
+  file << "ASCII\nDATASET POLYDATA\n";
+
+  file << "POINTS " << nPoint << " double\n";
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    const su2double* data = &pointData[iPoint*stride];
+    file << SU2_TYPE::GetValue(data[0]) << " " << SU2_TYPE::GetValue(data[1]) << " "
+         << SU2_TYPE::GetValue(data[2]) << "\n";
+  }
+
+  file << ((nDim == 3)? "POLYGONS " : "LINES ") << nCell << " " << nCell+cellPoint.size() << "\n";
+  for (unsigned long iCell = 0; iCell < nCell; iCell++) {
+    file << cellStart[iCell+1]-cellStart[iCell];
+    for (auto iConn = cellStart[iCell]; iConn < cellStart[iCell+1]; iConn++)
+      file << " " << cellPoint[iConn];
+    file << "\n";
+  }
+
+  const auto fieldNames = GetFieldNames(nDim);
+
+  file << "POINT_DATA " << nPoint << "\n";
+  for (unsigned short iField = 0; iField < nField; iField++) {
+    file << "SCALARS " << fieldNames[iField] << " double 1\nLOOKUP_TABLE default\n";
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      file << SU2_TYPE::GetValue(pointData[iPoint*stride+3+iField]) << "\n";
+  }
+}
@@ -33,7 +33,7 @@ void CDriver::PythonInterface_Preprocessing(CConfig **config, CGeometry ****geom
   int rank = MASTER_NODE;
 
 #ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_rank(SU2_MPI::GetComm(), &rank);
 #endif
 
   /* --- Initialize boundary conditions customization, this is achieve through the Python wrapper --- */
@@ -875,7 +875,7 @@ void CFluidDriver::StaticMeshUpdate() {
   int rank = MASTER_NODE;
 
 #ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_rank(SU2_MPI::GetComm(), &rank);
 #endif
 
   for(iZone = 0; iZone < nZone; iZone++) {
@@ -956,7 +956,7 @@ void CFluidDriver::BoundaryConditionsUpdate(){
   unsigned short iZone;
 
 #ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_rank(SU2_MPI::GetComm(), &rank);
 #endif
 
   if(rank == MASTER_NODE) cout << "Updating boundary conditions." << endl;
@@ -1228,3 +1228,179 @@ vector<passivedouble> CDriver::GetVertex_UndeformedCoord(unsigned short iMarker,
   return MeshCoord_passive;
 
 }
+
+/*--- Check the dimensions of the arrays passed to the bulk marker functions, a mismatch would
+ *    otherwise read or write out of bounds of the caller's (e.g. NumPy) buffer. ---*/
+
+static void CheckMarkerArray(unsigned long nVertexMarker, int nVertex, int nVar, int nVarExpected) {
+
+  if ((nVertex < 0) || (static_cast<unsigned long>(nVertex) != nVertexMarker) || (nVar != nVarExpected)) {
+    SU2_MPI::Error(string("The array has shape (") + to_string(nVertex) + ", " + to_string(nVar) +
+                   string(") but the marker requires (") + to_string(nVertexMarker) + ", " +
+                   to_string(nVarExpected) + ").", CURRENT_FUNCTION);
+  }
+}
+
+static void CheckCustomMarker(const CConfig *config, unsigned short iMarker, unsigned short kindBC) {
+
+  /*--- The custom values are only allocated for the python custom markers of the matching kind. ---*/
+  if (!config->GetMarker_All_PyCustom(iMarker) || (config->GetMarker_All_KindBC(iMarker) != kindBC)) {
+    SU2_MPI::Error(string("Marker ") + config->GetMarker_All_TagBound(iMarker) + string(" must be ") +
+                   string(kindBC == HEAT_FLUX? "a heat flux" : "an isothermal") +
+                   string(" marker listed in MARKER_PYTHON_CUSTOM."), CURRENT_FUNCTION);
+  }
+}
+
+void CDriver::GetMarkerCoordinates(unsigned short iMarker, passivedouble *values, int nVertex, int nVar) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  CheckMarkerArray(geometry->GetnVertex(iMarker), nVertex, nVar, nDim);
+
+  for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    const su2double *Coord = geometry->node[iPoint]->GetCoord();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = SU2_TYPE::GetValue(Coord[iDim]);
+  }
+
+}
+
+void CDriver::SetMarkerCoordinates(unsigned short iMarker, passivedouble *values, int nVertex, int nVar) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  CheckMarkerArray(geometry->GetnVertex(iMarker), nVertex, nVar, nDim);
+
+  su2double VarCoord[3] = {0.0, 0.0, 0.0};
+
+  for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    const su2double *Coord = geometry->node[iPoint]->GetCoord();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      VarCoord[iDim] = values[iVertex*nDim + iDim] - Coord[iDim];
+    geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+  }
+
+}
+
+void CDriver::GetMarkerForces(unsigned short iMarker, passivedouble *values, int nVertex, int nVar) {
+
+  CheckMarkerArray(GetNumberVertices(iMarker), nVertex, nVar, nDim);
+
+  for (unsigned long iVertex = 0; iVertex < GetNumberVertices(iMarker); iVertex++) {
+    const bool halo = ComputeVertexForces(iMarker, iVertex);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = halo? 0.0 : SU2_TYPE::GetValue(PyWrapNodalForce[iDim]);
+  }
+
+}
+
+void CDriver::GetMarkerTemperatures(unsigned short iMarker, passivedouble *values, int nVertex) {
+
+  CheckMarkerArray(GetNumberVertices(iMarker), nVertex, 1, 1);
+
+  for (unsigned long iVertex = 0; iVertex < GetNumberVertices(iMarker); iVertex++)
+    values[iVertex] = GetVertexTemperature(iMarker, iVertex);
+
+}
+
+void CDriver::SetMarkerTemperatures(unsigned short iMarker, passivedouble *values, int nVertex) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  CheckMarkerArray(geometry->GetnVertex(iMarker), nVertex, 1, 1);
+  CheckCustomMarker(config_container[ZONE_0], iMarker, ISOTHERMAL);
+
+  for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++)
+    geometry->SetCustomBoundaryTemperature(iMarker, iVertex, values[iVertex]);
+
+}
+
+void CDriver::GetMarkerNormalHeatFluxes(unsigned short iMarker, passivedouble *values, int nVertex) {
+
+  CheckMarkerArray(GetNumberVertices(iMarker), nVertex, 1, 1);
+
+  for (unsigned long iVertex = 0; iVertex < GetNumberVertices(iMarker); iVertex++)
+    values[iVertex] = GetVertexNormalHeatFlux(iMarker, iVertex);
+
+}
+
+void CDriver::SetMarkerNormalHeatFluxes(unsigned short iMarker, passivedouble *values, int nVertex) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  CheckMarkerArray(geometry->GetnVertex(iMarker), nVertex, 1, 1);
+  CheckCustomMarker(config_container[ZONE_0], iMarker, HEAT_FLUX);
+
+  for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++)
+    geometry->SetCustomBoundaryHeatFlux(iMarker, iVertex, values[iVertex]);
+
+}
+
+void CDriver::SetMarkerMeshDisplacements(unsigned short iMarker, passivedouble *values, int nVertex, int nVar) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes();
+
+  CheckMarkerArray(geometry->GetnVertex(iMarker), nVertex, nVar, nDim);
+
+  su2double Disp[3] = {0.0, 0.0, 0.0};
+
+  for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Disp[iDim] = values[iVertex*nDim + iDim];
+    nodes->SetBound_Disp(iPoint, Disp);
+  }
+
+}
+
+void CDriver::SetMarkerFEALoads(unsigned short iMarker, passivedouble *values, int nVertex, int nVar) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL]->GetNodes();
+
+  CheckMarkerArray(geometry->GetnVertex(iMarker), nVertex, nVar, nDim);
+
+  su2double Load[3] = {0.0, 0.0, 0.0};
+
+  for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Load[iDim] = values[iVertex*nDim + iDim];
+    nodes->Set_FlowTraction(iPoint, Load);
+  }
+
+}
+
+void CDriver::GetMarkerFEADisplacements(unsigned short iMarker, passivedouble *values, int nVertex, int nVar) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CVariable *nodes = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL]->GetNodes();
+
+  CheckMarkerArray(geometry->GetnVertex(iMarker), nVertex, nVar, nDim);
+
+  for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    const unsigned long iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iDim));
+  }
+
+}
+
+void CDriver::GetMarkerFlowLoads(unsigned short iMarker, passivedouble *values, int nVertex, int nVar) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+
+  CheckMarkerArray(geometry->GetnVertex(iMarker), nVertex, nVar, nDim);
+
+  const bool fluidLoad = (config_container[ZONE_0]->GetMarker_All_Fluid_Load(iMarker) == YES);
+
+  for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = fluidLoad? SU2_TYPE::GetValue(solver->GetVertexTractions(iMarker, iVertex, iDim)) : 0.0;
+  }
+
+}
@@ -28,6 +28,7 @@
 
 #include "../../include/solvers/CEulerSolver.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CReductionAccumulator.hpp"
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
@@ -842,7 +843,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
 
   if (config->GetComm_Level() == COMM_FULL) {
 #ifdef HAVE_MPI
-    SU2_MPI::Reduce(&counter_local, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&counter_local, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 #else
     counter_global = counter_local;
 #endif
@@ -1634,7 +1635,7 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
 
       /*--- Communicate the counts to iDomain with non-blocking sends ---*/
 
-      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, MPI_COMM_WORLD);
+      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, SU2_MPI::GetComm());
 
 #endif
 
@@ -1663,7 +1664,7 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
           /*--- Recv the data by probing for the current sender, jDomain,
            first and then receiving the values from it. ---*/
 
-          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, MPI_COMM_WORLD, &status);
+          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, SU2_MPI::GetComm(), &status);
 
 #endif
 
@@ -1677,7 +1678,7 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
 
 #ifdef HAVE_MPI
 
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #endif
 
@@ -1743,11 +1744,11 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
 
       SU2_MPI::Bsend(&Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar_)],
                      nPointTotal_s[iDomain]*(nPrimVar_), MPI_DOUBLE, iDomain,
-                     iDomain,  MPI_COMM_WORLD);
+                     iDomain,  SU2_MPI::GetComm());
 
       SU2_MPI::Bsend(&Buffer_Send_Data[PointTotal_Counter*(3)],
                      nPointTotal_s[iDomain]*(3), MPI_LONG, iDomain,
-                     iDomain+nDomain,  MPI_COMM_WORLD);
+                     iDomain+nDomain,  SU2_MPI::GetComm());
 
 #endif
 
@@ -1802,7 +1803,7 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
 
 #ifdef HAVE_MPI
 
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #endif
 
@@ -1825,10 +1826,10 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
       /*--- Receive the buffers with the coords, global index, and colors ---*/
 
       SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar_) , MPI_DOUBLE,
-                    iDomain, rank, MPI_COMM_WORLD, &status);
+                    iDomain, rank, SU2_MPI::GetComm(), &status);
 
       SU2_MPI::Recv(Buffer_Receive_Data, nPointTotal_r[iDomain]*(3) , MPI_LONG,
-                    iDomain, rank+nDomain, MPI_COMM_WORLD, &status);
+                    iDomain, rank+nDomain, SU2_MPI::GetComm(), &status);
 
       /*--- Loop over all of the points that we have recv'd and store the
        coords, global index vertex and markers ---*/
@@ -1865,7 +1866,7 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
 
 #ifdef HAVE_MPI
 
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #endif
 
@@ -1971,7 +1972,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
 
       /*--- Communicate the counts to iDomain with non-blocking sends ---*/
 
-      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, MPI_COMM_WORLD);
+      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, SU2_MPI::GetComm());
 
 #endif
 
@@ -2000,7 +2001,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
           /*--- Recv the data by probing for the current sender, jDomain,
            first and then receiving the values from it. ---*/
 
-          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, MPI_COMM_WORLD, &status);
+          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, SU2_MPI::GetComm(), &status);
 
 #endif
 
@@ -2014,7 +2015,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
 
 #ifdef HAVE_MPI
 
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #endif
 
@@ -2069,7 +2070,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
 
       SU2_MPI::Bsend(&Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar+3)],
                      nPointTotal_s[iDomain]*(nPrimVar+3), MPI_DOUBLE, iDomain,
-                     iDomain,  MPI_COMM_WORLD);
+                     iDomain,  SU2_MPI::GetComm());
 
 #endif
 
@@ -2123,7 +2124,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
 
 #ifdef HAVE_MPI
 
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #endif
 
@@ -2145,7 +2146,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
       /*--- Receive the buffers with the coords, global index, and colors ---*/
 
       SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar+3) , MPI_DOUBLE,
-                    iDomain, rank, MPI_COMM_WORLD, &status_);
+                    iDomain, rank, SU2_MPI::GetComm(), &status_);
 
       /*--- Loop over all of the points that we have recv'd and store the
        coords, global index vertex and markers ---*/
@@ -2185,7 +2186,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
 
 #ifdef HAVE_MPI
 
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #endif
 
@@ -2518,6 +2519,14 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
 
   }
 
+  /*--- Replace the fluid model by its tabulated version, the tables are
+        built once and shared by all the multigrid levels. ---*/
+
+  if (config->GetFluidTable()) {
+    FluidModel = new CLookUpTableFluid(FluidModel, config, Density_FreeStreamND, Temperature_FreeStreamND);
+    FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+  }
+
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (viscous) {
@@ -3058,7 +3067,7 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   if (config->GetComm_Level() == COMM_FULL) {
 #ifdef HAVE_MPI
     unsigned long MyErrorCounter = ErrorCounter; ErrorCounter = 0;
-    SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 #endif
     if (iMesh == MESH_0) config->SetNonphysical_Points(ErrorCounter);
   }
@@ -3213,13 +3222,13 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Min_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
     Min_Delta_Time = rbuf_time;
 
     sbuf_time = Max_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
     Max_Delta_Time = rbuf_time;
 #endif
   }
@@ -3230,8 +3239,8 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Global_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
     Global_Delta_Time = rbuf_time;
 #endif
     /*--- If the unsteady CFL is set to zero, it uses the defined
@@ -3267,8 +3276,8 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Global_Delta_UnstTimeND;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
     Global_Delta_UnstTimeND = rbuf_time;
 #endif
     config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
@@ -3395,9 +3404,12 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
     if (muscl) {
 
+      /*--- Vectors from the nodes to the edge midpoint, precomputed by the geometry. ---*/
+
+      const su2double* halfVector = geometry->GetEdgeHalfVector(iEdge);
       for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
+        Vector_i[iDim] = halfVector[iDim];
+        Vector_j[iDim] = -halfVector[iDim];
       }
 
       Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
@@ -3593,7 +3605,7 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
   if (config->GetComm_Level() == COMM_FULL) {
 #ifdef HAVE_MPI
-    SU2_MPI::Reduce(&counter_local, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&counter_local, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 #else
     counter_global = counter_local;
 #endif
@@ -4177,10 +4189,6 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   su2double MomentX_Force[3] = {0.0,0.0,0.0}, MomentY_Force[3] = {0.0,0.0,0.0}, MomentZ_Force[3] = {0.0,0.0,0.0};
   su2double AxiFactor;
 
-#ifdef HAVE_MPI
-  su2double MyAllBound_CD_Inv, MyAllBound_CL_Inv, MyAllBound_CSF_Inv, MyAllBound_CMx_Inv, MyAllBound_CMy_Inv, MyAllBound_CMz_Inv, MyAllBound_CoPx_Inv, MyAllBound_CoPy_Inv, MyAllBound_CoPz_Inv, MyAllBound_CFx_Inv, MyAllBound_CFy_Inv, MyAllBound_CFz_Inv, MyAllBound_CT_Inv, MyAllBound_CQ_Inv, MyAllBound_CNearFieldOF_Inv, *MySurface_CL_Inv = NULL, *MySurface_CD_Inv = NULL, *MySurface_CSF_Inv = NULL, *MySurface_CEff_Inv = NULL, *MySurface_CFx_Inv = NULL, *MySurface_CFy_Inv = NULL, *MySurface_CFz_Inv = NULL, *MySurface_CMx_Inv = NULL, *MySurface_CMy_Inv = NULL, *MySurface_CMz_Inv = NULL;
-#endif
-
   su2double Alpha           = config->GetAoA()*PI_NUMBER/180.0;
   su2double Beta            = config->GetAoS()*PI_NUMBER/180.0;
   su2double RefArea    = config->GetRefArea();
@@ -4429,106 +4437,30 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
     }
   }
 
-#ifdef HAVE_MPI
-
-  /*--- Add AllBound information using all the nodes ---*/
-
-  MyAllBound_CD_Inv        = AllBound_CD_Inv;        AllBound_CD_Inv = 0.0;
-  MyAllBound_CL_Inv        = AllBound_CL_Inv;        AllBound_CL_Inv = 0.0;
-  MyAllBound_CSF_Inv   = AllBound_CSF_Inv;   AllBound_CSF_Inv = 0.0;
-  AllBound_CEff_Inv = 0.0;
-  MyAllBound_CMx_Inv          = AllBound_CMx_Inv;          AllBound_CMx_Inv = 0.0;
-  MyAllBound_CMy_Inv          = AllBound_CMy_Inv;          AllBound_CMy_Inv = 0.0;
-  MyAllBound_CMz_Inv          = AllBound_CMz_Inv;          AllBound_CMz_Inv = 0.0;
-  MyAllBound_CoPx_Inv          = AllBound_CoPx_Inv;          AllBound_CoPx_Inv = 0.0;
-  MyAllBound_CoPy_Inv          = AllBound_CoPy_Inv;          AllBound_CoPy_Inv = 0.0;
-  MyAllBound_CoPz_Inv          = AllBound_CoPz_Inv;          AllBound_CoPz_Inv = 0.0;
-  MyAllBound_CFx_Inv          = AllBound_CFx_Inv;          AllBound_CFx_Inv = 0.0;
-  MyAllBound_CFy_Inv          = AllBound_CFy_Inv;          AllBound_CFy_Inv = 0.0;
-  MyAllBound_CFz_Inv          = AllBound_CFz_Inv;          AllBound_CFz_Inv = 0.0;
-  MyAllBound_CT_Inv           = AllBound_CT_Inv;           AllBound_CT_Inv = 0.0;
-  MyAllBound_CQ_Inv           = AllBound_CQ_Inv;           AllBound_CQ_Inv = 0.0;
-  AllBound_CMerit_Inv = 0.0;
-  MyAllBound_CNearFieldOF_Inv = AllBound_CNearFieldOF_Inv; AllBound_CNearFieldOF_Inv = 0.0;
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes,
+   *    everything is reduced at once and the ratios are computed from the totals. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    SU2_MPI::Allreduce(&MyAllBound_CD_Inv, &AllBound_CD_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CL_Inv, &AllBound_CL_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CSF_Inv, &AllBound_CSF_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    const auto nMarker_Monitoring = config->GetnMarker_Monitoring();
+    CReductionAccumulator reduction;
+
+    for (auto coeff : {&AllBound_CD_Inv, &AllBound_CL_Inv, &AllBound_CSF_Inv, &AllBound_CMx_Inv,
+                       &AllBound_CMy_Inv, &AllBound_CMz_Inv, &AllBound_CoPx_Inv, &AllBound_CoPy_Inv,
+                       &AllBound_CoPz_Inv, &AllBound_CFx_Inv, &AllBound_CFy_Inv, &AllBound_CFz_Inv,
+                       &AllBound_CT_Inv, &AllBound_CQ_Inv, &AllBound_CNearFieldOF_Inv})
+      reduction.Add(*coeff);
+    for (auto coeff : {Surface_CL_Inv, Surface_CD_Inv, Surface_CSF_Inv, Surface_CFx_Inv,
+                       Surface_CFy_Inv, Surface_CFz_Inv, Surface_CMx_Inv, Surface_CMy_Inv,
+                       Surface_CMz_Inv})
+      reduction.Add(coeff, nMarker_Monitoring);
+    reduction.Reduce();
+
     AllBound_CEff_Inv = AllBound_CL_Inv / (AllBound_CD_Inv + EPS);
-    SU2_MPI::Allreduce(&MyAllBound_CMx_Inv, &AllBound_CMx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CMy_Inv, &AllBound_CMy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CMz_Inv, &AllBound_CMz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CoPx_Inv, &AllBound_CoPx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CoPy_Inv, &AllBound_CoPy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CoPz_Inv, &AllBound_CoPz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CFx_Inv, &AllBound_CFx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CFy_Inv, &AllBound_CFy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CFz_Inv, &AllBound_CFz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CT_Inv, &AllBound_CT_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CQ_Inv, &AllBound_CQ_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
     AllBound_CMerit_Inv = AllBound_CT_Inv / (AllBound_CQ_Inv + EPS);
-    SU2_MPI::Allreduce(&MyAllBound_CNearFieldOF_Inv, &AllBound_CNearFieldOF_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  MySurface_CL_Inv      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Inv      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Inv = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Inv       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Inv        = new su2double[config->GetnMarker_Monitoring()];
-
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    MySurface_CL_Inv[iMarker_Monitoring]      = Surface_CL_Inv[iMarker_Monitoring];
-    MySurface_CD_Inv[iMarker_Monitoring]      = Surface_CD_Inv[iMarker_Monitoring];
-    MySurface_CSF_Inv[iMarker_Monitoring] = Surface_CSF_Inv[iMarker_Monitoring];
-    MySurface_CEff_Inv[iMarker_Monitoring]       = Surface_CEff_Inv[iMarker_Monitoring];
-    MySurface_CFx_Inv[iMarker_Monitoring]        = Surface_CFx_Inv[iMarker_Monitoring];
-    MySurface_CFy_Inv[iMarker_Monitoring]        = Surface_CFy_Inv[iMarker_Monitoring];
-    MySurface_CFz_Inv[iMarker_Monitoring]        = Surface_CFz_Inv[iMarker_Monitoring];
-    MySurface_CMx_Inv[iMarker_Monitoring]        = Surface_CMx_Inv[iMarker_Monitoring];
-    MySurface_CMy_Inv[iMarker_Monitoring]        = Surface_CMy_Inv[iMarker_Monitoring];
-    MySurface_CMz_Inv[iMarker_Monitoring]        = Surface_CMz_Inv[iMarker_Monitoring];
-
-    Surface_CL_Inv[iMarker_Monitoring]         = 0.0;
-    Surface_CD_Inv[iMarker_Monitoring]         = 0.0;
-    Surface_CSF_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CEff_Inv[iMarker_Monitoring]       = 0.0;
-    Surface_CFx_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Inv[iMarker_Monitoring]        = 0.0;
-  }
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    SU2_MPI::Allreduce(MySurface_CL_Inv, Surface_CL_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CD_Inv, Surface_CD_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CSF_Inv, Surface_CSF_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
+    for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarker_Monitoring; iMarker_Monitoring++)
       Surface_CEff_Inv[iMarker_Monitoring] = Surface_CL_Inv[iMarker_Monitoring] / (Surface_CD_Inv[iMarker_Monitoring] + EPS);
-    SU2_MPI::Allreduce(MySurface_CFx_Inv, Surface_CFx_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CFy_Inv, Surface_CFy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CFz_Inv, Surface_CFz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CMx_Inv, Surface_CMx_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CMy_Inv, Surface_CMy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CMz_Inv, Surface_CMz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   }
 
-  delete [] MySurface_CL_Inv; delete [] MySurface_CD_Inv; delete [] MySurface_CSF_Inv;
-  delete [] MySurface_CEff_Inv;  delete [] MySurface_CFx_Inv;   delete [] MySurface_CFy_Inv;
-  delete [] MySurface_CFz_Inv;   delete [] MySurface_CMx_Inv;   delete [] MySurface_CMy_Inv;
-  delete [] MySurface_CMz_Inv;
-
-#endif
-
   /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
 
   Total_CD            = AllBound_CD_Inv;
@@ -4577,18 +4509,6 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   su2double MomentX_Force[3] = {0.0,0.0,0.0}, MomentY_Force[3] = {0.0,0.0,0.0}, MomentZ_Force[3] = {0.0,0.0,0.0};
   su2double AxiFactor;
 
-#ifdef HAVE_MPI
-  su2double MyAllBound_CD_Mnt, MyAllBound_CL_Mnt, MyAllBound_CSF_Mnt,
-  MyAllBound_CMx_Mnt, MyAllBound_CMy_Mnt, MyAllBound_CMz_Mnt,
-  MyAllBound_CoPx_Mnt, MyAllBound_CoPy_Mnt, MyAllBound_CoPz_Mnt,
-  MyAllBound_CFx_Mnt, MyAllBound_CFy_Mnt, MyAllBound_CFz_Mnt, MyAllBound_CT_Mnt,
-  MyAllBound_CQ_Mnt,
-  *MySurface_CL_Mnt = NULL, *MySurface_CD_Mnt = NULL, *MySurface_CSF_Mnt = NULL,
-  *MySurface_CEff_Mnt = NULL, *MySurface_CFx_Mnt = NULL, *MySurface_CFy_Mnt = NULL,
-  *MySurface_CFz_Mnt = NULL,
-  *MySurface_CMx_Mnt = NULL, *MySurface_CMy_Mnt = NULL,  *MySurface_CMz_Mnt = NULL;
-#endif
-
   su2double Alpha            = config->GetAoA()*PI_NUMBER/180.0;
   su2double Beta             = config->GetAoS()*PI_NUMBER/180.0;
   su2double RefArea     = config->GetRefArea();
@@ -4809,102 +4729,30 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
     }
   }
 
-#ifdef HAVE_MPI
-
-  /*--- Add AllBound information using all the nodes ---*/
-
-  MyAllBound_CD_Mnt           = AllBound_CD_Mnt;           AllBound_CD_Mnt = 0.0;
-  MyAllBound_CL_Mnt           = AllBound_CL_Mnt;           AllBound_CL_Mnt = 0.0;
-  MyAllBound_CSF_Mnt          = AllBound_CSF_Mnt;          AllBound_CSF_Mnt = 0.0;
-  MyAllBound_CFx_Mnt          = AllBound_CFx_Mnt;          AllBound_CFx_Mnt = 0.0;
-  MyAllBound_CFy_Mnt          = AllBound_CFy_Mnt;          AllBound_CFy_Mnt = 0.0;
-  MyAllBound_CFz_Mnt          = AllBound_CFz_Mnt;          AllBound_CFz_Mnt = 0.0;
-  MyAllBound_CMx_Mnt          = AllBound_CMx_Mnt;          AllBound_CMx_Mnt = 0.0;
-  MyAllBound_CMy_Mnt          = AllBound_CMy_Mnt;          AllBound_CMy_Mnt = 0.0;
-  MyAllBound_CMz_Mnt          = AllBound_CMz_Mnt;          AllBound_CMz_Mnt = 0.0;
-  MyAllBound_CoPx_Mnt         = AllBound_CoPx_Mnt;         AllBound_CoPx_Mnt = 0.0;
-  MyAllBound_CoPy_Mnt         = AllBound_CoPy_Mnt;         AllBound_CoPy_Mnt = 0.0;
-  MyAllBound_CoPz_Mnt         = AllBound_CoPz_Mnt;         AllBound_CoPz_Mnt = 0.0;
-  MyAllBound_CT_Mnt           = AllBound_CT_Mnt;           AllBound_CT_Mnt = 0.0;
-  MyAllBound_CQ_Mnt           = AllBound_CQ_Mnt;           AllBound_CQ_Mnt = 0.0;
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes,
+   *    everything is reduced at once and the ratios are computed from the totals. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    SU2_MPI::Allreduce(&MyAllBound_CD_Mnt, &AllBound_CD_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CL_Mnt, &AllBound_CL_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CSF_Mnt, &AllBound_CSF_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    const auto nMarker_Monitoring = config->GetnMarker_Monitoring();
+    CReductionAccumulator reduction;
+
+    for (auto coeff : {&AllBound_CD_Mnt, &AllBound_CL_Mnt, &AllBound_CSF_Mnt, &AllBound_CMx_Mnt,
+                       &AllBound_CMy_Mnt, &AllBound_CMz_Mnt, &AllBound_CoPx_Mnt, &AllBound_CoPy_Mnt,
+                       &AllBound_CoPz_Mnt, &AllBound_CFx_Mnt, &AllBound_CFy_Mnt, &AllBound_CFz_Mnt,
+                       &AllBound_CT_Mnt, &AllBound_CQ_Mnt})
+      reduction.Add(*coeff);
+    for (auto coeff : {Surface_CL_Mnt, Surface_CD_Mnt, Surface_CSF_Mnt, Surface_CFx_Mnt,
+                       Surface_CFy_Mnt, Surface_CFz_Mnt, Surface_CMx_Mnt, Surface_CMy_Mnt,
+                       Surface_CMz_Mnt})
+      reduction.Add(coeff, nMarker_Monitoring);
+    reduction.Reduce();
+
     AllBound_CEff_Mnt = AllBound_CL_Mnt / (AllBound_CD_Mnt + EPS);
-    SU2_MPI::Allreduce(&MyAllBound_CFx_Mnt, &AllBound_CFx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CFy_Mnt, &AllBound_CFy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CFz_Mnt, &AllBound_CFz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CMx_Mnt, &AllBound_CMx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CMy_Mnt, &AllBound_CMy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CMz_Mnt, &AllBound_CMz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CoPx_Mnt, &AllBound_CoPx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CoPy_Mnt, &AllBound_CoPy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CoPz_Mnt, &AllBound_CoPz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CT_Mnt, &AllBound_CT_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyAllBound_CQ_Mnt, &AllBound_CQ_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
     AllBound_CMerit_Mnt = AllBound_CT_Mnt / (AllBound_CQ_Mnt + EPS);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  MySurface_CL_Mnt      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Mnt      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Mnt = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Mnt       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    MySurface_CL_Mnt[iMarker_Monitoring]      = Surface_CL_Mnt[iMarker_Monitoring];
-    MySurface_CD_Mnt[iMarker_Monitoring]      = Surface_CD_Mnt[iMarker_Monitoring];
-    MySurface_CSF_Mnt[iMarker_Monitoring] = Surface_CSF_Mnt[iMarker_Monitoring];
-    MySurface_CEff_Mnt[iMarker_Monitoring]       = Surface_CEff_Mnt[iMarker_Monitoring];
-    MySurface_CFx_Mnt[iMarker_Monitoring]        = Surface_CFx_Mnt[iMarker_Monitoring];
-    MySurface_CFy_Mnt[iMarker_Monitoring]        = Surface_CFy_Mnt[iMarker_Monitoring];
-    MySurface_CFz_Mnt[iMarker_Monitoring]        = Surface_CFz_Mnt[iMarker_Monitoring];
-    MySurface_CMx_Mnt[iMarker_Monitoring]        = Surface_CMx_Mnt[iMarker_Monitoring];
-    MySurface_CMy_Mnt[iMarker_Monitoring]        = Surface_CMy_Mnt[iMarker_Monitoring];
-    MySurface_CMz_Mnt[iMarker_Monitoring]        = Surface_CMz_Mnt[iMarker_Monitoring];
-
-    Surface_CL_Mnt[iMarker_Monitoring]         = 0.0;
-    Surface_CD_Mnt[iMarker_Monitoring]         = 0.0;
-    Surface_CSF_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CEff_Mnt[iMarker_Monitoring]       = 0.0;
-    Surface_CFx_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Mnt[iMarker_Monitoring]        = 0.0;
-  }
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    SU2_MPI::Allreduce(MySurface_CL_Mnt, Surface_CL_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CD_Mnt, Surface_CD_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CSF_Mnt, Surface_CSF_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
+    for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarker_Monitoring; iMarker_Monitoring++)
       Surface_CEff_Mnt[iMarker_Monitoring] = Surface_CL_Mnt[iMarker_Monitoring] / (Surface_CD_Mnt[iMarker_Monitoring] + EPS);
-    SU2_MPI::Allreduce(MySurface_CFx_Mnt, Surface_CFx_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CFy_Mnt, Surface_CFy_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CFz_Mnt, Surface_CFz_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CMx_Mnt, Surface_CMx_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CMy_Mnt, Surface_CMy_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MySurface_CMz_Mnt, Surface_CMz_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   }
 
-  delete [] MySurface_CL_Mnt; delete [] MySurface_CD_Mnt; delete [] MySurface_CSF_Mnt;
-  delete [] MySurface_CEff_Mnt;  delete [] MySurface_CFx_Mnt;   delete [] MySurface_CFy_Mnt;
-  delete [] MySurface_CFz_Mnt;
-  delete [] MySurface_CMx_Mnt;   delete [] MySurface_CMy_Mnt;  delete [] MySurface_CMz_Mnt;
-
-#endif
-
   /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
 
   Total_CD            += AllBound_CD_Mnt;
@@ -5218,6 +5066,10 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
   SetResidual_RMS(geometry, config);
 
+  /*--- Decide if the Jacobian and preconditioner are reused in the next iteration. ---*/
+
+  UpdateJacobianLag(config);
+
   /*--- For verification cases, compute the global error metrics. ---*/
 
   ComputeVerificationError(geometry, config);
@@ -5298,6 +5150,8 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
 
 void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
 
+  if (FrozenLimiters(config)) return;
+
   auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
   const auto& primitives = nodes->GetPrimitive();
   const auto& gradient = nodes->GetGradient_Reconstruction();
@@ -5761,38 +5615,8 @@ void CEulerSolver::GetPower_Properties(CGeometry *geometry, CConfig *config, uns
       }
     }
 
-    /*--- All the ranks to compute the total value ---*/
-
-#ifdef HAVE_MPI
-
-    SU2_MPI::Allreduce(Inlet_MassFlow_Local, Inlet_MassFlow_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_ReverseMassFlow_Local, Inlet_ReverseMassFlow_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Pressure_Local, Inlet_Pressure_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Mach_Local, Inlet_Mach_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_MinPressure_Local, Inlet_MinPressure_Total, nMarker_Inlet, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_MaxPressure_Local, Inlet_MaxPressure_Total, nMarker_Inlet, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_TotalPressure_Local, Inlet_TotalPressure_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Temperature_Local, Inlet_Temperature_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_TotalTemperature_Local, Inlet_TotalTemperature_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_RamDrag_Local, Inlet_RamDrag_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Force_Local, Inlet_Force_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Power_Local, Inlet_Power_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Area_Local, Inlet_Area_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_XCG_Local, Inlet_XCG_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_YCG_Local, Inlet_YCG_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    if (nDim == 3) SU2_MPI::Allreduce(Inlet_ZCG_Local, Inlet_ZCG_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-    SU2_MPI::Allreduce(Outlet_MassFlow_Local, Outlet_MassFlow_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Pressure_Local, Outlet_Pressure_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_TotalPressure_Local, Outlet_TotalPressure_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Temperature_Local, Outlet_Temperature_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_TotalTemperature_Local, Outlet_TotalTemperature_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_GrossThrust_Local, Outlet_GrossThrust_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Force_Local, Outlet_Force_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Power_Local, Outlet_Power_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Area_Local, Outlet_Area_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-#else
+    /*--- All the ranks to compute the total value, the local values are copied and
+     *    then reduced in place (one reduction for each type of operation). ---*/
 
     for (iMarker_Inlet = 0; iMarker_Inlet < nMarker_Inlet; iMarker_Inlet++) {
       Inlet_MassFlow_Total[iMarker_Inlet]                            = Inlet_MassFlow_Local[iMarker_Inlet];
@@ -5825,7 +5649,23 @@ void CEulerSolver::GetPower_Properties(CGeometry *geometry, CConfig *config, uns
       Outlet_Area_Total[iMarker_Outlet]                                         = Outlet_Area_Local[iMarker_Outlet];
     }
 
-#endif
+    CReductionAccumulator reduction;
+
+    for (auto total : {Inlet_MassFlow_Total, Inlet_ReverseMassFlow_Total, Inlet_Pressure_Total,
+                       Inlet_Mach_Total, Inlet_TotalPressure_Total, Inlet_Temperature_Total,
+                       Inlet_TotalTemperature_Total, Inlet_RamDrag_Total, Inlet_Force_Total,
+                       Inlet_Power_Total, Inlet_Area_Total, Inlet_XCG_Total, Inlet_YCG_Total})
+      reduction.Add(total, nMarker_Inlet);
+    if (nDim == 3) reduction.Add(Inlet_ZCG_Total, nMarker_Inlet);
+    reduction.Add(Inlet_MinPressure_Total, nMarker_Inlet, CReductionAccumulator::MIN);
+    reduction.Add(Inlet_MaxPressure_Total, nMarker_Inlet, CReductionAccumulator::MAX);
+
+    for (auto total : {Outlet_MassFlow_Total, Outlet_Pressure_Total, Outlet_TotalPressure_Total,
+                       Outlet_Temperature_Total, Outlet_TotalTemperature_Total, Outlet_GrossThrust_Total,
+                       Outlet_Force_Total, Outlet_Power_Total, Outlet_Area_Total})
+      reduction.Add(total, nMarker_Outlet);
+
+    reduction.Reduce();
 
     /*--- Compute the value of the average surface temperature and pressure and
      set the value in the config structure for future use ---*/
@@ -6804,7 +6644,7 @@ void CEulerSolver::SetActDisk_BCThrust(CGeometry *geometry, CSolver **solver_con
 
   MyBCThrust = config->GetInitial_BCThrust();
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&MyBCThrust, &BCThrust, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyBCThrust, &BCThrust, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 #else
   BCThrust = MyBCThrust;
 #endif
@@ -8983,12 +8823,12 @@ void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNum
       cktemp_out2 = complex<su2double>(0.0,0.0);
 
 
-      SU2_MPI::Allreduce(&MyRe_inf, &Re_inf, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyIm_inf, &Im_inf, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyRe_out1, &Re_out1, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyIm_out1, &Im_out1, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyRe_out2, &Re_out2, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyIm_out2, &Im_out2, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyRe_inf, &Re_inf, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&MyIm_inf, &Im_inf, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&MyRe_out1, &Re_out1, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&MyIm_out1, &Im_out1, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&MyRe_out2, &Re_out2, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(&MyIm_out2, &Im_out2, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
       cktemp_inf = complex<su2double>(Re_inf,Im_inf);
       cktemp_out1 = complex<su2double>(Re_out1,Im_out1);
@@ -12166,7 +12006,7 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
 #ifndef HAVE_MPI
   rbuf_NotMatching = sbuf_NotMatching;
 #else
-  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, SU2_MPI::GetComm());
 #endif
   if (rbuf_NotMatching != 0) {
       SU2_MPI::Error(string("The solution file ") + restart_filename + string(" doesn't match with the mesh file!\n") +
@@ -12189,8 +12029,8 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
     for (iPoint = 0; iPoint < geometry[iMesh]->GetnPoint(); iPoint++) {
       Area_Parent = geometry[iMesh]->node[iPoint]->GetVolume();
       for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
-      for (iChildren = 0; iChildren < geometry[iMesh]->node[iPoint]->GetnChildren_CV(); iChildren++) {
-        Point_Fine = geometry[iMesh]->node[iPoint]->GetChildren_CV(iChildren);
+      for (iChildren = 0; iChildren < geometry[iMesh]->GetChildrenCV().getNumNonZeros(iPoint); iChildren++) {
+        Point_Fine = geometry[iMesh]->GetChildrenCV().getInnerIdx(iPoint, iChildren);
         Area_Children = geometry[iMesh-1]->node[Point_Fine]->GetVolume();
         Solution_Fine = solver[iMesh-1][FLOW_SOL]->GetNodes()->GetSolution(Point_Fine);
         for (iVar = 0; iVar < nVar; iVar++) {
@@ -12351,10 +12191,10 @@ void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CCon
   unsigned long iVertex, iPoint;
   unsigned short iDim, iMarker, iMarkerTP, iSpan;
   su2double Pressure = 0.0, Density = 0.0, *Velocity = NULL, *TurboVelocity,
-      Area, TotalArea, TotalAreaPressure, TotalAreaDensity, *TotalAreaVelocity, *UnitNormal, *TurboNormal;
+      Area, TotalArea, TotalAreaPressure, TotalAreaDensity, *UnitNormal, *TurboNormal;
   string Marker_Tag, Monitoring_Tag;
   unsigned short  iZone     = config->GetiZone();
-  const su2double  *AverageTurboNormal;
+  const su2double  *AverageTurboNormal, *TotalAreaVelocity;
   su2double VelSq;
 
   /*-- Variables declaration and allocation ---*/
@@ -12362,29 +12202,23 @@ void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CCon
   UnitNormal         = new su2double[nDim];
   TurboNormal        = new su2double[nDim];
   TurboVelocity      = new su2double[nDim];
-  TotalAreaVelocity  = new su2double[nDim];
-
-#ifdef HAVE_MPI
-  su2double MyTotalAreaDensity, MyTotalAreaPressure;
-  su2double *MyTotalAreaVelocity = NULL;
-#endif
-
-  for (iSpan= 0; iSpan < nSpanWiseSections; iSpan++){
 
+  /*--- Area weighted sums of density, pressure and velocity, packed by span so that all
+   *    spans are reduced at once over the ranks that have this kind of turbo marker. ---*/
 
-    for (iDim=0; iDim<nDim; iDim++) {
-      TotalAreaVelocity[iDim] = 0.0;
-    }
-
-    TotalAreaPressure = 0.0;
-    TotalAreaDensity  = 0.0;
+  const unsigned short AREA_DENSITY = 0, AREA_PRESSURE = 1, AREA_VELOCITY = 2;
+  su2activematrix spanTotals(nSpanWiseSections, 2+nDim);
+  spanTotals = su2double(0.0);
+  bool hasMarker = false;
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+          hasMarker = true;
 
-            /*--- Retrieve Old Solution ---*/
+          for (iSpan= 0; iSpan < nSpanWiseSections; iSpan++){
+            su2double* total = spanTotals[iSpan];
 
             /*--- Loop over the vertices to sum all the quantities pithc-wise ---*/
             for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
@@ -12410,43 +12244,31 @@ void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CCon
 
                 /*--- Compute different integral quantities for the boundary of interest ---*/
 
-                TotalAreaPressure += Area*Pressure;
-                TotalAreaDensity  += Area*Density;
+                total[AREA_PRESSURE] += Area*Pressure;
+                total[AREA_DENSITY]  += Area*Density;
                 for (iDim = 0; iDim < nDim; iDim++)
-                  TotalAreaVelocity[iDim] += Area*Velocity[iDim];
+                  total[AREA_VELOCITY+iDim] += Area*Velocity[iDim];
               }
             }
           }
         }
       }
     }
+  }
 
+  /*--- Add information using all the nodes ---*/
 
-#ifdef HAVE_MPI
-
-    /*--- Add information using all the nodes ---*/
-
-    MyTotalAreaDensity   = TotalAreaDensity;          TotalAreaDensity     = 0;
-    MyTotalAreaPressure  = TotalAreaPressure;         TotalAreaPressure    = 0;
-
-    SU2_MPI::Allreduce(&MyTotalAreaDensity, &TotalAreaDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaPressure, &TotalAreaPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-
-    MyTotalAreaVelocity    = new su2double[nDim];
-
-
-    for (iDim = 0; iDim < nDim; iDim++) {
-      MyTotalAreaVelocity[iDim]    = TotalAreaVelocity[iDim];
-      TotalAreaVelocity[iDim]      = 0.0;
-    }
-
-    SU2_MPI::Allreduce(MyTotalAreaVelocity, TotalAreaVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-    delete [] MyTotalAreaVelocity;
+  if (hasMarker) {
+    CReductionAccumulator reduction(geometry->GetTurboComm(marker_flag));
+    reduction.Add(spanTotals.data(), spanTotals.size());
+    reduction.Reduce();
+  }
 
+  for (iSpan= 0; iSpan < nSpanWiseSections; iSpan++){
 
-#endif
+    TotalAreaDensity  = spanTotals(iSpan, AREA_DENSITY);
+    TotalAreaPressure = spanTotals(iSpan, AREA_PRESSURE);
+    TotalAreaVelocity = &spanTotals(iSpan, AREA_VELOCITY);
 
     /*--- initialize spanwise average quantities ---*/
 
@@ -12515,7 +12337,6 @@ void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CCon
   delete [] UnitNormal;
   delete [] TurboNormal;
   delete [] TurboVelocity;
-  delete [] TotalAreaVelocity;
 
 }
 
@@ -12523,17 +12344,17 @@ void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CCon
 void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CConfig *config, unsigned short marker_flag) {
 
   unsigned long iVertex, iPoint, nVert;
-  unsigned short iDim, iVar, iMarker, iMarkerTP, iSpan, jSpan;
+  unsigned short iDim, iVar, iMarker, iMarkerTP, iSpan;
   unsigned short average_process = config->GetKind_AverageProcess();
   unsigned short performance_average_process = config->GetKind_PerformanceAverageProcess();
   su2double Pressure = 0.0, Density = 0.0, Enthalpy = 0.0,  *Velocity = NULL, *TurboVelocity,
-      Area, TotalArea, Radius1, Radius2, Vt2, TotalAreaPressure, TotalAreaDensity, *TotalAreaVelocity, *UnitNormal, *TurboNormal,
-      TotalMassPressure, TotalMassDensity, *TotalMassVelocity;
+      Area, TotalArea, Radius1, Radius2, Vt2, TotalAreaPressure, TotalAreaDensity, *TurboNormal,
+      TotalMassPressure, TotalMassDensity;
   string Marker_Tag, Monitoring_Tag;
   su2double val_init_pressure;
   unsigned short  iZone     = config->GetiZone();
-  su2double TotalDensity, TotalPressure, *TotalVelocity, *TotalFluxes;
-  const su2double *AverageTurboNormal;
+  su2double TotalDensity, TotalPressure;
+  const su2double *AverageTurboNormal, *TotalVelocity, *TotalAreaVelocity, *TotalMassVelocity, *TotalFluxes;
   su2double TotalNu, TotalOmega, TotalKine, TotalMassNu, TotalMassOmega, TotalMassKine, TotalAreaNu, TotalAreaOmega, TotalAreaKine;
   su2double Nu, Kine, Omega;
   su2double MachTest, soundSpeed;
@@ -12543,13 +12364,8 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
 
   /*-- Variables declaration and allocation ---*/
   Velocity            = new su2double[nDim];
-  UnitNormal          = new su2double[nDim];
   TurboNormal         = new su2double[nDim];
   TurboVelocity       = new su2double[nDim];
-  TotalVelocity       = new su2double[nDim];
-  TotalAreaVelocity   = new su2double[nDim];
-  TotalMassVelocity   = new su2double[nDim];
-  TotalFluxes         = new su2double[nVar];
 
   su2double avgDensity, *avgVelocity, avgPressure, avgKine, avgOmega, avgNu, avgAreaDensity, *avgAreaVelocity, avgAreaPressure,
   avgAreaKine, avgAreaOmega, avgAreaNu, avgMassDensity, *avgMassVelocity, avgMassPressure, avgMassKine, avgMassOmega, avgMassNu,
@@ -12562,99 +12378,75 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
   avgMixTurboVelocity = new su2double[nDim];
 
 
-#ifdef HAVE_MPI
-  su2double MyTotalDensity, MyTotalPressure, MyTotalAreaDensity, MyTotalAreaPressure, MyTotalMassPressure, MyTotalMassDensity, *MyTotalFluxes = NULL;
-  su2double *MyTotalVelocity = NULL, *MyTotalAreaVelocity = NULL, *MyTotalMassVelocity = NULL;
-  su2double MyTotalNu, MyTotalKine, MyTotalOmega, MyTotalAreaNu, MyTotalAreaKine, MyTotalAreaOmega, MyTotalMassNu, MyTotalMassKine, MyTotalMassOmega;
-#endif
-
+  /*--- Layout of the integral quantities of each span, all spans of a marker are packed
+   *    in one matrix such that they are reduced with a single collective. ---*/
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
+  enum : unsigned short {DENSITY, PRESSURE, AREA_DENSITY, AREA_PRESSURE, MASS_DENSITY, MASS_PRESSURE,
+                         NU, KINE, OMEGA, AREA_NU, AREA_KINE, AREA_OMEGA, MASS_NU, MASS_KINE, MASS_OMEGA,
+                         VELOCITY};
+  const unsigned short AREA_VELOCITY = VELOCITY+nDim, MASS_VELOCITY = VELOCITY+2*nDim,
+                       FLUXES = VELOCITY+3*nDim, nQuant = FLUXES+nVar;
 
-    /*--- Forces initialization for contenitors ---*/
-    for (iVar=0;iVar<nVar;iVar++)
-      TotalFluxes[iVar]= 0.0;
-    for (iDim=0; iDim<nDim; iDim++) {
-      TotalVelocity[iDim]     = 0.0;
-      TotalAreaVelocity[iDim] = 0.0;
-      TotalMassVelocity[iDim] = 0.0;
-    }
-
-    TotalDensity      = 0.0;
-    TotalPressure     = 0.0;
-    TotalAreaPressure = 0.0;
-    TotalAreaDensity  = 0.0;
-    TotalMassPressure = 0.0;
-    TotalMassDensity  = 0.0;
-    TotalNu           = 0.0;
-    TotalOmega        = 0.0;
-    TotalKine         = 0.0;
-    TotalMassNu       = 0.0;
-    TotalMassOmega    = 0.0;
-    TotalMassKine     = 0.0;
-    TotalAreaNu       = 0.0;
-    TotalAreaOmega    = 0.0;
-    TotalAreaKine     = 0.0;
-
-    Nu    = 0.0;
-    Omega = 0.0;
-    Kine  = 0.0;
+  /*--- The last row holds the quantities of the whole marker (1D average). ---*/
+  su2activematrix spanTotals(nSpanWiseSections+1, nQuant);
+  spanTotals = su2double(0.0);
+  bool hasMarker = false;
 
+  Nu    = 0.0;
+  Omega = 0.0;
+  Kine  = 0.0;
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
-
-            /*--- Retrieve Old Solution ---*/
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+          hasMarker = true;
 
+          for (iSpan= 0; iSpan < nSpanWiseSections; iSpan++){
             /*--- Loop over the vertices to sum all the quantities pithc-wise ---*/
-            if(iSpan < nSpanWiseSections){
-              for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
-                iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
+            for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
+              iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
 
-                /*--- Compute the integral fluxes for the boundaries ---*/
-                Pressure = nodes->GetPressure(iPoint);
-                Density  = nodes->GetDensity(iPoint);
-                Enthalpy = nodes->GetEnthalpy(iPoint);
+              /*--- Compute the integral fluxes for the boundaries ---*/
+              Pressure = nodes->GetPressure(iPoint);
+              Density  = nodes->GetDensity(iPoint);
+              Enthalpy = nodes->GetEnthalpy(iPoint);
 
-                /*--- Normal vector for this vertex (negate for outward convention) ---*/
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetNormal(UnitNormal);
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(TurboNormal);
-                Area = geometry->turbovertex[iMarker][iSpan][iVertex]->GetArea();
-                su2double VelNormal = 0.0, VelSq = 0.0;
+              /*--- Normal vector for this vertex (negate for outward convention) ---*/
+              geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(TurboNormal);
+              Area = geometry->turbovertex[iMarker][iSpan][iVertex]->GetArea();
 
-                for (iDim = 0; iDim < nDim; iDim++) {
-                  Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
-                  VelNormal += UnitNormal[iDim]*Velocity[iDim];
-                  VelSq += Velocity[iDim]*Velocity[iDim];
-                }
+              for (iDim = 0; iDim < nDim; iDim++)
+                Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
 
-                ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
+              ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
 
-                /*--- Compute different integral quantities for the boundary of interest ---*/
+              const su2double MassArea = Area*(Density*TurboVelocity[0]);
+
+              /*--- Compute different integral quantities for the boundary of interest, for the span and
+               *    for the whole marker (last row, summed in the same order as the spans). ---*/
 
-                TotalDensity          += Density;
-                TotalPressure         += Pressure;
+              for (su2double* total : {spanTotals[iSpan], spanTotals[nSpanWiseSections]}) {
+                total[DENSITY]  += Density;
+                total[PRESSURE] += Pressure;
                 for (iDim = 0; iDim < nDim; iDim++)
-                  TotalVelocity[iDim] += Velocity[iDim];
+                  total[VELOCITY+iDim] += Velocity[iDim];
 
-                TotalAreaPressure         += Area*Pressure;
-                TotalAreaDensity          += Area*Density;
+                total[AREA_PRESSURE] += Area*Pressure;
+                total[AREA_DENSITY]  += Area*Density;
                 for (iDim = 0; iDim < nDim; iDim++)
-                  TotalAreaVelocity[iDim] += Area*Velocity[iDim];
+                  total[AREA_VELOCITY+iDim] += Area*Velocity[iDim];
 
-                TotalMassPressure         += Area*(Density*TurboVelocity[0] )*Pressure;
-                TotalMassDensity          += Area*(Density*TurboVelocity[0] )*Density;
+                total[MASS_PRESSURE] += MassArea*Pressure;
+                total[MASS_DENSITY]  += MassArea*Density;
                 for (iDim = 0; iDim < nDim; iDim++)
-                  TotalMassVelocity[iDim] += Area*(Density*TurboVelocity[0] )*Velocity[iDim];
+                  total[MASS_VELOCITY+iDim] += MassArea*Velocity[iDim];
 
-                TotalFluxes[0]      += Area*(Density*TurboVelocity[0]);
-                TotalFluxes[1]      += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
+                total[FLUXES]   += MassArea;
+                total[FLUXES+1] += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
                 for (iDim = 2; iDim < nDim+1; iDim++)
-                  TotalFluxes[iDim] += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
-                TotalFluxes[nDim+1] += Area*(Density*TurboVelocity[0]*Enthalpy);
-
+                  total[FLUXES+iDim] += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
+                total[FLUXES+nDim+1] += Area*(Density*TurboVelocity[0]*Enthalpy);
 
                 /*--- Compute turbulent integral quantities for the boundary of interest ---*/
 
@@ -12667,94 +12459,17 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
                     Nu = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
                   }
 
-                  TotalKine   += Kine;
-                  TotalOmega  += Omega;
-                  TotalNu     += Nu;
-
-                  TotalAreaKine    += Area*Kine;
-                  TotalAreaOmega   += Area*Omega;
-                  TotalAreaNu      += Area*Nu;
-
-                  TotalMassKine    += Area*(Density*TurboVelocity[0] )*Kine;
-                  TotalMassOmega   += Area*(Density*TurboVelocity[0] )*Omega;
-                  TotalMassNu      += Area*(Density*TurboVelocity[0] )*Nu;
-
-
-                }
-              }
-            }
-            else{
-              for (jSpan= 0; jSpan < nSpanWiseSections; jSpan++){
-                for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,jSpan); iVertex++) {
-                  iPoint = geometry->turbovertex[iMarker][jSpan][iVertex]->GetNode();
-
-                  /*--- Compute the integral fluxes for the boundaries ---*/
-                  Pressure = nodes->GetPressure(iPoint);
-                  Density  = nodes->GetDensity(iPoint);
-                  Enthalpy = nodes->GetEnthalpy(iPoint);
-
-                  /*--- Normal vector for this vertex (negate for outward convention) ---*/
-                  geometry->turbovertex[iMarker][jSpan][iVertex]->GetNormal(UnitNormal);
-                  geometry->turbovertex[iMarker][jSpan][iVertex]->GetTurboNormal(TurboNormal);
-                  Area = geometry->turbovertex[iMarker][jSpan][iVertex]->GetArea();
-                  su2double VelNormal = 0.0, VelSq = 0.0;
-
-                  for (iDim = 0; iDim < nDim; iDim++) {
-                    Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
-                    VelNormal += UnitNormal[iDim]*Velocity[iDim];
-                    VelSq += Velocity[iDim]*Velocity[iDim];
-                  }
-
-                  ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
-
-                  /*--- Compute different integral quantities for the boundary of interest ---*/
-
-                  TotalDensity          += Density;
-                  TotalPressure         += Pressure;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalVelocity[iDim] += Velocity[iDim];
-
-                  TotalAreaPressure         += Area*Pressure;
-                  TotalAreaDensity          += Area*Density;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalAreaVelocity[iDim] += Area*Velocity[iDim];
+                  total[KINE]  += Kine;
+                  total[OMEGA] += Omega;
+                  total[NU]    += Nu;
 
-                  TotalMassPressure         += Area*(Density*TurboVelocity[0] )*Pressure;
-                  TotalMassDensity          += Area*(Density*TurboVelocity[0] )*Density;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalMassVelocity[iDim] += Area*(Density*TurboVelocity[0] )*Velocity[iDim];
+                  total[AREA_KINE]  += Area*Kine;
+                  total[AREA_OMEGA] += Area*Omega;
+                  total[AREA_NU]    += Area*Nu;
 
-                  TotalFluxes[0]      += Area*(Density*TurboVelocity[0]);
-                  TotalFluxes[1]      += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
-                  for (iDim = 2; iDim < nDim+1; iDim++)
-                    TotalFluxes[iDim] += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
-                  TotalFluxes[nDim+1] += Area*(Density*TurboVelocity[0]*Enthalpy);
-
-
-                  /*--- Compute turbulent integral quantities for the boundary of interest ---*/
-
-                  if(turbulent){
-                    if(menter_sst){
-                      Kine  = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                      Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
-                    }
-                    if(spalart_allmaras){
-                      Nu    = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                    }
-
-                    TotalKine   += Kine;
-                    TotalOmega  += Omega;
-                    TotalNu     += Nu;
-
-                    TotalAreaKine   += Area*Kine;
-                    TotalAreaOmega  += Area*Omega;
-                    TotalAreaNu     += Area*Nu;
-
-                    TotalMassKine    += Area*(Density*TurboVelocity[0] )*Kine;
-                    TotalMassOmega   += Area*(Density*TurboVelocity[0] )*Omega;
-                    TotalMassNu      += Area*(Density*TurboVelocity[0] )*Nu;
-
-                  }
+                  total[MASS_KINE]  += MassArea*Kine;
+                  total[MASS_OMEGA] += MassArea*Omega;
+                  total[MASS_NU]    += MassArea*Nu;
                 }
               }
             }
@@ -12762,76 +12477,39 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
-
-    /*--- Add information using all the nodes ---*/
-
-    MyTotalDensity       = TotalDensity;              TotalDensity         = 0;
-    MyTotalPressure      = TotalPressure;             TotalPressure        = 0;
-    MyTotalAreaDensity   = TotalAreaDensity;          TotalAreaDensity     = 0;
-    MyTotalAreaPressure  = TotalAreaPressure;         TotalAreaPressure    = 0;
-    MyTotalMassDensity   = TotalMassDensity;          TotalMassDensity     = 0;
-    MyTotalMassPressure  = TotalMassPressure;         TotalMassPressure    = 0;
-    MyTotalNu            = TotalNu;                   TotalNu              = 0;
-    MyTotalKine          = TotalKine;                 TotalKine            = 0;
-    MyTotalOmega         = TotalOmega;                TotalOmega           = 0;
-    MyTotalAreaNu        = TotalAreaNu;               TotalAreaNu          = 0;
-    MyTotalAreaKine      = TotalAreaKine;             TotalAreaKine        = 0;
-    MyTotalAreaOmega     = TotalAreaOmega;            TotalAreaOmega       = 0;
-    MyTotalMassNu        = TotalMassNu;               TotalMassNu          = 0;
-    MyTotalMassKine      = TotalMassKine;             TotalMassKine        = 0;
-    MyTotalMassOmega     = TotalMassOmega;            TotalMassOmega       = 0;
-
-
-
-
-    SU2_MPI::Allreduce(&MyTotalDensity, &TotalDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalPressure, &TotalPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaDensity, &TotalAreaDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaPressure, &TotalAreaPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassDensity, &TotalMassDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassPressure, &TotalMassPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalNu, &TotalNu, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalKine, &TotalKine, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalOmega, &TotalOmega, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaNu, &TotalAreaNu, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaKine, &TotalAreaKine, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaOmega, &TotalAreaOmega, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassNu, &TotalMassNu, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassKine, &TotalMassKine, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassOmega, &TotalMassOmega, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-
-    MyTotalFluxes          = new su2double[nVar];
-    MyTotalVelocity        = new su2double[nDim];
-    MyTotalAreaVelocity    = new su2double[nDim];
-    MyTotalMassVelocity    = new su2double[nDim];
-
-    for (iVar = 0; iVar < nVar; iVar++) {
-      MyTotalFluxes[iVar]  = TotalFluxes[iVar];
-      TotalFluxes[iVar]    = 0.0;
-    }
-
-    for (iDim = 0; iDim < nDim; iDim++) {
-      MyTotalVelocity[iDim]        = TotalVelocity[iDim];
-      TotalVelocity[iDim]          = 0.0;
-      MyTotalAreaVelocity[iDim]    = TotalAreaVelocity[iDim];
-      TotalAreaVelocity[iDim]      = 0.0;
-      MyTotalMassVelocity[iDim]    = TotalMassVelocity[iDim];
-      TotalMassVelocity[iDim]      = 0.0;
-    }
-
-    SU2_MPI::Allreduce(MyTotalFluxes, TotalFluxes, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalVelocity, TotalVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalAreaVelocity, TotalAreaVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalMassVelocity, TotalMassVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-    delete [] MyTotalFluxes; delete [] MyTotalVelocity; delete [] MyTotalAreaVelocity; delete [] MyTotalMassVelocity;
+  /*--- Add information using all the nodes ---*/
 
+  if (hasMarker) {
+    CReductionAccumulator reduction(geometry->GetTurboComm(marker_flag));
+    reduction.Add(spanTotals.data(), spanTotals.size());
+    reduction.Reduce();
+  }
 
-#endif
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
 
+    const su2double* total = spanTotals[iSpan];
+
+    TotalDensity      = total[DENSITY];
+    TotalPressure     = total[PRESSURE];
+    TotalAreaPressure = total[AREA_PRESSURE];
+    TotalAreaDensity  = total[AREA_DENSITY];
+    TotalMassPressure = total[MASS_PRESSURE];
+    TotalMassDensity  = total[MASS_DENSITY];
+    TotalNu           = total[NU];
+    TotalOmega        = total[OMEGA];
+    TotalKine         = total[KINE];
+    TotalMassNu       = total[MASS_NU];
+    TotalMassOmega    = total[MASS_OMEGA];
+    TotalMassKine     = total[MASS_KINE];
+    TotalAreaNu       = total[AREA_NU];
+    TotalAreaOmega    = total[AREA_OMEGA];
+    TotalAreaKine     = total[AREA_KINE];
+    TotalVelocity     = &total[VELOCITY];
+    TotalAreaVelocity = &total[AREA_VELOCITY];
+    TotalMassVelocity = &total[MASS_VELOCITY];
+    TotalFluxes       = &total[FLUXES];
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
       for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
@@ -13134,13 +12812,8 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
 
   /*--- Free locally allocated memory ---*/
   delete [] Velocity;
-  delete [] UnitNormal;
   delete [] TurboNormal;
   delete [] TurboVelocity;
-  delete [] TotalVelocity;
-  delete [] TotalAreaVelocity;
-  delete [] TotalFluxes;
-  delete [] TotalMassVelocity;
   delete [] avgVelocity;
   delete [] avgAreaVelocity;
   delete [] avgMassVelocity;
@@ -13157,9 +12830,7 @@ void CEulerSolver::MixedOut_Average (CConfig *config, su2double val_init_pressur
   su2double relax_factor = config->GetMixedout_Coeff(0);
   su2double toll = config->GetMixedout_Coeff(1);
   unsigned short maxiter = SU2_TYPE::Int(config->GetMixedout_Coeff(2));
-  su2double dhdP, dhdrho, enthalpy_mix, velsq, *vel;
-
-  vel = new su2double[nDim];
+  su2double dhdP, dhdrho, enthalpy_mix, velsq, vel[3];
 
   pressure_mix = val_init_pressure;
 
@@ -13199,212 +12870,112 @@ void CEulerSolver::MixedOut_Average (CConfig *config, su2double val_init_pressur
 
   density_mix = val_Averaged_Flux[0]*val_Averaged_Flux[0]/(val_Averaged_Flux[1] - pressure_mix);
 
-
-  delete [] vel;
-
 }
 
 void CEulerSolver::GatherInOutAverageValues(CConfig *config, CGeometry *geometry){
 
   unsigned short iMarker, iMarkerTP;
-  unsigned short iSpan;
-  int markerTP;
-  su2double     densityIn, pressureIn, normalVelocityIn, tangVelocityIn, radialVelocityIn;
-  su2double     densityOut, pressureOut, normalVelocityOut, tangVelocityOut, radialVelocityOut;
-  su2double     kineIn, omegaIn, nuIn, kineOut, omegaOut, nuOut;
+  unsigned short iSpan, iVal;
+  int markerTP, iRank;
   //TODO (turbo) implement interpolation so that Inflow and Outflow spanwise section can be different
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+  /*--- Pack the inflow and outflow performance quantities (density, pressure, normal, tangential and
+   *    radial velocity, kine, omega, nu) of all spans and the index of the marker, to gather them on
+   *    the master node with a single collective. A negative density means "not on this rank". ---*/
 
-#ifdef HAVE_MPI
-    unsigned short i, n1, n2, n1t,n2t;
-    su2double *TurbPerfIn= NULL,*TurbPerfOut= NULL;
-    su2double *TotTurbPerfIn = NULL,*TotTurbPerfOut = NULL;
-    int *TotMarkerTP = NULL;
-
-    n1          = 8;
-    n2          = 8;
-    n1t         = n1*size;
-    n2t         = n2*size;
-    TurbPerfIn  = new su2double[n1];
-    TurbPerfOut = new su2double[n2];
-
-    for (i=0;i<n1;i++)
-      TurbPerfIn[i]    = -1.0;
-    for (i=0;i<n2;i++)
-      TurbPerfOut[i]   = -1.0;
-#endif
+  const unsigned short N_VAL = 8, N_SPAN = 2*N_VAL;
+  const unsigned long nPack = (nSpanWiseSections+1)*N_SPAN + 1;
 
+  vector<su2double> sendBuf(nPack, -1.0), recvBuf;
+  if (rank == MASTER_NODE) recvBuf.resize(size*nPack);
 
-    densityIn            = -1.0;
-    pressureIn           = -1.0;
-    normalVelocityIn     = -1.0;
-    tangVelocityIn       = -1.0;
-    radialVelocityIn     = -1.0;
-    densityOut           = -1.0;
-    pressureOut          = -1.0;
-    normalVelocityOut    = -1.0;
-    tangVelocityOut      = -1.0;
-    radialVelocityOut    = -1.0;
-    kineIn               = -1.0;
-    omegaIn              = -1.0;
-    nuIn                 = -1.0;
-    kineOut              = -1.0;
-    omegaOut             = -1.0;
-    nuOut                = -1.0;
-
-
-    markerTP             = -1;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+          su2double* buf = &sendBuf[iSpan*N_SPAN];
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
           if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
-            markerTP            = iMarkerTP;
-            densityIn           = DensityIn[iMarkerTP -1][iSpan];
-            pressureIn          = PressureIn[iMarkerTP -1][iSpan];
-            normalVelocityIn    = TurboVelocityIn[iMarkerTP -1][iSpan][0];
-            tangVelocityIn      = TurboVelocityIn[iMarkerTP -1][iSpan][1];
+            sendBuf[nPack-1] = iMarkerTP;
+            buf[0] = DensityIn[iMarkerTP -1][iSpan];
+            buf[1] = PressureIn[iMarkerTP -1][iSpan];
+            buf[2] = TurboVelocityIn[iMarkerTP -1][iSpan][0];
+            buf[3] = TurboVelocityIn[iMarkerTP -1][iSpan][1];
             if (nDim ==3){
-              radialVelocityIn  = TurboVelocityIn[iMarkerTP -1][iSpan][2];
+              buf[4] = TurboVelocityIn[iMarkerTP -1][iSpan][2];
             }
-            kineIn              = KineIn[iMarkerTP -1][iSpan];
-            omegaIn             = OmegaIn[iMarkerTP -1][iSpan];
-            nuIn                = NuIn[iMarkerTP -1][iSpan];
-
-
-#ifdef HAVE_MPI
-            TurbPerfIn[0]  = densityIn;
-            TurbPerfIn[1]  = pressureIn;
-            TurbPerfIn[2]  = normalVelocityIn;
-            TurbPerfIn[3]  = tangVelocityIn;
-            TurbPerfIn[4]  = radialVelocityIn;
-            TurbPerfIn[5]  = kineIn;
-            TurbPerfIn[6]  = omegaIn;
-            TurbPerfIn[7]  = nuIn;
-#endif
+            buf[5] = KineIn[iMarkerTP -1][iSpan];
+            buf[6] = OmegaIn[iMarkerTP -1][iSpan];
+            buf[7] = NuIn[iMarkerTP -1][iSpan];
           }
 
           /*--- retrieve outlet information ---*/
           if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
-            densityOut           = DensityOut[iMarkerTP -1][iSpan];
-            pressureOut          = PressureOut[iMarkerTP -1][iSpan];
-            normalVelocityOut    = TurboVelocityOut[iMarkerTP -1][iSpan][0];
-            tangVelocityOut      = TurboVelocityOut[iMarkerTP -1][iSpan][1];
+            buf += N_VAL;
+            buf[0] = DensityOut[iMarkerTP -1][iSpan];
+            buf[1] = PressureOut[iMarkerTP -1][iSpan];
+            buf[2] = TurboVelocityOut[iMarkerTP -1][iSpan][0];
+            buf[3] = TurboVelocityOut[iMarkerTP -1][iSpan][1];
             if (nDim ==3){
-              radialVelocityOut  = TurboVelocityOut[iMarkerTP -1][iSpan][2];
+              buf[4] = TurboVelocityOut[iMarkerTP -1][iSpan][2];
             }
-            kineOut              = KineOut[iMarkerTP -1][iSpan];
-            omegaOut             = OmegaOut[iMarkerTP -1][iSpan];
-            nuOut                = NuOut[iMarkerTP -1][iSpan];
-
-
-
-#ifdef HAVE_MPI
-            TurbPerfOut[0]  = densityOut;
-            TurbPerfOut[1]  = pressureOut;
-            TurbPerfOut[2]  = normalVelocityOut;
-            TurbPerfOut[3]  = tangVelocityOut;
-            TurbPerfOut[4]  = radialVelocityOut;
-            TurbPerfOut[5]  = kineOut;
-            TurbPerfOut[6]  = omegaOut;
-            TurbPerfOut[7]  = nuOut;
-#endif
+            buf[5] = KineOut[iMarkerTP -1][iSpan];
+            buf[6] = OmegaOut[iMarkerTP -1][iSpan];
+            buf[7] = NuOut[iMarkerTP -1][iSpan];
           }
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
-    if (rank == MASTER_NODE){
-      TotTurbPerfIn       = new su2double[n1t];
-      TotTurbPerfOut      = new su2double[n2t];
-      for (i=0;i<n1t;i++)
-        TotTurbPerfIn[i]  = -1.0;
-      for (i=0;i<n2t;i++)
-        TotTurbPerfOut[i] = -1.0;
-      TotMarkerTP = new int[size];
-      for(i=0; i<size; i++){
-        TotMarkerTP[i]    = -1;
-      }
-    }
-    SU2_MPI::Gather(TurbPerfIn, n1, MPI_DOUBLE, TotTurbPerfIn, n1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(TurbPerfOut, n2, MPI_DOUBLE,TotTurbPerfOut, n2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
-    if (rank == MASTER_NODE){
-      delete [] TurbPerfIn, delete [] TurbPerfOut;
-    }
-
-    if (rank == MASTER_NODE){
-      for (i=0;i<size;i++){
-        if(TotTurbPerfIn[n1*i] > 0.0){
-          densityIn        = 0.0;
-          densityIn        = TotTurbPerfIn[n1*i];
-          pressureIn       = 0.0;
-          pressureIn       = TotTurbPerfIn[n1*i+1];
-          normalVelocityIn = 0.0;
-          normalVelocityIn = TotTurbPerfIn[n1*i+2];
-          tangVelocityIn   = 0.0;
-          tangVelocityIn   = TotTurbPerfIn[n1*i+3];
-          radialVelocityIn = 0.0;
-          radialVelocityIn = TotTurbPerfIn[n1*i+4];
-          kineIn           = 0.0;
-          kineIn           = TotTurbPerfIn[n1*i+5];
-          omegaIn          = 0.0;
-          omegaIn          = TotTurbPerfIn[n1*i+6];
-          nuIn             = 0.0;
-          nuIn             = TotTurbPerfIn[n1*i+7];
-
-          markerTP         = -1;
-          markerTP         = TotMarkerTP[i];
-        }
+  SU2_MPI::Gather(sendBuf.data(), nPack, MPI_DOUBLE, recvBuf.data(), nPack, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
 
-        if(TotTurbPerfOut[n2*i] > 0.0){
-          densityOut        = 0.0;
-          densityOut        = TotTurbPerfOut[n1*i];
-          pressureOut       = 0.0;
-          pressureOut       = TotTurbPerfOut[n1*i+1];
-          normalVelocityOut = 0.0;
-          normalVelocityOut = TotTurbPerfOut[n1*i+2];
-          tangVelocityOut   = 0.0;
-          tangVelocityOut   = TotTurbPerfOut[n1*i+3];
-          radialVelocityOut = 0.0;
-          radialVelocityOut = TotTurbPerfOut[n1*i+4];
-          kineOut           = 0.0;
-          kineOut           = TotTurbPerfOut[n1*i+5];
-          omegaOut          = 0.0;
-          omegaOut          = TotTurbPerfOut[n1*i+6];
-          nuOut             = 0.0;
-          nuOut             = TotTurbPerfOut[n1*i+7];
-        }
-      }
+  if (rank != MASTER_NODE) return;
 
-      delete [] TotTurbPerfIn, delete [] TotTurbPerfOut; delete [] TotMarkerTP;
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+
+    /*--- Values of the last rank that has each kind of marker. ---*/
+    su2double perfIn[N_VAL], perfOut[N_VAL];
+    for (iVal = 0; iVal < N_VAL; iVal++) {
+      perfIn[iVal]  = -1.0;
+      perfOut[iVal] = -1.0;
     }
+    markerTP = -1;
 
-#endif
+    for (iRank = 0; iRank < size; iRank++){
+      const su2double* buf = &recvBuf[iRank*nPack + iSpan*N_SPAN];
+
+      if (buf[0] > 0.0){
+        for (iVal = 0; iVal < N_VAL; iVal++) perfIn[iVal] = buf[iVal];
+        markerTP = SU2_TYPE::Int(recvBuf[iRank*nPack + nPack-1]);
+      }
+
+      if (buf[N_VAL] > 0.0){
+        for (iVal = 0; iVal < N_VAL; iVal++) perfOut[iVal] = buf[N_VAL+iVal];
+      }
+    }
 
-    if (rank == MASTER_NODE && markerTP > -1){
+    if (markerTP > -1){
       /*----Quantities needed for computing the turbomachinery performance -----*/
-      DensityIn[markerTP -1][iSpan]              = densityIn;
-      PressureIn[markerTP -1][iSpan]             = pressureIn;
-      TurboVelocityIn[markerTP -1][iSpan][0]     = normalVelocityIn;
-      TurboVelocityIn[markerTP -1][iSpan][1]     = tangVelocityIn;
+      DensityIn[markerTP -1][iSpan]              = perfIn[0];
+      PressureIn[markerTP -1][iSpan]             = perfIn[1];
+      TurboVelocityIn[markerTP -1][iSpan][0]     = perfIn[2];
+      TurboVelocityIn[markerTP -1][iSpan][1]     = perfIn[3];
       if (nDim == 3)
-        TurboVelocityIn[markerTP -1][iSpan][2]   = radialVelocityIn;
-      KineIn[markerTP -1][iSpan]                 = kineIn;
-      OmegaIn[markerTP -1][iSpan]                = omegaIn;
-      NuIn[markerTP -1][iSpan]                   = nuIn;
-
-      DensityOut[markerTP -1][iSpan]             = densityOut;
-      PressureOut[markerTP -1][iSpan]            = pressureOut;
-      TurboVelocityOut[markerTP -1][iSpan][0]    = normalVelocityOut;
-      TurboVelocityOut[markerTP -1][iSpan][1]    = tangVelocityOut;
+        TurboVelocityIn[markerTP -1][iSpan][2]   = perfIn[4];
+      KineIn[markerTP -1][iSpan]                 = perfIn[5];
+      OmegaIn[markerTP -1][iSpan]                = perfIn[6];
+      NuIn[markerTP -1][iSpan]                   = perfIn[7];
+
+      DensityOut[markerTP -1][iSpan]             = perfOut[0];
+      PressureOut[markerTP -1][iSpan]            = perfOut[1];
+      TurboVelocityOut[markerTP -1][iSpan][0]    = perfOut[2];
+      TurboVelocityOut[markerTP -1][iSpan][1]    = perfOut[3];
       if (nDim == 3)
-        TurboVelocityOut[markerTP -1][iSpan][2]  = radialVelocityOut;
-      KineOut[markerTP -1][iSpan]                = kineOut;
-      OmegaOut[markerTP -1][iSpan]               = omegaOut;
-      NuOut[markerTP -1][iSpan]                  = nuOut;
+        TurboVelocityOut[markerTP -1][iSpan][2]  = perfOut[4];
+      KineOut[markerTP -1][iSpan]                = perfOut[5];
+      OmegaOut[markerTP -1][iSpan]               = perfOut[6];
+      NuOut[markerTP -1][iSpan]                  = perfOut[7];
     }
   }
 }
@@ -387,7 +387,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   /*--- Determine the global number of DOFs. ---*/
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&nDOFsLocOwned, &nDOFsGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nDOFsLocOwned, &nDOFsGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 #else
   nDOFsGlobal = nDOFsLocOwned;
 #endif
@@ -420,8 +420,12 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   /*--- First the internal matching faces. ---*/
   unsigned long sizeVecResFaces = 0;
+  startLocResInternalFaces.resize(nMatchingInternalFacesWithHaloElem[nTimeLevels]+1);
   for(unsigned long i=0; i<nMatchingInternalFacesWithHaloElem[nTimeLevels]; ++i) {
 
+    /* Store the starting location of the residual of this face. */
+    startLocResInternalFaces[i] = sizeVecResFaces;
+
     /* Determine the time level of the face. */
     const unsigned long  elem0     = matchingInternalFaces[i].elemID0;
     const unsigned long  elem1     = matchingInternalFaces[i].elemID1;
@@ -488,6 +492,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       startLocResInternalFacesWithHaloElem[timeLevel+1] = sizeVecResFaces;
   }
 
+  startLocResInternalFaces[nMatchingInternalFacesWithHaloElem[nTimeLevels]] = sizeVecResFaces;
+
   /* Set the uninitialized values of startLocResInternalFacesLocalElem. */
   for(unsigned short i=1; i<=nTimeLevels; ++i) {
     if(startLocResInternalFacesLocalElem[i] == 0)
@@ -731,6 +737,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
   if(FluidModel    != NULL) delete FluidModel;
+  for(unsigned long i=0; i<FluidModelThreads.size(); ++i) delete FluidModelThreads[i];
   if(blasFunctions != NULL) delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -1068,6 +1075,13 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   }
 
+  /*--- Replace the fluid model by its tabulated version. ---*/
+
+  if (config->GetFluidTable()) {
+    FluidModel = new CLookUpTableFluid(FluidModel, config, Density_FreeStreamND, Temperature_FreeStreamND);
+    FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+  }
+
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (viscous) {
@@ -1089,6 +1103,48 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   }
 
+  /*--- The fluid model stores the thermodynamic state, hence every OpenMP thread
+        that carries out the task list needs its own copy. The master thread uses
+        FluidModel, the other threads the copies created here. ---*/
+  for(unsigned long i=0; i<FluidModelThreads.size(); ++i) delete FluidModelThreads[i];
+  FluidModelThreads.assign(omp_get_max_threads()-1, NULL);
+
+  for(unsigned long i=0; i<FluidModelThreads.size(); ++i) {
+
+    switch (config->GetKind_FluidModel()) {
+
+      case STANDARD_AIR:
+        FluidModelThreads[i] = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
+
+      case IDEAL_GAS:
+        FluidModelThreads[i] = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
+
+      case VW_GAS:
+        FluidModelThreads[i] = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                   config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
+
+      case PR_GAS:
+        FluidModelThreads[i] = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                 config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
+
+    }
+
+    /*--- The tables of the master thread are reused. ---*/
+    if (config->GetFluidTable())
+      FluidModelThreads[i] = new CLookUpTableFluid(FluidModelThreads[i], config, Density_FreeStreamND, Temperature_FreeStreamND);
+
+    FluidModelThreads[i]->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+
+    if (viscous) {
+      FluidModelThreads[i]->SetLaminarViscosityModel(config);
+      FluidModelThreads[i]->SetThermalConductivityModel(config);
+    }
+  }
+
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
   Energy_Ref = Energy_FreeStream/Energy_FreeStreamND; config->SetEnergy_Ref(Energy_Ref);
@@ -1315,7 +1371,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
 
 #ifdef HAVE_MPI
   SU2_MPI::Allgather(&nDOFsLocOwned, 1, MPI_UNSIGNED_LONG, &nDOFsPerRank[1], 1,
-                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+                     MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 #else
   nDOFsPerRank[1] = nDOFsLocOwned;
 #endif
@@ -1366,7 +1422,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
     /* Send the data using non-blocking sends to avoid deadlock. */
     int dest = ranksSend[i];
     SU2_MPI::Isend(sendBuf[i].data(), sendBuf[i].size(), MPI_UNSIGNED_LONG,
-                   dest, dest, MPI_COMM_WORLD, &sendReqs[i]);
+                   dest, dest, SU2_MPI::GetComm(), &sendReqs[i]);
   }
 
   /* Create a map of the receive rank to the index in ranksRecv. */
@@ -1380,7 +1436,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
     /* Block until a message arrives and determine the source and size
        of the message. */
     SU2_MPI::Status status;
-    SU2_MPI::Probe(MPI_ANY_SOURCE, rank, MPI_COMM_WORLD, &status);
+    SU2_MPI::Probe(MPI_ANY_SOURCE, rank, SU2_MPI::GetComm(), &status);
     int source = status.MPI_SOURCE;
 
     int sizeMess;
@@ -1390,7 +1446,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
        and determine the actual index of this rank in ranksRecv. */
     vector<unsigned long> recvBuf(sizeMess);
     SU2_MPI::Recv(recvBuf.data(), sizeMess, MPI_UNSIGNED_LONG,
-                  source, rank, MPI_COMM_WORLD, &status);
+                  source, rank, SU2_MPI::GetComm(), &status);
 
     map<int,int>::const_iterator MI = rankToIndRecvBuf.find(source);
     source = MI->second;
@@ -1412,7 +1468,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
 
   /* Wild cards have been used in the communication,
      so synchronize the ranks to avoid problems.    */
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #else
 
@@ -1520,7 +1576,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
     /* Send the data using non-blocking sends to avoid deadlock. */
     int dest = ranksRecv[i];
     SU2_MPI::Isend(invSendBuf[i].data(), invSendBuf[i].size(), MPI_UNSIGNED_LONG,
-                   dest, dest+1, MPI_COMM_WORLD, &invSendReqs[i]);
+                   dest, dest+1, SU2_MPI::GetComm(), &invSendReqs[i]);
   }
 
   /* Create a map of the inverse receive (i.e. the original send) rank
@@ -1536,7 +1592,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
     /* Block until a message arrives and determine the source and size
        of the message. */
     SU2_MPI::Status status;
-    SU2_MPI::Probe(MPI_ANY_SOURCE, rank+1, MPI_COMM_WORLD, &status);
+    SU2_MPI::Probe(MPI_ANY_SOURCE, rank+1, SU2_MPI::GetComm(), &status);
     int source = status.MPI_SOURCE;
 
     int sizeMess;
@@ -1546,7 +1602,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
        and determine the actual index of this rank in ranksSend. */
     vector<unsigned long> recvBuf(sizeMess);
     SU2_MPI::Recv(recvBuf.data(), sizeMess, MPI_UNSIGNED_LONG,
-                  source, rank+1, MPI_COMM_WORLD, &status);
+                  source, rank+1, SU2_MPI::GetComm(), &status);
 
     map<int,int>::const_iterator MI = rankToIndSendBuf.find(source);
     source = MI->second;
@@ -1573,7 +1629,7 @@ void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
 
   /* Wild cards have been used in the communication,
      so synchronize the ranks to avoid problems.    */
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #else
   /*--- Sequential implementation. Just add the data of the halo DOFs
@@ -1715,7 +1771,7 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
     const int ind  = MI->second;
 
     SU2_MPI::Isend(sendBuf[ind].data(), sendBuf[ind].size(), MPI_UNSIGNED_LONG,
-                   dest, dest+2, MPI_COMM_WORLD, &sendReqs[i]);
+                   dest, dest+2, SU2_MPI::GetComm(), &sendReqs[i]);
   }
 
   /* Loop over the ranks from which I receive data to be processed. The number
@@ -1727,7 +1783,7 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
     /* Block until a message arrives and determine the source and size
        of the message. */
     SU2_MPI::Status status;
-    SU2_MPI::Probe(MPI_ANY_SOURCE, rank+2, MPI_COMM_WORLD, &status);
+    SU2_MPI::Probe(MPI_ANY_SOURCE, rank+2, SU2_MPI::GetComm(), &status);
     int source = status.MPI_SOURCE;
 
     int sizeMess;
@@ -1739,7 +1795,7 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
     sendReturnBuf[i].resize(sizeMess);
 
     SU2_MPI::Recv(recvBuf.data(), sizeMess, MPI_UNSIGNED_LONG,
-                  source, rank+2, MPI_COMM_WORLD, &status);
+                  source, rank+2, SU2_MPI::GetComm(), &status);
 
     /* Loop over the data just received and fill the return send buffer
        with the color of the DOFs. */
@@ -1755,7 +1811,7 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
     /* Send the return buffer back to the calling rank. Again use non-blocking
        sends to avoid deadlock. */
     SU2_MPI::Isend(sendReturnBuf[i].data(), sendReturnBuf[i].size(), MPI_INT,
-                   source, source+3, MPI_COMM_WORLD, &sendReturnReqs[i]);
+                   source, source+3, SU2_MPI::GetComm(), &sendReturnReqs[i]);
   }
 
   /* Complete the first round of non-blocking sends. */
@@ -1767,7 +1823,7 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
     /* Block until a message arrives and determine the source of the message
        and its index in the original send buffers. */
     SU2_MPI::Status status;
-    SU2_MPI::Probe(MPI_ANY_SOURCE, rank+3, MPI_COMM_WORLD, &status);
+    SU2_MPI::Probe(MPI_ANY_SOURCE, rank+3, SU2_MPI::GetComm(), &status);
     int source = status.MPI_SOURCE;
 
     MI = rankCommToInd.find(source);
@@ -1777,7 +1833,7 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
        a blocking receive. */
     vector<int> recvBuf(sendBuf[ind].size());
     SU2_MPI::Recv(recvBuf.data(), recvBuf.size(), MPI_INT,
-                  source, rank+3, MPI_COMM_WORLD, &status);
+                  source, rank+3, SU2_MPI::GetComm(), &status);
 
     /* Loop over the data just received and add them to the map
        mapMatrixIndToColor .*/
@@ -1790,7 +1846,7 @@ void CFEM_DG_EulerSolver::MetaDataJacobianComputation(const CMeshFEM    *FEMGeom
 
   /* Wild cards have been used in the communication,
      so synchronize the ranks to avoid problems.    */
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
 
 #endif
 
@@ -2430,7 +2486,7 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
       }
 
 #ifdef HAVE_MPI
-      SU2_MPI::Barrier(MPI_COMM_WORLD);
+      SU2_MPI::Barrier(SU2_MPI::GetComm());
 #endif
     }
 
@@ -2747,7 +2803,7 @@ void CFEM_DG_EulerSolver::Initiate_MPI_Communication(CConfig *config,
       /* Send the data using non-blocking sends. */
       int dest = ranksSendMPI[timeLevel][i];
       int tag  = dest + timeLevel;
-      SU2_MPI::Isend(sendBuf, ii, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD,
+      SU2_MPI::Isend(sendBuf, ii, MPI_DOUBLE, dest, tag, SU2_MPI::GetComm(),
                      &commRequests[timeLevel][indComm]);
     }
 
@@ -2759,7 +2815,7 @@ void CFEM_DG_EulerSolver::Initiate_MPI_Communication(CConfig *config,
       int tag    = rank + timeLevel;
       SU2_MPI::Irecv(commRecvBuf[timeLevel][i].data(),
                      commRecvBuf[timeLevel][i].size(),
-                     MPI_DOUBLE, source, tag, MPI_COMM_WORLD,
+                     MPI_DOUBLE, source, tag, SU2_MPI::GetComm(),
                      &commRequests[timeLevel][indComm]);
     }
   }
@@ -2992,7 +3048,7 @@ void CFEM_DG_EulerSolver::Initiate_MPI_ReverseCommunication(CConfig *config,
       /* Send the data using non-blocking sends. */
       int dest = ranksRecvMPI[timeLevel][i];
       int tag  = dest + timeLevel + 20;
-      SU2_MPI::Isend(recvBuf, ii, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD,
+      SU2_MPI::Isend(recvBuf, ii, MPI_DOUBLE, dest, tag, SU2_MPI::GetComm(),
                      &commRequests[timeLevel][indComm]);
     }
 
@@ -3004,7 +3060,7 @@ void CFEM_DG_EulerSolver::Initiate_MPI_ReverseCommunication(CConfig *config,
       int tag    = rank + timeLevel + 20;
       SU2_MPI::Irecv(commSendBuf[timeLevel][i].data(),
                      commSendBuf[timeLevel][i].size(),
-                     MPI_DOUBLE, source, tag, MPI_COMM_WORLD,
+                     MPI_DOUBLE, source, tag, SU2_MPI::GetComm(),
                      &commRequests[timeLevel][indComm]);
     }
   }
@@ -3155,9 +3211,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3181,9 +3237,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3202,7 +3258,7 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
     if (config->GetComm_Level() == COMM_FULL) {
 #ifdef HAVE_MPI
       unsigned long MyErrorCounter = ErrorCounter;
-      SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 #endif
       if (iMesh == MESH_0) config->SetNonphysical_Points(ErrorCounter);
     }
@@ -3639,8 +3695,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3671,8 +3727,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3720,10 +3776,10 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
     if ((config->GetComm_Level() == COMM_FULL) || time_stepping) {
 #ifdef HAVE_MPI
       su2double rbuf_time = Min_Delta_Time;
-      SU2_MPI::Allreduce(&rbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&rbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
 
       rbuf_time = Max_Delta_Time;
-      SU2_MPI::Allreduce(&rbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&rbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 #endif
     }
 
@@ -3784,309 +3840,435 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
   /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
+     not the tasks from the list have been completed. This vector is
+     only accessed by the master thread. */
   vector<bool> taskCompleted(tasksList.size(), false);
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
-
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
+  /*--- The tasks that work on a range of elements or faces are split in
+        chunks, which are distributed dynamically over the threads. The
+        other tasks, including all the MPI communication, are carried out
+        by the master thread. The chunk size is a multiple of the number
+        of entities that are treated simultaneously in the gemm calls. The
+        timers of the gemm calls in a profile build are not thread safe. ---*/
+#ifdef PROFILE
+  const int nThreads = 1;
+#else
+  const int nThreads = omp_get_max_threads();
+#endif
+  const unsigned long nChunksTarget = (nThreads > 1) ? 4*nThreads : 1;
+  const unsigned long nEntitySimul  = max(1, config->GetSizeMatMulPadding()/nVar);
+
+  /* The Riemann solvers that are not implemented in this class use the shared
+     numerics object. In that case the faces are not split over the threads. */
+  const bool splitFaces = (config->GetRiemann_Solver_FEM() == ROE) ||
+                          (config->GetRiemann_Solver_FEM() == LAX_FRIEDRICH);
+
+  /* Variables shared by the threads, which are set by the master thread. */
+  unsigned long lowestIndexInList = 0, indTask = 0, indBeg = 0, indEnd = 0;
+  unsigned long chunkSize = 1, nChunks = 0;
+  bool listCompleted = false;
+
+  SU2_OMP_PARALLEL_ON(nThreads)
+  {
+    /* Allocate the memory for the work array of this thread and initialize it to
+       zero to avoid warnings in debug mode about uninitialized memory when
+       padding is applied. */
+    vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+    su2double *workArray = workArrayVec.data();
+
+    /* While loop to carry out all the tasks in tasksList. */
+    while( true ) {
+
+      SU2_OMP_MASTER
+      {
+        /* The task that was split over the threads has been completed. */
+        if( nChunks ) {
+          taskCompleted[indTask] = true;
+          nChunks = 0;
         }
 
-        if( taskCanBeCarriedOut ) {
+        /* Carry out the tasks that are not split, until a task that can be
+           split is found or until the entire list has been processed. */
+        while( !(listCompleted || nChunks) ) {
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+          /* Update the value of lowestIndexInList. */
+          for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+            if( !taskCompleted[lowestIndexInList] ) break;
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+          if(lowestIndexInList == tasksList.size()) {
+            listCompleted = true;
+            break;
+          }
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+          /* Find the next task that can be carried out. The outer loop is there
+             to make sure that a communication is completed in case there are no
+             other tasks */
+          for(unsigned short j=0; j<2; ++j) {
+            bool taskCarriedOut = false;
+            for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+
+              /* Determine whether or not it can be attempted to carry out
+                 this task. */
+              bool taskCanBeCarriedOut = !taskCompleted[i];
+              for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+                if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
+                  taskCanBeCarriedOut = false;
+              }
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+              if( taskCanBeCarriedOut ) {
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+                /*--- Check whether this task works on a range, which can be split
+                      in chunks. In that case the chunks are carried out by all
+                      threads after this section. ---*/
+                if( TaskRange_DG(tasksList[i], indBeg, indEnd) ) {
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                  const bool faceTask = (tasksList[i].task == CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS) ||
+                                        (tasksList[i].task == CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS);
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+                  indTask   = i;
+                  chunkSize = indEnd - indBeg;
+                  if(!faceTask || splitFaces) {
+                    chunkSize = roundUpDiv(chunkSize, nChunksTarget);
+                    chunkSize = nEntitySimul*roundUpDiv(chunkSize, nEntitySimul);
+                  }
+                  nChunks = roundUpDiv(indEnd - indBeg, max(chunkSize, 1ul));
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                  /* An empty range is completed right away. */
+                  if( !nChunks ) taskCompleted[i] = true;
+                  taskCarriedOut = true;
+                  break;
+                }
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                /*--- Determine the actual task to be carried out and do so. The
+                      only tasks that may fail are the completion of the non-blocking
+                      communication. If that is the case the next task needs to be
+                      found. ---*/
+                switch( tasksList[i].task ) {
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+                  case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                    /* Start the MPI communication of the solution in the halo elements. */
+                    Initiate_MPI_Communication(config, tasksList[i].timeLevel);
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                  case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
+
+                    /* Attempt to complete the MPI communication of the solution data.
+                       For j==0, SU2_MPI::Testall will be used, which returns false if
+                       not all requests can be completed. In that case the next task on
+                       the list is carried out. If j==1, this means that the next
+                       tasks are waiting for this communication to be completed and
+                       hence MPI_Waitall is used. */
+                    if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
+                                                   j==1) )
+                      taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+                  case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+                    /* Start the communication of the residuals, for which the
+                       reverse communication must be used. */
+                    Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+                  case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
+
+                    /* Attempt to complete the MPI communication of the residual data.
+                       For j==0, SU2_MPI::Testall will be used, which returns false if
+                       not all requests can be completed. In that case the next task on
+                       the list is carried out. If j==1, this means that the next
+                       tasks are waiting for this communication to be completed and
+                       hence MPI_Waitall is used. */
+                    if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
+                                                          j==1) )
+                      taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+
+                    /* Interpolate the predictor solution of the owned elements
+                       in time to the given time integration point for the
+                       given time level. */
+                    const unsigned short level = tasksList[i].timeLevel;
+                    unsigned long nAdjElem = 0, *adjElem = NULL;
+                    if(level < (nTimeLevels-1)) {
+                      nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+                      adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+                    }
+
+                    ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
+                                                        nVolElemOwnedPerTimeLevel[level],
+                                                        nVolElemOwnedPerTimeLevel[level+1],
+                                                        nAdjElem, adjElem,
+                                                        tasksList[i].secondPartTimeIntADER,
+                                                        VecWorkSolDOFs[level].data());
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+
+                    /* Interpolate the predictor solution of the halo elements
+                       in time to the given time integration point for the
+                       given time level. */
+                    const unsigned short level = tasksList[i].timeLevel;
+                    unsigned long nAdjElem = 0, *adjElem = NULL;
+                    if(level < (nTimeLevels-1)) {
+                      nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+                      adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+                    }
+
+                    ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
+                                                        nVolElemHaloPerTimeLevel[level],
+                                                        nVolElemHaloPerTimeLevel[level+1],
+                                                        nAdjElem, adjElem,
+                                                        tasksList[i].secondPartTimeIntADER,
+                                                        VecWorkSolDOFs[level].data());
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+
+                    /*--- Apply the boundary conditions that only depend on data
+                          of owned elements. ---*/
+                    Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
+                                        workArray);
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+
+                    /*--- Apply the boundary conditions that also depend on data
+                          of halo elements. ---*/
+                    Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
+                                        workArray);
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+
+                    /* Create the final residual by summing up all contributions. */
+                    CreateFinalResidual(tasksList[i].timeLevel, true);
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+                    /* Create the final residual by summing up all contributions. */
+                    CreateFinalResidual(tasksList[i].timeLevel, false);
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+
+                    /* Accumulate the space time residuals for the owned elements
+                       for ADER-DG. */
+                    AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
+                                                             tasksList[i].intPointADER);
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+                    /* Accumulate the space time residuals for the halo elements
+                       for ADER-DG. */
+                    AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
+                                                            tasksList[i].intPointADER);
+                    taskCarriedOut = taskCompleted[i] = true;
+                    break;
+                  }
+
+                  default: {
+
+                    cout << "Task not defined. This should not happen." << endl;
+                    exit(1);
+                  }
+                }
               }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
+              /* Break the inner loop if a task has been carried out. */
+              if( taskCarriedOut ) break;
             }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+            /* Break the outer loop if a task has been carried out. */
+            if( taskCarriedOut ) break;
+          }
+        }
+      }
+      SU2_OMP_BARRIER
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Terminate the loop if all tasks have been carried out. */
+      if( listCompleted ) break;
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+      /*--- Carry out the chunks of the task that has been split. In between
+            its chunks the master thread tests the outstanding communication,
+            such that the MPI library makes progress. ---*/
+      SU2_OMP_FOR_DYN(1)
+      for(unsigned long iChunk=0; iChunk<nChunks; ++iChunk) {
+        const unsigned long chunkBeg = indBeg + iChunk*chunkSize;
+        const unsigned long chunkEnd = min(chunkBeg+chunkSize, indEnd);
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        ProcessTaskChunk_DG(config, numerics, tasksList[indTask], chunkBeg, chunkEnd, workArray);
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+        if(omp_get_thread_num() == 0)
+          Progress_MPI_Communication(taskCompleted, lowestIndexInList);
+      }
+    }
+  }
+}
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+void CFEM_DG_EulerSolver::Progress_MPI_Communication(const vector<bool>  &taskCompleted,
+                                                     const unsigned long lowestIndexInList) {
+#ifdef HAVE_MPI
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+  /* Loop over the tasks that have not been completed yet and test the
+     requests of the communication tasks, whose communication has started. */
+  for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+    if( taskCompleted[i] ) continue;
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    if((tasksList[i].task != CTaskDefinition::COMPLETE_MPI_COMMUNICATION) &&
+       (tasksList[i].task != CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION)) continue;
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+    /* The communication has been started if the tasks on which the completion
+       depends, which include the initialization, have been completed. */
+    bool commStarted = true;
+    for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+      if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
+        commStarted = false;
+    }
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    /* Test the requests. The completed requests are set to MPI_REQUEST_NULL,
+       such that the completion in the task itself only copies the data. */
+    const unsigned short level = tasksList[i].timeLevel;
+    if(commStarted && commRequests[level].size()) {
+      int flag;
+      SU2_MPI::Testall(commRequests[level].size(), commRequests[level].data(),
+                       &flag, MPI_STATUSES_IGNORE);
+    }
+  }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+#endif
+}
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+bool CFEM_DG_EulerSolver::TaskRange_DG(const CTaskDefinition &task,
+                                       unsigned long         &indBeg,
+                                       unsigned long         &indEnd) const {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+  const unsigned short level = task.timeLevel;
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  switch( task.task ) {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+      indBeg = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+      indEnd = nVolElemOwnedPerTimeLevel[level+1];
+      return true;
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS:
+      indBeg = nVolElemOwnedPerTimeLevel[level];
+      indEnd = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+      return true;
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS:
+      indBeg = nVolElemHaloPerTimeLevel[level];
+      indEnd = nVolElemHaloPerTimeLevel[level+1];
+      return true;
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+    case CTaskDefinition::VOLUME_RESIDUAL:
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX:
+    case CTaskDefinition::ADER_UPDATE_SOLUTION:
+      indBeg = nVolElemOwnedPerTimeLevel[level];
+      indEnd = nVolElemOwnedPerTimeLevel[level+1];
+      return true;
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+      indBeg = nMatchingInternalFacesLocalElem[level];
+      indEnd = nMatchingInternalFacesLocalElem[level+1];
+      return true;
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS:
+      indBeg = nMatchingInternalFacesWithHaloElem[level];
+      indEnd = nMatchingInternalFacesWithHaloElem[level+1];
+      return true;
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+    default:
+      return false;
+  }
+}
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+void CFEM_DG_EulerSolver::ProcessTaskChunk_DG(CConfig               *config,
+                                              CNumerics             **numerics,
+                                              const CTaskDefinition &task,
+                                              const unsigned long   indBeg,
+                                              const unsigned long   indEnd,
+                                              su2double             *workArray) {
+  switch( task.task ) {
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the ADER predictor step for this range of elements. */
+      ADER_DG_PredictorStep(config, indBeg, indEnd, workArray);
+      break;
+    }
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      Shock_Capturing_DG(config, indBeg, indEnd, workArray);
+      break;
+    }
 
-            default: {
+    case CTaskDefinition::VOLUME_RESIDUAL: {
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
-        }
+      /*--- Compute the volume portion of the residual. ---*/
+      Volume_Residual(config, indBeg, indEnd, workArray);
+      break;
+    }
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
-      }
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Compute the residual of this range of faces. The location in the
+         residual of the faces follows from the first face of the range. */
+      unsigned long indResFaces = startLocResInternalFaces[indBeg];
+      ResidualFaces(config, indBeg, indEnd, indResFaces, numerics[CONV_TERM], workArray);
+      break;
+    }
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+
+      /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+      const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+      MultiplyResidualByInverseMassMatrix(config, useADER, indBeg, indEnd, workArray);
+      break;
     }
 
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+
+      /*--- Perform the update step for ADER-DG. ---*/
+      ADER_DG_Iteration(indBeg, indEnd);
+      break;
+    }
+
+    default: {
+
+      cout << "Task cannot be split in chunks. This should not happen." << endl;
+      exit(1);
+    }
   }
 }
 
@@ -4141,7 +4323,7 @@ void CFEM_DG_EulerSolver::TolerancesADERPredictorStep(void) {
 
 #ifdef HAVE_MPI
   SU2_MPI::Allreduce(URef, TolSolADER.data(), nVar, MPI_DOUBLE, MPI_MAX,
-                     MPI_COMM_WORLD);
+                     SU2_MPI::GetComm());
 #else
   for(unsigned short i=0; i<nVar; ++i) TolSolADER[i] = URef[i];
 #endif
@@ -4743,8 +4925,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4992,8 +5174,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5282,8 +5464,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5497,8 +5679,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5882,8 +6064,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5977,8 +6159,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6886,8 +7068,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config)
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -6939,8 +7121,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config)
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7063,7 +7245,7 @@ void CFEM_DG_EulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config)
   /* Sum up all the data from all ranks. The result will be available on all ranks. */
   if (config->GetComm_Level() == COMM_FULL) {
     SU2_MPI::Allreduce(locBuf.data(), globBuf.data(), nCommSize, MPI_DOUBLE,
-                       MPI_SUM, MPI_COMM_WORLD);
+                       MPI_SUM, SU2_MPI::GetComm());
   }
 
   /*--- Copy the data back from globBuf into the required variables. ---*/
@@ -7261,7 +7443,7 @@ void CFEM_DG_EulerSolver::SetResidual_RMS_FEM(CGeometry *geometry,
     /*--- The local L2 norms must be added to obtain the
           global value. Also check for divergence. ---*/
     vector<su2double> rbufRes(nVar);
-    SU2_MPI::Allreduce(Residual_RMS, rbufRes.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Residual_RMS, rbufRes.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
     for(unsigned short iVar=0; iVar<nVar; ++iVar) {
       if (rbufRes[iVar] != rbufRes[iVar])
@@ -7273,11 +7455,11 @@ void CFEM_DG_EulerSolver::SetResidual_RMS_FEM(CGeometry *geometry,
     /*--- The global maximum norms must be obtained. ---*/
     rbufRes.resize(nVar*size);
     SU2_MPI::Allgather(Residual_Max, nVar, MPI_DOUBLE, rbufRes.data(),
-                       nVar, MPI_DOUBLE, MPI_COMM_WORLD);
+                       nVar, MPI_DOUBLE, SU2_MPI::GetComm());
 
     vector<unsigned long> rbufPoint(nVar*size);
     SU2_MPI::Allgather(Point_Max, nVar, MPI_UNSIGNED_LONG, rbufPoint.data(),
-                       nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+                       nVar, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
     vector<su2double> sbufCoor(nDim*nVar);
     for(unsigned short iVar=0; iVar<nVar; ++iVar) {
@@ -7287,7 +7469,7 @@ void CFEM_DG_EulerSolver::SetResidual_RMS_FEM(CGeometry *geometry,
 
     vector<su2double> rbufCoor(nDim*nVar*size);
     SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_DOUBLE, rbufCoor.data(),
-                       nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+                       nVar*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
 
     for(unsigned short iVar=0; iVar<nVar; ++iVar) {
       for(int proc=0; proc<size; ++proc)
@@ -7554,9 +7736,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7662,9 +7844,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7726,10 +7908,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7756,9 +7938,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7788,10 +7970,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7839,10 +8021,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7936,7 +8118,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -7951,7 +8133,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8002,11 +8184,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8081,11 +8263,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9454,7 +9636,7 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
 #ifdef HAVE_MPI
   unsigned short sbuf_NotMatching = rbuf_NotMatching;
-  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_MAX, SU2_MPI::GetComm());
 #endif
 
   if (rbuf_NotMatching != 0)
@@ -9480,9 +9662,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
@@ -9499,7 +9681,7 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
   if (config->GetComm_Level() == COMM_FULL) {
 #ifdef HAVE_MPI
     unsigned long nBadDOFsLoc = nBadDOFs;
-    SU2_MPI::Reduce(&nBadDOFsLoc, &nBadDOFs, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&nBadDOFsLoc, &nBadDOFs, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 #endif
 
     if((rank == MASTER_NODE) && (nBadDOFs != 0))
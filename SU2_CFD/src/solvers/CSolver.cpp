@@ -43,6 +43,7 @@
 #include "../../../Common/include/toolboxes/MMS/CTGVSolution.hpp"
 #include "../../../Common/include/toolboxes/MMS/CUserDefinedSolution.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CReductionAccumulator.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
 
@@ -391,15 +392,17 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
    we find a larger count per point than currently exists. After the
    first cycle of comms, this should be inactive. ---*/
 
-  if (COUNT_PER_POINT > geometry->countPerPeriodicPoint) {
+  auto& buf = geometry->GetCommBuffers();
+
+  if (COUNT_PER_POINT > buf.countPerPeriodicPoint) {
     geometry->AllocatePeriodicComms(COUNT_PER_POINT);
   }
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  su2double *bufDSend = geometry->bufD_PeriodicSend;
+  su2double *bufDSend = buf.bufD_PeriodicSend;
 
-  unsigned short *bufSSend = geometry->bufS_PeriodicSend;
+  unsigned short *bufSSend = buf.bufS_PeriodicSend;
 
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
@@ -466,7 +469,7 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
 
         /*--- Compute the offset in the recv buffer for this point. ---*/
 
-        buf_offset = (msg_offset + iSend)*geometry->countPerPeriodicPoint;
+        buf_offset = (msg_offset + iSend)*buf.countPerPeriodicPoint;
 
         /*--- Load the send buffers depending on the particular value
          that has been requested for communication. ---*/
@@ -1539,9 +1542,11 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  su2double *bufDRecv = geometry->bufD_PeriodicRecv;
+  auto& buf = geometry->GetCommBuffers();
+
+  su2double *bufDRecv = buf.bufD_PeriodicRecv;
 
-  unsigned short *bufSRecv = geometry->bufS_PeriodicRecv;
+  unsigned short *bufSRecv = buf.bufS_PeriodicRecv;
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
@@ -1557,7 +1562,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
       /*--- Once we have recv'd a message, get the source rank. ---*/
       int ind;
       SU2_MPI::Waitany(geometry->nPeriodicRecv,
-                       geometry->req_PeriodicRecv,
+                       buf.req_PeriodicRecv.data(),
                        &ind, &status);
       source = status.MPI_SOURCE;
 #else
@@ -1595,7 +1600,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 
           /*--- Compute the offset in the recv buffer for this point. ---*/
 
-          buf_offset = (msg_offset + iRecv)*geometry->countPerPeriodicPoint;
+          buf_offset = (msg_offset + iRecv)*buf.countPerPeriodicPoint;
 
           /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -1891,7 +1896,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 
 #ifdef HAVE_MPI
     SU2_MPI::Waitall(geometry->nPeriodicSend,
-                     geometry->req_PeriodicSend,
+                     buf.req_PeriodicSend.data(),
                      MPI_STATUS_IGNORE);
 #endif
 
@@ -1996,13 +2001,15 @@ void CSolver::InitiateComms(CGeometry *geometry,
    buffer. It will be reallocated whenever we find a larger count
    per point. After the first cycle of comms, this should be inactive. ---*/
 
-  if (COUNT_PER_POINT > geometry->countPerPoint) {
+  auto& buf = geometry->GetCommBuffers();
+
+  if (COUNT_PER_POINT > buf.countPerPoint) {
     geometry->AllocateP2PComms(COUNT_PER_POINT);
   }
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  su2double *bufDSend = geometry->bufD_P2PSend;
+  su2double *bufDSend = buf.bufD_P2PSend;
 
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
@@ -2032,29 +2039,25 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
         /*--- Compute the offset in the recv buffer for this point. ---*/
 
-        buf_offset = (msg_offset + iSend)*geometry->countPerPoint;
+        buf_offset = (msg_offset + iSend)*buf.countPerPoint;
 
         switch (commType) {
+          /*--- The rows of the containers are contiguous, they are copied as a block. ---*/
           case SOLUTION:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
+            copy_n(base_nodes->GetSolution(iPoint), nVar, &bufDSend[buf_offset]);
             break;
           case SOLUTION_OLD:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution_Old(iPoint, iVar);
+            copy_n(base_nodes->GetSolution_Old(iPoint), nVar, &bufDSend[buf_offset]);
             break;
           case SOLUTION_EDDY:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
+            copy_n(base_nodes->GetSolution(iPoint), nVar, &bufDSend[buf_offset]);
             bufDSend[buf_offset+nVar]   = base_nodes->GetmuT(iPoint);
             break;
           case UNDIVIDED_LAPLACIAN:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetUndivided_Laplacian(iPoint, iVar);
+            copy_n(base_nodes->GetUndivided_Laplacian(iPoint), nVar, &bufDSend[buf_offset]);
             break;
           case SOLUTION_LIMITER:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetLimiter(iPoint, iVar);
+            copy_n(base_nodes->GetLimiter(iPoint), nVar, &bufDSend[buf_offset]);
             break;
           case MAX_EIGENVALUE:
             bufDSend[buf_offset] = base_nodes->GetLambda(iPoint);
@@ -2158,7 +2161,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  su2double *bufDRecv = geometry->bufD_P2PRecv;
+  auto& buf = geometry->GetCommBuffers();
+
+  su2double *bufDRecv = buf.bufD_P2PRecv;
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
@@ -2170,9 +2175,13 @@ void CSolver::CompleteComms(CGeometry *geometry,
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
 
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv,
+      SU2_MPI::Waitany(geometry->nP2PRecv, buf.req_P2PRecv.data(),
                        &ind, &status);
 
+      /*--- Data of node-local neighbors arrives through shared memory. ---*/
+
+      geometry->SyncSharedP2PRecv(COMM_TYPE_DOUBLE, false);
+
       /*--- Once we have recv'd a message, get the source rank. ---*/
 
       source = status.MPI_SOURCE;
@@ -2198,31 +2207,26 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
         /*--- Compute the offset in the recv buffer for this point. ---*/
 
-        buf_offset = (msg_offset + iRecv)*geometry->countPerPoint;
+        buf_offset = (msg_offset + iRecv)*buf.countPerPoint;
 
         /*--- Store the data correctly depending on the quantity. ---*/
 
         switch (commType) {
           case SOLUTION:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+            copy_n(&bufDRecv[buf_offset], nVar, base_nodes->GetSolution(iPoint));
             break;
           case SOLUTION_OLD:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution_Old(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+            copy_n(&bufDRecv[buf_offset], nVar, base_nodes->GetSolution_Old(iPoint));
             break;
           case SOLUTION_EDDY:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+            copy_n(&bufDRecv[buf_offset], nVar, base_nodes->GetSolution(iPoint));
             base_nodes->SetmuT(iPoint,bufDRecv[buf_offset+nVar]);
             break;
           case UNDIVIDED_LAPLACIAN:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetUndivided_Laplacian(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+            copy_n(&bufDRecv[buf_offset], nVar, base_nodes->GetUndivided_Laplacian(iPoint));
             break;
           case SOLUTION_LIMITER:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetLimiter(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+            copy_n(&bufDRecv[buf_offset], nVar, base_nodes->GetLimiter(iPoint));
             break;
           case MAX_EIGENVALUE:
             base_nodes->SetLambda(iPoint,bufDRecv[buf_offset]);
@@ -2310,7 +2314,7 @@ void CSolver::CompleteComms(CGeometry *geometry,
      data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
+    SU2_MPI::Waitall(geometry->nP2PSend, buf.req_P2PSend.data(), MPI_STATUS_IGNORE);
 #endif
 
   }
@@ -2324,6 +2328,164 @@ void CSolver::ResetCFLAdapt(){
   Old_Func = 0;
   New_Func = 0;
   NonLinRes_Counter = 0;
+  CFLCheckpoint_Res = 0.0;
+  CFLAdapt_Iter = 0;
+}
+
+void CSolver::UpdateJacobianLag(CConfig *config) {
+
+  const unsigned long MaxLag = config->GetJacobian_Lag_Iter();
+  if ((MaxLag == 0) || config->GetDiscrete_Adjoint()) return;
+
+  const su2double GrowthFactor = config->GetJacobian_LagParam(0);
+  const su2double ResidualRatio = config->GetJacobian_LagParam(1);
+
+  /*--- Nonlinear residual indicator, sum of the RMS residuals of all equations. ---*/
+
+  su2double Res = 0.0;
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) Res += GetRes_RMS(iVar);
+
+  /*--- The first solve with a new Jacobian is the reference for the following ones. ---*/
+
+  if (Jacobian.GetFrozen()) {
+    JacobianLag_nSkipped++;
+  } else {
+    JacobianLag_nAssembled++;
+    JacobianLag_RefIter = IterLinSolver;
+    JacobianLag_RefRes = ResLinSolver;
+  }
+
+  /*--- Refresh if the linear solver needs more iterations (or, when it stops at the iteration limit,
+   reaches a higher residual) than with the fresh Jacobian, or if the nonlinear residual grows. ---*/
+
+  const bool linearDegraded = (IterLinSolver > GrowthFactor*max(JacobianLag_RefIter, 1ul)) ||
+                              ((ResLinSolver > config->GetLinear_Solver_Error()) &&
+                               (ResLinSolver > GrowthFactor*JacobianLag_RefRes));
+
+  const bool nonlinearDegraded = ((JacobianLag_Res > 0.0) && (Res > ResidualRatio*JacobianLag_Res)) || (Res != Res);
+
+  JacobianLag_Res = Res;
+
+  const bool lag = (JacobianLag_Age < MaxLag) && !linearDegraded && !nonlinearDegraded;
+
+  JacobianLag_Age = lag? JacobianLag_Age+1 : 0;
+  Jacobian.SetFrozen(lag);
+
+}
+
+su2double CSolver::CFLFeedbackFactor(CGeometry *geometry,
+                                     CSolver   **solver_container,
+                                     CConfig   *config,
+                                     bool      &restart) {
+
+  const su2double CFLFactorDecrease = config->GetCFL_AdaptParam(0);
+  const su2double CFLFactorIncrease = config->GetCFL_AdaptParam(1);
+  const su2double CFLMin            = config->GetCFL_AdaptParam(2);
+  const su2double DivergenceRatio   = config->GetCFL_AdaptFeedbackParam(0);
+  const unsigned long CheckpointFreq = SU2_TYPE::Int(config->GetCFL_AdaptFeedbackParam(1));
+
+  const bool turbulent = (config->GetKind_Turb_Model() != NONE);
+
+  CSolver *solverFlow = solver_container[FLOW_SOL];
+  CSolver *solverTurb = turbulent? solver_container[TURB_SOL] : nullptr;
+
+  const unsigned short nVarFlow = solverFlow->GetnVar();
+  const unsigned short nVarTurb = turbulent? solverTurb->GetnVar() : 0;
+  const unsigned long nPointMesh = geometry->GetnPoint();
+
+  restart = false;
+
+  /*--- Nonlinear residual indicator, sum of the RMS residuals of all equations. ---*/
+
+  Old_Func = New_Func;
+  New_Func = 0.0;
+  for (unsigned short iVar = 0; iVar < nVarFlow; iVar++)
+    New_Func += solverFlow->GetRes_RMS(iVar);
+  for (unsigned short iVar = 0; iVar < nVarTurb; iVar++)
+    New_Func += solverTurb->GetRes_RMS(iVar);
+
+  CFLAdapt_Iter++;
+
+  /*--- If the residual diverged with respect to the saved solution, restore it (and the
+   local CFL numbers, reduced for the next restarts) and recompute the quantities that
+   the next iteration needs before its own preprocessing (primitives and eddy viscosity).
+   Restarting with the minimum CFL would only repeat the same iterations. ---*/
+
+  const bool diverged = (New_Func > DivergenceRatio*CFLCheckpoint_Res) || (New_Func != New_Func);
+
+  if ((CFLCheckpoint_Res > 0.0) && diverged && (CFLCheckpoint_MaxCFL > CFLMin)) {
+
+    if (rank == MASTER_NODE)
+      cout << "CFL feedback: the residual diverged, restarting from the last saved solution with a reduced CFL." << endl;
+
+    for (unsigned long iPoint = 0; iPoint < nPointMesh; iPoint++) {
+      for (unsigned short iVar = 0; iVar < nVarFlow; iVar++)
+        solverFlow->GetNodes()->SetSolution(iPoint, iVar, CFLCheckpoint_Flow[iPoint*nVarFlow+iVar]);
+      for (unsigned short iVar = 0; iVar < nVarTurb; iVar++)
+        solverTurb->GetNodes()->SetSolution(iPoint, iVar, CFLCheckpoint_Turb[iPoint*nVarTurb+iVar]);
+
+      solverFlow->GetNodes()->SetLocalCFL(iPoint, CFLCheckpoint_CFL[iPoint]);
+      CFLCheckpoint_CFL[iPoint] *= CFLFactorDecrease;
+    }
+    CFLCheckpoint_MaxCFL *= CFLFactorDecrease;
+
+    solverFlow->Preprocessing(geometry, solver_container, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
+    if (turbulent) solverTurb->Postprocessing(geometry, solver_container, config, MESH_0);
+
+    Old_Func = New_Func = CFLCheckpoint_Res;
+    restart = true;
+    return CFLFactorDecrease;
+  }
+
+  /*--- Save the solution periodically, while the residual is not growing. The residual may be
+   larger than the one of the previous save (e.g. during the development of boundary layers). ---*/
+
+  if ((CFLCheckpoint_Res == 0.0) || ((CFLAdapt_Iter % CheckpointFreq == 0) && (New_Func <= Old_Func) && !diverged)) {
+
+    CFLCheckpoint_Flow.resize(nPointMesh*nVarFlow);
+    CFLCheckpoint_Turb.resize(nPointMesh*nVarTurb);
+    CFLCheckpoint_CFL.resize(nPointMesh);
+
+    for (unsigned long iPoint = 0; iPoint < nPointMesh; iPoint++) {
+      for (unsigned short iVar = 0; iVar < nVarFlow; iVar++)
+        CFLCheckpoint_Flow[iPoint*nVarFlow+iVar] = solverFlow->GetNodes()->GetSolution(iPoint, iVar);
+      for (unsigned short iVar = 0; iVar < nVarTurb; iVar++)
+        CFLCheckpoint_Turb[iPoint*nVarTurb+iVar] = solverTurb->GetNodes()->GetSolution(iPoint, iVar);
+      CFLCheckpoint_CFL[iPoint] = solverFlow->GetNodes()->GetLocalCFL(iPoint);
+    }
+    CFLCheckpoint_Res = New_Func;
+
+    su2double myMaxCFL = 0.0;
+    for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+      myMaxCFL = max(myMaxCFL, CFLCheckpoint_CFL[iPoint]);
+    SU2_MPI::Allreduce(&myMaxCFL, &CFLCheckpoint_MaxCFL, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  }
+
+  /*--- Feedback from the linear solvers (worst of the flow and turbulence systems). If the
+   requested reduction of the residual was not achieved the pseudo time step is too large
+   for the linear solver, if it was, the CFL grows in proportion to the unused iterations. ---*/
+
+  su2double linRes = solverFlow->GetResLinSolver();
+  su2double linIter = solverFlow->GetIterLinSolver();
+  if (turbulent) {
+    linRes = max(linRes, solverTurb->GetResLinSolver());
+    linIter = max(linIter, su2double(solverTurb->GetIterLinSolver()));
+  }
+
+  su2double CFLFactor = 1.0;
+  if (linRes > 0.5) {
+    CFLFactor = CFLFactorDecrease;
+  } else if (linRes <= config->GetLinear_Solver_Error()) {
+    const su2double unusedIter = max(0.0, 1.0 - linIter/su2double(config->GetLinear_Solver_Iter()));
+    CFLFactor = 1.0 + (CFLFactorIncrease-1.0)*unusedIter;
+  }
+
+  /*--- The CFL is not increased while the nonlinear residual grows. ---*/
+
+  if (New_Func > Old_Func) CFLFactor = min(CFLFactor, su2double(1.0));
+
+  return CFLFactor;
+
 }
 
 
@@ -2340,6 +2502,16 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
   const su2double CFLMin            = config->GetCFL_AdaptParam(2);
   const su2double CFLMax            = config->GetCFL_AdaptParam(3);
 
+  /* With the feedback controller the factor is global (except for under-relaxed points)
+   and comes from the linear solver convergence and the nonlinear residual trend. */
+
+  const bool feedback = config->GetCFL_Adapt_Feedback();
+  bool restart = false;
+  su2double CFLFeedback = 1.0;
+  if (feedback) {
+    CFLFeedback = CFLFeedbackFactor(geometry[MESH_0], solver_container[MESH_0], config, restart);
+  }
+
   for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
 
     /* Store the mean flow, and turbulence solvers more clearly. */
@@ -2360,67 +2532,69 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
      solver residual within the specified number of linear iterations. */
 
     bool reduceCFL = false;
-    su2double linResFlow = solverFlow->GetResLinSolver();
-    su2double linResTurb = -1.0;
-    if ((iMesh == MESH_0) && (config->GetKind_Turb_Model() != NONE)) {
-      linResTurb = solverTurb->GetResLinSolver();
-    }
+    if (!feedback) {
+      su2double linResFlow = solverFlow->GetResLinSolver();
+      su2double linResTurb = -1.0;
+      if ((iMesh == MESH_0) && (config->GetKind_Turb_Model() != NONE)) {
+        linResTurb = solverTurb->GetResLinSolver();
+      }
 
-    su2double maxLinResid = max(linResFlow, linResTurb);
-    if (maxLinResid > 0.5) {
-      reduceCFL = true;
-    }
+      su2double maxLinResid = max(linResFlow, linResTurb);
+      if (maxLinResid > 0.5) {
+        reduceCFL = true;
+      }
 
-    /* Check that we are meeting our nonlinear residual reduction target
-     over time so that we do not get stuck in limit cycles. */
+      /* Check that we are meeting our nonlinear residual reduction target
+       over time so that we do not get stuck in limit cycles. */
 
-    Old_Func = New_Func;
-    unsigned short Res_Count = 100;
-    if (NonLinRes_Series.size() == 0) NonLinRes_Series.resize(Res_Count,0.0);
+      Old_Func = New_Func;
+      unsigned short Res_Count = 100;
+      if (NonLinRes_Series.size() == 0) NonLinRes_Series.resize(Res_Count,0.0);
 
-    /* Sum the RMS residuals for all equations. */
+      /* Sum the RMS residuals for all equations. */
 
-    New_Func = 0.0;
-    for (unsigned short iVar = 0; iVar < solverFlow->GetnVar(); iVar++) {
-      New_Func += solverFlow->GetRes_RMS(iVar);
-    }
-    if ((iMesh == MESH_0) && (config->GetKind_Turb_Model() != NONE)) {
-      for (unsigned short iVar = 0; iVar < solverTurb->GetnVar(); iVar++) {
-        New_Func += solverTurb->GetRes_RMS(iVar);
+      New_Func = 0.0;
+      for (unsigned short iVar = 0; iVar < solverFlow->GetnVar(); iVar++) {
+        New_Func += solverFlow->GetRes_RMS(iVar);
+      }
+      if ((iMesh == MESH_0) && (config->GetKind_Turb_Model() != NONE)) {
+        for (unsigned short iVar = 0; iVar < solverTurb->GetnVar(); iVar++) {
+          New_Func += solverTurb->GetRes_RMS(iVar);
+        }
       }
-    }
 
-    /* Compute the difference in the nonlinear residuals between the
-     current and previous iterations. */
+      /* Compute the difference in the nonlinear residuals between the
+       current and previous iterations. */
 
-    NonLinRes_Func = (New_Func - Old_Func);
-    NonLinRes_Series[NonLinRes_Counter] = NonLinRes_Func;
+      NonLinRes_Func = (New_Func - Old_Func);
+      NonLinRes_Series[NonLinRes_Counter] = NonLinRes_Func;
 
-    /* Increment the counter, if we hit the max size, then start over. */
+      /* Increment the counter, if we hit the max size, then start over. */
 
-    NonLinRes_Counter++;
-    if (NonLinRes_Counter == Res_Count) NonLinRes_Counter = 0;
+      NonLinRes_Counter++;
+      if (NonLinRes_Counter == Res_Count) NonLinRes_Counter = 0;
 
-    /* Sum the total change in nonlinear residuals over the previous
-     set of all stored iterations. */
+      /* Sum the total change in nonlinear residuals over the previous
+       set of all stored iterations. */
 
-    NonLinRes_Value = New_Func;
-    if (config->GetTimeIter() >= Res_Count) {
-      NonLinRes_Value = 0.0;
-      for (unsigned short iCounter = 0; iCounter < Res_Count; iCounter++)
-        NonLinRes_Value += NonLinRes_Series[iCounter];
-    }
+      NonLinRes_Value = New_Func;
+      if (config->GetTimeIter() >= Res_Count) {
+        NonLinRes_Value = 0.0;
+        for (unsigned short iCounter = 0; iCounter < Res_Count; iCounter++)
+          NonLinRes_Value += NonLinRes_Series[iCounter];
+      }
 
-    /* If the sum is larger than a small fraction of the current nonlinear
-     residual, then we are not decreasing the nonlinear residual at a high
-     rate. In this situation, we force a reduction of the CFL in all cells.
-     Reset the array so that we delay the next decrease for some iterations. */
+      /* If the sum is larger than a small fraction of the current nonlinear
+       residual, then we are not decreasing the nonlinear residual at a high
+       rate. In this situation, we force a reduction of the CFL in all cells.
+       Reset the array so that we delay the next decrease for some iterations. */
 
-    if (fabs(NonLinRes_Value) < 0.1*New_Func) {
-      reduceCFL = true;
-      NonLinRes_Counter = 0;
-      for (unsigned short iCounter = 0; iCounter < Res_Count; iCounter++)
-        NonLinRes_Series[iCounter] = New_Func;
+      if (fabs(NonLinRes_Value) < 0.1*New_Func) {
+        reduceCFL = true;
+        NonLinRes_Counter = 0;
+        for (unsigned short iCounter = 0; iCounter < Res_Count; iCounter++)
+          NonLinRes_Series[iCounter] = New_Func;
+      }
     }
 
     /* Loop over all points on this grid and apply CFL adaption. */
@@ -2451,12 +2625,14 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
        then we schedule an increase the CFL number for the next iteration. */
 
       su2double CFLFactor = 1.0;
-      if ((underRelaxation < 0.1)) {
+      if (restart) {
+        CFLFactor = CFLFeedback;
+      } else if ((underRelaxation < 0.1)) {
         CFLFactor = CFLFactorDecrease;
       } else if (underRelaxation >= 0.1 && underRelaxation < 1.0) {
-        CFLFactor = 1.0;
+        CFLFactor = feedback? min(CFLFeedback, su2double(1.0)) : 1.0;
       } else {
-        CFLFactor = CFLFactorIncrease;
+        CFLFactor = feedback? CFLFeedback : CFLFactorIncrease;
       }
 
       /* Check if we are hitting the min or max and adjust. */
@@ -2497,23 +2673,23 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
     su2double rbuf_min, sbuf_min;
     sbuf_min = myCFLMin;
-    SU2_MPI::Allreduce(&sbuf_min, &rbuf_min, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&sbuf_min, &rbuf_min, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
     Min_CFL_Local = rbuf_min;
 
     su2double rbuf_max, sbuf_max;
     sbuf_max = myCFLMax;
-    SU2_MPI::Allreduce(&sbuf_max, &rbuf_max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&sbuf_max, &rbuf_max, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
     Max_CFL_Local = rbuf_max;
 
     su2double rbuf_sum, sbuf_sum;
     sbuf_sum = myCFLSum;
-    SU2_MPI::Allreduce(&sbuf_sum, &rbuf_sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&sbuf_sum, &rbuf_sum, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
     Avg_CFL_Local = rbuf_sum;
 
     unsigned long Global_nPointDomain;
     unsigned long Local_nPointDomain = geometry[iMesh]->GetnPointDomain();
     SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1,
-                       MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+                       MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
     Avg_CFL_Local /= (su2double)Global_nPointDomain;
 
   }
@@ -2541,86 +2717,61 @@ void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
 #else
 
   int nProcessor = size, iProcessor;
-
-  su2double *sbuf_residual, *rbuf_residual, *sbuf_coord, *rbuf_coord, *Coord;
-  unsigned long *sbuf_point, *rbuf_point, Global_nPointDomain;
   unsigned short iDim;
 
-  /*--- Set the L2 Norm residual in all the processors ---*/
+  /*--- Set the L2 Norm residual in all the processors, the number of points is
+   *    reduced together with the residuals to use a single collective. ---*/
 
-  sbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
-  rbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) rbuf_residual[iVar] = 0.0;
-
-  for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = GetRes_RMS(iVar);
-
-  if (config->GetComm_Level() == COMM_FULL) {
-
-    unsigned long Local_nPointDomain = geometry->GetnPointDomain();
-    SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-
-  } else {
+  vector<su2double> residual(nVar+1);
 
-    /*--- Reduced MPI comms have been requested. Use a local residual only. ---*/
+  for (iVar = 0; iVar < nVar; iVar++) residual[iVar] = GetRes_RMS(iVar);
+  residual[nVar] = geometry->GetnPointDomain();
 
-    for (iVar = 0; iVar < nVar; iVar++) rbuf_residual[iVar] = sbuf_residual[iVar];
-    Global_nPointDomain = geometry->GetnPointDomain();
+  /*--- If reduced MPI comms have been requested use a local residual only. ---*/
 
+  if (config->GetComm_Level() == COMM_FULL) {
+    CReductionAccumulator reduction;
+    reduction.Add(residual.data(), nVar+1);
+    reduction.Reduce();
   }
 
+  const su2double Global_nPointDomain = residual[nVar];
 
   for (iVar = 0; iVar < nVar; iVar++) {
 
-    if (rbuf_residual[iVar] != rbuf_residual[iVar]) {
+    if (residual[iVar] != residual[iVar]) {
       SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
     }
 
-    SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbuf_residual[iVar]/Global_nPointDomain)));
+    SetRes_RMS(iVar, max(EPS*EPS, sqrt(residual[iVar]/Global_nPointDomain)));
 
   }
 
-  delete [] sbuf_residual;
-  delete [] rbuf_residual;
-
-  /*--- Set the Maximum residual in all the processors ---*/
+  /*--- Set the Maximum residual in all the processors, the value, point, and
+   *    coordinates of each variable are packed to gather them together. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
 
-    sbuf_residual = new su2double [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
-    sbuf_point = new unsigned long [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_point[iVar] = 0;
-    sbuf_coord = new su2double[nVar*nDim]; for (iVar = 0; iVar < nVar*nDim; iVar++) sbuf_coord[iVar] = 0.0;
-
-    rbuf_residual = new su2double [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_residual[iVar] = 0.0;
-    rbuf_point = new unsigned long [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_point[iVar] = 0;
-    rbuf_coord = new su2double[nProcessor*nVar*nDim]; for (iVar = 0; iVar < nProcessor*nVar*nDim; iVar++) rbuf_coord[iVar] = 0.0;
+    const unsigned long nPack = nVar*(2+nDim);
+    vector<su2double> sbuf_max(nPack, 0.0), rbuf_max(nProcessor*nPack, 0.0);
 
     for (iVar = 0; iVar < nVar; iVar++) {
-      sbuf_residual[iVar] = GetRes_Max(iVar);
-      sbuf_point[iVar] = GetPoint_Max(iVar);
-      Coord = GetPoint_Max_Coord(iVar);
+      su2double *Coord = GetPoint_Max_Coord(iVar);
+      sbuf_max[iVar*(2+nDim)] = GetRes_Max(iVar);
+      sbuf_max[iVar*(2+nDim)+1] = GetPoint_Max(iVar);
       for (iDim = 0; iDim < nDim; iDim++)
-        sbuf_coord[iVar*nDim+iDim] = Coord[iDim];
+        sbuf_max[iVar*(2+nDim)+2+iDim] = Coord[iDim];
     }
 
-    SU2_MPI::Allgather(sbuf_residual, nVar, MPI_DOUBLE, rbuf_residual, nVar, MPI_DOUBLE, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_DOUBLE, rbuf_coord, nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(sbuf_max.data(), nPack, MPI_DOUBLE, rbuf_max.data(), nPack, MPI_DOUBLE, SU2_MPI::GetComm());
 
     for (iVar = 0; iVar < nVar; iVar++) {
       for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-        AddRes_Max(iVar, rbuf_residual[iProcessor*nVar+iVar], rbuf_point[iProcessor*nVar+iVar], &rbuf_coord[iProcessor*nVar*nDim+iVar*nDim]);
+        su2double *buf = &rbuf_max[iProcessor*nPack+iVar*(2+nDim)];
+        AddRes_Max(iVar, buf[0], static_cast<unsigned long>(SU2_TYPE::GetValue(buf[1])), &buf[2]);
       }
     }
 
-    delete [] sbuf_residual;
-    delete [] rbuf_residual;
-
-    delete [] sbuf_point;
-    delete [] rbuf_point;
-
-    delete [] sbuf_coord;
-    delete [] rbuf_coord;
-
   }
 
 #endif
@@ -2659,8 +2810,8 @@ void CSolver::SetResidual_BGS(CGeometry *geometry, CConfig *config) {
   Local_nPointDomain = geometry->GetnPointDomain();
 
 
-  SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
 
   for (iVar = 0; iVar < nVar; iVar++) {
@@ -2695,9 +2846,9 @@ void CSolver::SetResidual_BGS(CGeometry *geometry, CConfig *config) {
       sbuf_coord[iVar*nDim+iDim] = Coord[iDim];
   }
 
-  SU2_MPI::Allgather(sbuf_residual, nVar, MPI_DOUBLE, rbuf_residual, nVar, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_DOUBLE, rbuf_coord, nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(sbuf_residual, nVar, MPI_DOUBLE, rbuf_residual, nVar, MPI_DOUBLE, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_DOUBLE, rbuf_coord, nVar*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
 
   for (iVar = 0; iVar < nVar; iVar++) {
     for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
@@ -3109,6 +3260,8 @@ void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
 
 void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
 
+  if (FrozenLimiters(config)) return;
+
   auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit());
   const auto& solution = base_nodes->GetSolution();
   const auto& gradient = base_nodes->GetGradient_Reconstruction();
@@ -3120,6 +3273,16 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
                   *geometry, *config, 0, nVar, solution, gradient, solMin, solMax, limiter);
 }
 
+bool CSolver::FrozenLimiters(const CConfig *config) {
+
+  /*--- The recording of discrete adjoints has its own option (FROZEN_LIMITER_DISC). ---*/
+
+  const bool frozen = LimitersComputed && !config->GetDiscrete_Adjoint() &&
+                      (config->GetInnerIter() > config->GetLimiterFreezeIter());
+  LimitersComputed = true;
+  return frozen;
+}
+
 void CSolver::Gauss_Elimination(su2double** A, su2double* rhs, unsigned short nVar) {
 
   short iVar, jVar, kVar;
@@ -3507,7 +3670,7 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
   if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
 
-  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, SU2_MPI::GetComm());
 
   if (rbuf_NotMatching != 0) {
     SU2_MPI::Error(string("The solution file ") + filename + string(" doesn't match with the mesh file!\n") +
@@ -3580,7 +3743,7 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
     if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
 
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, SU2_MPI::GetComm());
 
     if (rbuf_NotMatching != 0) {
       SU2_MPI::Error(string("The solution file ") + filename + string(" doesn't match with the mesh file!\n") +
@@ -3665,7 +3828,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
 
   /*--- All ranks open the file using MPI. ---*/
 
-  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+  ierr = MPI_File_open(SU2_MPI::GetComm(), fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
 
   /*--- Error check opening the file. ---*/
 
@@ -3681,7 +3844,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
 
   /*--- Broadcast the number of variables to all procs and store clearly. ---*/
 
-  SU2_MPI::Bcast(&magic_number, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(&magic_number, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
@@ -3850,7 +4013,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   /*--- All ranks open the file using MPI. ---*/
 
-  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+  ierr = MPI_File_open(SU2_MPI::GetComm(), fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
 
   /*--- Error check opening the file. ---*/
 
@@ -3867,7 +4030,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   /*--- Broadcast the number of variables to all procs and store clearly. ---*/
 
-  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
@@ -3897,7 +4060,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   /*--- Broadcast the string names of the variables. ---*/
 
   SU2_MPI::Bcast(mpi_str_buf, nFields*CGNS_STRING_SIZE, MPI_CHAR,
-                 MASTER_NODE, MPI_COMM_WORLD);
+                 MASTER_NODE, SU2_MPI::GetComm());
 
   /*--- Now parse the string names and load into the config class in case
    we need them for writing visualization files (SU2_SOL). ---*/
@@ -4335,7 +4498,7 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
     if (local_failure > 0) break;
   }
 
-  SU2_MPI::Allreduce(&local_failure, &global_failure, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&local_failure, &global_failure, 1, MPI_UNSIGNED_SHORT, MPI_SUM, SU2_MPI::GetComm());
 
   if (global_failure > 0) {
     SU2_MPI::Error("Prescribed inlet data does not match markers within tolerance.", CURRENT_FUNCTION);
@@ -4384,8 +4547,8 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
            children from the interior volume will not be included in
            the averaging. ---*/
 
-          for (iChildren = 0; iChildren < geometry[iMesh]->node[iPoint]->GetnChildren_CV(); iChildren++) {
-            Point_Fine = geometry[iMesh]->node[iPoint]->GetChildren_CV(iChildren);
+          for (iChildren = 0; iChildren < geometry[iMesh]->GetChildrenCV().getNumNonZeros(iPoint); iChildren++) {
+            Point_Fine = geometry[iMesh]->GetChildrenCV().getInnerIdx(iPoint, iChildren);
             for (iVar = 0; iVar < nColumns; iVar++) Inlet_Fine[iVar] = 0.0;
             Area_Children = solver[iMesh-1][KIND_SOLVER]->GetInletAtVertex(Inlet_Fine.data(), Point_Fine, KIND_MARKER,
                                                                            Marker_Tag, geometry[iMesh-1], config);
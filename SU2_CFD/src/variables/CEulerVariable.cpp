@@ -39,6 +39,22 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   bool windgust  = config->GetWind_Gust();
   bool classical_rk4 = (config->GetKind_TimeIntScheme_Flow() == CLASSICAL_RK4_EXPLICIT);
 
+  /*--- Some containers are only used by specific schemes, determine which are needed
+   (the criteria mirror those of the Preprocessing routines of the Euler and NS solvers,
+   the latter also compute the limiter of the primitives for the turbulence model). ---*/
+
+  bool cont_adjoint = config->GetContinuous_Adjoint();
+  bool center  = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) ||
+                 (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == SPACE_CENTERED);
+  bool muscl   = config->GetMUSCL_Flow() || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == ROE);
+  bool limiter = muscl && !center && (config->GetKind_SlopeLimit_Flow() != NO_LIMITER);
+  if (config->GetViscous())
+    limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) ||
+              (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) ||
+              (cont_adjoint && config->GetKind_SlopeLimit_AdjFlow() != NO_LIMITER);
+  limiter = limiter && (config->GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE);
+  bool roe_low_dissipation = (config->GetKind_RoeLowDiss() != NO_ROELOWDISS);
+
   /*--- Allocate and initialize the primitive variables and gradients ---*/
 
   nPrimVar          = nDim+9;
@@ -65,14 +81,20 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED)
     Undivided_Laplacian.resize(nPoint,nVar);
 
-  /*--- Always allocate the slope limiter,
-   and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
+  /*--- Always allocate the slope limiter (it is read by the turbulence solver and by the output),
+   the bounds used to compute it are only needed when the limiter is computed. ---*/
 
   Limiter_Primitive.resize(nPoint,nPrimVarGrad) = su2double(0.0);
-  Limiter.resize(nPoint,nVar) = su2double(0.0);
 
-  Solution_Max.resize(nPoint,nPrimVarGrad) = su2double(0.0);
-  Solution_Min.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+  if (limiter) {
+    Solution_Max.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+    Solution_Min.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+  }
+
+  /*--- The limiter of the conservative variables is only written by the legacy output. ---*/
+
+  if (config->GetWrt_Limiters())
+    Limiter.resize(nPoint,nVar) = su2double(0.0);
 
   /*--- Solution initialization ---*/
 
@@ -132,8 +154,12 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   Velocity2.resize(nPoint) = su2double(0.0);
   Max_Lambda_Inv.resize(nPoint) = su2double(0.0);
   Delta_Time.resize(nPoint) = su2double(0.0);
-  Lambda.resize(nPoint) = su2double(0.0);
-  Sensor.resize(nPoint) = su2double(0.0);
+
+  /*--- Spectral radius and pressure sensor of the centered schemes, the sensor
+   is also used by the Ducros variants of the low dissipation Roe scheme. ---*/
+
+  if (center) Lambda.resize(nPoint) = su2double(0.0);
+  if (center || roe_low_dissipation) Sensor.resize(nPoint) = su2double(0.0);
 
   /* Under-relaxation parameter. */
   UnderRelaxation.resize(nPoint) = su2double(1.0);
@@ -145,6 +171,22 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   
 }
 
+void CEulerVariable::GetContainerMemory(vector<pair<string,unsigned long> >& containers) const {
+
+  CVariable::GetContainerMemory(containers);
+
+  containers.emplace_back("Velocity2", ContainerBytes(Velocity2));
+  containers.emplace_back("HB_Source", ContainerBytes(HB_Source));
+  containers.emplace_back("WindGust", ContainerBytes(WindGust));
+  containers.emplace_back("WindGustDer", ContainerBytes(WindGustDer));
+  containers.emplace_back("Primitive", ContainerBytes(Primitive));
+  containers.emplace_back("Gradient_Primitive", ContainerBytes(Gradient_Primitive));
+  containers.emplace_back("Gradient_Aux", ContainerBytes(Gradient_Aux));
+  containers.emplace_back("Limiter_Primitive", ContainerBytes(Limiter_Primitive));
+  containers.emplace_back("Secondary", ContainerBytes(Secondary));
+  containers.emplace_back("Solution_New", ContainerBytes(Solution_New));
+}
+
 bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
   bool RightVol = true;
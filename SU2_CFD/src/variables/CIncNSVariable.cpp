@@ -34,8 +34,19 @@ CIncNSVariable::CIncNSVariable(su2double pressure, const su2double *velocity, su
                                CIncEulerVariable(pressure, velocity, temperature, npoint, ndim, nvar, config) {
   Vorticity.resize(nPoint,3);
   StrainMag.resize(nPoint);
-  DES_LengthScale.resize(nPoint) = su2double(0.0);
   Max_Lambda_Visc.resize(nPoint);
+
+  if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES)
+    DES_LengthScale.resize(nPoint) = su2double(0.0);
+}
+
+void CIncNSVariable::GetContainerMemory(vector<pair<string,unsigned long> >& containers) const {
+
+  CIncEulerVariable::GetContainerMemory(containers);
+
+  containers.emplace_back("Vorticity", ContainerBytes(Vorticity));
+  containers.emplace_back("StrainMag", ContainerBytes(StrainMag));
+  containers.emplace_back("DES_LengthScale", ContainerBytes(DES_LengthScale));
 }
 
 bool CIncNSVariable::SetVorticity_StrainMag() {
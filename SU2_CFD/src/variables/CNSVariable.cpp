@@ -38,10 +38,26 @@ CNSVariable::CNSVariable(su2double density, const su2double *velocity, su2double
   Vorticity.resize(nPoint,3) = su2double(0.0);
   StrainMag.resize(nPoint) = su2double(0.0);
   Tau_Wall.resize(nPoint) = su2double(-1.0);
-  DES_LengthScale.resize(nPoint) = su2double(0.0);
-  Roe_Dissipation.resize(nPoint) = su2double(0.0);
-  Vortex_Tilting.resize(nPoint) = su2double(0.0);
   Max_Lambda_Visc.resize(nPoint) = su2double(0.0);
+
+  /*--- Only for hybrid RANS/LES and low dissipation Roe schemes. ---*/
+
+  if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES)
+    DES_LengthScale.resize(nPoint) = su2double(0.0);
+
+  if (config->GetKind_RoeLowDiss() != NO_ROELOWDISS)
+    Roe_Dissipation.resize(nPoint) = su2double(0.0);
+}
+
+void CNSVariable::GetContainerMemory(vector<pair<string,unsigned long> >& containers) const {
+
+  CEulerVariable::GetContainerMemory(containers);
+
+  containers.emplace_back("Vorticity", ContainerBytes(Vorticity));
+  containers.emplace_back("StrainMag", ContainerBytes(StrainMag));
+  containers.emplace_back("Tau_Wall", ContainerBytes(Tau_Wall));
+  containers.emplace_back("DES_LengthScale", ContainerBytes(DES_LengthScale));
+  containers.emplace_back("Roe_Dissipation", ContainerBytes(Roe_Dissipation));
 }
 
 bool CNSVariable::SetVorticity_StrainMag() {
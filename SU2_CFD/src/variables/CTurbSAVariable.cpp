@@ -50,6 +50,15 @@ CTurbSAVariable::CTurbSAVariable(su2double val_nu_tilde, su2double val_muT, unsi
   Vortex_Tilting.resize(nPoint);
 }
 
+void CTurbSAVariable::GetContainerMemory(vector<pair<string,unsigned long> >& containers) const {
+
+  CTurbVariable::GetContainerMemory(containers);
+
+  containers.emplace_back("gamma_BC", ContainerBytes(gamma_BC));
+  containers.emplace_back("DES_LengthScale", ContainerBytes(DES_LengthScale));
+  containers.emplace_back("Vortex_Tilting", ContainerBytes(Vortex_Tilting));
+}
+
 void CTurbSAVariable::SetVortex_Tilting(unsigned long iPoint, su2double **PrimGrad_Flow,
                                         su2double* Vorticity, su2double LaminarViscosity) {
 
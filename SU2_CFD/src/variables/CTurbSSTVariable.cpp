@@ -50,6 +50,15 @@ CTurbSSTVariable::CTurbSSTVariable(su2double kine, su2double omega, su2double mu
   muT.resize(nPoint) = mut;
 }
 
+void CTurbSSTVariable::GetContainerMemory(vector<pair<string,unsigned long> >& containers) const {
+
+  CTurbVariable::GetContainerMemory(containers);
+
+  containers.emplace_back("F1", ContainerBytes(F1));
+  containers.emplace_back("F2", ContainerBytes(F2));
+  containers.emplace_back("CDkw", ContainerBytes(CDkw));
+}
+
 void CTurbSSTVariable::SetBlendingFunc(unsigned long iPoint, su2double val_viscosity,
                                        su2double val_dist, su2double val_density) {
   su2double arg2, arg2A, arg2B, arg1;
@@ -64,3 +64,12 @@ CTurbVariable::CTurbVariable(unsigned long npoint, unsigned long ndim, unsigned
   LocalCFL.resize(nPoint) = su2double(0.0);
   
 }
+
+void CTurbVariable::GetContainerMemory(vector<pair<string,unsigned long> >& containers) const {
+
+  CVariable::GetContainerMemory(containers);
+
+  containers.emplace_back("muT", ContainerBytes(muT));
+  containers.emplace_back("HB_Source", ContainerBytes(HB_Source));
+  containers.emplace_back("Gradient_Aux", ContainerBytes(Gradient_Aux));
+}
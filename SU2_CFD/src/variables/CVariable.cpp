@@ -79,6 +79,36 @@ CVariable::CVariable(unsigned long npoint, unsigned long ndim, unsigned long nva
     Solution_BGS_k.resize(nPoint,nVar) = su2double(0.0);
 }
 
+void CVariable::GetContainerMemory(vector<pair<string,unsigned long> >& containers) const {
+
+  containers.emplace_back("Solution", ContainerBytes(Solution));
+  containers.emplace_back("Solution_Old", ContainerBytes(Solution_Old));
+  containers.emplace_back("External", ContainerBytes(External));
+  containers.emplace_back("Non_Physical", ContainerBytes(Non_Physical) + ContainerBytes(Non_Physical_Counter));
+  containers.emplace_back("UnderRelaxation", ContainerBytes(UnderRelaxation));
+  containers.emplace_back("LocalCFL", ContainerBytes(LocalCFL));
+  containers.emplace_back("Solution_time_n", ContainerBytes(Solution_time_n));
+  containers.emplace_back("Solution_time_n1", ContainerBytes(Solution_time_n1));
+  containers.emplace_back("Delta_Time", ContainerBytes(Delta_Time));
+  containers.emplace_back("Gradient", ContainerBytes(Gradient));
+  containers.emplace_back("Rmatrix", ContainerBytes(Rmatrix));
+  containers.emplace_back("Limiter", ContainerBytes(Limiter));
+  containers.emplace_back("Solution_Max", ContainerBytes(Solution_Max));
+  containers.emplace_back("Solution_Min", ContainerBytes(Solution_Min));
+  containers.emplace_back("AuxVar", ContainerBytes(AuxVar) + ContainerBytes(Grad_AuxVar));
+  containers.emplace_back("Max_Lambda_Inv", ContainerBytes(Max_Lambda_Inv));
+  containers.emplace_back("Max_Lambda_Visc", ContainerBytes(Max_Lambda_Visc));
+  containers.emplace_back("Lambda", ContainerBytes(Lambda));
+  containers.emplace_back("Sensor", ContainerBytes(Sensor));
+  containers.emplace_back("Undivided_Laplacian", ContainerBytes(Undivided_Laplacian));
+  containers.emplace_back("Res_TruncError", ContainerBytes(Res_TruncError));
+  containers.emplace_back("Residual_Old", ContainerBytes(Residual_Old));
+  containers.emplace_back("Residual_Sum", ContainerBytes(Residual_Sum));
+  containers.emplace_back("Solution_Adj_Old", ContainerBytes(Solution_Adj_Old));
+  containers.emplace_back("Solution_BGS_k", ContainerBytes(Solution_BGS_k));
+  containers.emplace_back("AD_Index", ContainerBytes(AD_InputIndex) + ContainerBytes(AD_OutputIndex));
+}
+
 void CVariable::Set_OldSolution() { Solution_Old = Solution; }
 
 void CVariable::Set_Solution() { Solution = Solution_Old; }
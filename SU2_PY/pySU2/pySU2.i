@@ -53,12 +53,34 @@ threads="1"
 %include "std_vector.i"
 %include "std_map.i"
 %include "typemaps.i"
-//%include "numpy.i"
 #ifdef HAVE_MPI                    //Need mpi4py only for a parallel build of the wrapper.
   %include "mpi4py/mpi4py.i"
   %mpi4py_typemap(Comm, MPI_Comm)
 #endif
 
+// NumPy arrays are passed to the bulk marker functions of the driver without copies,
+// they must be contiguous float64 arrays with the shape (nVertex, nDim) or (nVertex,).
+#ifdef HAVE_NUMPY                  //The bulk functions are only wrapped if NumPy is available.
+  %include "numpy.i"
+  %init %{
+    import_array();
+  %}
+  %apply (double* INPLACE_ARRAY1, int DIM1) {(passivedouble *values, int nVertex)};
+  %apply (double* INPLACE_ARRAY2, int DIM1, int DIM2) {(passivedouble *values, int nVertex, int nVar)};
+#else
+  %ignore CDriver::GetMarkerCoordinates;
+  %ignore CDriver::SetMarkerCoordinates;
+  %ignore CDriver::GetMarkerForces;
+  %ignore CDriver::GetMarkerTemperatures;
+  %ignore CDriver::SetMarkerTemperatures;
+  %ignore CDriver::GetMarkerNormalHeatFluxes;
+  %ignore CDriver::SetMarkerNormalHeatFluxes;
+  %ignore CDriver::SetMarkerMeshDisplacements;
+  %ignore CDriver::SetMarkerFEALoads;
+  %ignore CDriver::GetMarkerFEADisplacements;
+  %ignore CDriver::GetMarkerFlowLoads;
+#endif
+
 namespace std {
    %template() vector<int>;
    %template() vector<double>;
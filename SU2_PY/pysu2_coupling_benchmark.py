@@ -0,0 +1,195 @@
+#!/usr/bin/env python
+
+## \file pysu2_coupling_benchmark.py
+#  \brief Compares the per-vertex and the bulk (NumPy) coupling functions of the Python wrapper.
+#  \version 7.0.1 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+from __future__ import division, print_function, absolute_import
+from optparse import OptionParser	# use a parser for configuration
+import time
+import numpy as np
+import pysu2			# imports the SU2 wrapped module
+
+# -------------------------------------------------------------------
+#  Per-vertex versions of the exchanges, as done by the FSI/CHT scripts
+# -------------------------------------------------------------------
+
+def vertex_coordinates(driver, iMarker, nVertex, nDim):
+  coord = np.zeros((nVertex, nDim))
+  for iVertex in range(nVertex):
+    coord[iVertex, 0] = driver.GetVertexCoordX(iMarker, iVertex)
+    coord[iVertex, 1] = driver.GetVertexCoordY(iMarker, iVertex)
+    if nDim == 3:
+      coord[iVertex, 2] = driver.GetVertexCoordZ(iMarker, iVertex)
+  return coord
+
+def vertex_forces(driver, iMarker, nVertex, nDim):
+  force = np.zeros((nVertex, nDim))
+  for iVertex in range(nVertex):
+    if driver.ComputeVertexForces(iMarker, iVertex): continue
+    force[iVertex, 0] = driver.GetVertexForceX(iMarker, iVertex)
+    force[iVertex, 1] = driver.GetVertexForceY(iMarker, iVertex)
+    if nDim == 3:
+      force[iVertex, 2] = driver.GetVertexForceZ(iMarker, iVertex)
+  return force
+
+def vertex_set_coordinates(driver, iMarker, coord):
+  nVertex, nDim = coord.shape
+  for iVertex in range(nVertex):
+    driver.SetVertexCoordX(iMarker, iVertex, coord[iVertex, 0])
+    driver.SetVertexCoordY(iMarker, iVertex, coord[iVertex, 1])
+    driver.SetVertexCoordZ(iMarker, iVertex, coord[iVertex, 2] if nDim == 3 else 0.0)
+    driver.SetVertexVarCoord(iMarker, iVertex)
+
+def vertex_temperatures(driver, iMarker, nVertex):
+  temp = np.zeros(nVertex)
+  for iVertex in range(nVertex):
+    temp[iVertex] = driver.GetVertexTemperature(iMarker, iVertex)
+  return temp
+
+def vertex_set_temperatures(driver, iMarker, temp):
+  for iVertex in range(temp.size):
+    driver.SetVertexTemperature(iMarker, iVertex, temp[iVertex])
+
+# -------------------------------------------------------------------
+#  Timing
+# -------------------------------------------------------------------
+
+def best_time(function, nRepeat):
+  best = float('inf')
+  for i in range(nRepeat):
+    start = time.time()
+    result = function()
+    best = min(best, time.time()-start)
+  return best, result
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+
+  parser=OptionParser()
+  parser.add_option("-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE")
+  parser.add_option("-m", "--marker", dest="marker", help="Tag of the coupled MARKER", metavar="MARKER")
+  parser.add_option("--nDim", dest="nDim", default=2, help="Define the number of DIMENSIONS",
+                    metavar="DIMENSIONS")
+  parser.add_option("-n", "--repeat", dest="nRepeat", default=10, help="Number of REPEATS of each exchange",
+                    metavar="REPEATS")
+  parser.add_option("--parallel", action="store_true",
+                    help="Specify if we need to initialize MPI", dest="with_MPI", default=False)
+
+  (options, args) = parser.parse_args()
+  options.nRepeat = int(options.nRepeat)
+  nDim = int(options.nDim)
+
+  if options.filename == None:
+    raise Exception("No config file provided. Use -f flag")
+  if options.marker == None:
+    raise Exception("No marker provided. Use -m flag")
+
+  if options.with_MPI == True:
+    from mpi4py import MPI
+    comm = MPI.COMM_WORLD
+    rank = comm.Get_rank()
+  else:
+    comm = 0
+    rank = 0
+
+  driver = pysu2.CSinglezoneDriver(options.filename, 1, comm)
+
+  # One iteration so that the forces and temperatures are those of a flow solution.
+  driver.Preprocess(0)
+  driver.Run()
+
+  allMarkers = driver.GetAllBoundaryMarkers()
+  if options.marker not in allMarkers:
+    # The marker is not in this partition.
+    nVertex, iMarker = 0, -1
+  else:
+    iMarker = allMarkers[options.marker]
+    nVertex = driver.GetNumberVertices(iMarker)
+
+  results = []
+
+  if nVertex > 0:
+    # Bulk arrays are allocated once and reused, as a coupling loop would do.
+    coord = np.zeros((nVertex, nDim))
+    force = np.zeros((nVertex, nDim))
+    temp = np.zeros(nVertex)
+
+    def bulk_coordinates():
+      driver.GetMarkerCoordinates(iMarker, coord)
+      return coord
+    def bulk_forces():
+      driver.GetMarkerForces(iMarker, force)
+      return force
+    def bulk_temperatures():
+      driver.GetMarkerTemperatures(iMarker, temp)
+      return temp
+
+    cases = [("coordinates", lambda: vertex_coordinates(driver, iMarker, nVertex, nDim), bulk_coordinates),
+             ("forces", lambda: vertex_forces(driver, iMarker, nVertex, nDim), bulk_forces),
+             ("temperatures", lambda: vertex_temperatures(driver, iMarker, nVertex), bulk_temperatures)]
+
+    for name, vertexPath, bulkPath in cases:
+      tVertex, vVertex = best_time(vertexPath, options.nRepeat)
+      tBulk, vBulk = best_time(bulkPath, options.nRepeat)
+      results.append((name, tVertex, tBulk, np.max(np.abs(vVertex-vBulk)) if vVertex.size else 0.0))
+
+    # The setters write back the current values, i.e. they do not change the problem.
+    newCoord = vertex_coordinates(driver, iMarker, nVertex, nDim)
+    newTemp = vertex_temperatures(driver, iMarker, nVertex)
+
+    tVertex, _ = best_time(lambda: vertex_set_coordinates(driver, iMarker, newCoord), options.nRepeat)
+    tBulk, _ = best_time(lambda: driver.SetMarkerCoordinates(iMarker, newCoord), options.nRepeat)
+    results.append(("set coordinates", tVertex, tBulk, 0.0))
+
+    # Custom wall temperatures only exist for isothermal markers listed in MARKER_PYTHON_CUSTOM.
+    if options.marker in driver.GetAllCHTMarkersTag() and \
+       driver.GetAllBoundaryMarkersType()[options.marker] == "ISOTHERMAL":
+      tVertex, _ = best_time(lambda: vertex_set_temperatures(driver, iMarker, newTemp), options.nRepeat)
+      tBulk, _ = best_time(lambda: driver.SetMarkerTemperatures(iMarker, newTemp), options.nRepeat)
+      results.append(("set temperatures", tVertex, tBulk, 0.0))
+
+  print("\nRank {}: marker {} with {} vertices, best of {} repeats.".format(rank, options.marker,
+                                                                            nVertex, options.nRepeat))
+  print("{:<18s} {:>14s} {:>14s} {:>9s} {:>12s}".format("exchange", "per-vertex [s]", "bulk [s]",
+                                                         "speedup", "max diff"))
+  for name, tVertex, tBulk, diff in results:
+    print("{:<18s} {:>14.3e} {:>14.3e} {:>9.1f} {:>12.3e}".format(name, tVertex, tBulk,
+                                                                   tVertex/max(tBulk, 1e-12), diff))
+
+  driver.Postprocessing()
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
@@ -1188,6 +1188,19 @@ def main():
     pywrapper_unsteadyCHT.new_output    = True
     test_list.append(pywrapper_unsteadyCHT)
 
+    # Unsteady CHT with the bulk (NumPy) marker functions, same results as the per-vertex version
+    pywrapper_unsteadyCHT_bulk               = TestCase('pywrapper_unsteadyCHT_bulk')
+    pywrapper_unsteadyCHT_bulk.cfg_dir       = "py_wrapper/flatPlate_unsteady_CHT"
+    pywrapper_unsteadyCHT_bulk.cfg_file      = "unsteady_CHT_FlatPlate_Conf.cfg"
+    pywrapper_unsteadyCHT_bulk.test_iter     = 5
+    pywrapper_unsteadyCHT_bulk.test_vals     = [-1.614167, 2.245730, -0.000767, 0.175598] #last 4 columns
+    pywrapper_unsteadyCHT_bulk.su2_exec      = "mpirun -np 2 python launch_unsteady_CHT_FlatPlate_bulk.py --parallel -f"
+    pywrapper_unsteadyCHT_bulk.timeout       = 1600
+    pywrapper_unsteadyCHT_bulk.tol           = 0.00001
+    pywrapper_unsteadyCHT_bulk.unsteady      = True
+    pywrapper_unsteadyCHT_bulk.new_output    = True
+    test_list.append(pywrapper_unsteadyCHT_bulk)
+
     # Rigid motion
     pywrapper_rigidMotion               = TestCase('pywrapper_rigidMotion')
     pywrapper_rigidMotion.cfg_dir       = "py_wrapper/flatPlate_rigidMotion"
@@ -0,0 +1,362 @@
+#!/usr/bin/env python
+
+## \file performance_benchmark.py
+#  \brief Python script to measure the performance of a fixed set of SU2 cases
+#         and to compare it with a stored baseline (performance regressions).
+#  \version 7.0.1 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2019, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+from __future__ import print_function, division, absolute_import
+from optparse import OptionParser
+import os, sys, re, json, time, glob, socket, datetime, subprocess
+
+
+class BenchmarkCase:
+
+    def __init__(self, tag_in):
+
+        self.tag = tag_in        # Input, string tag that identifies this case
+
+        # Configuration file path/filename
+        self.cfg_dir  = "."
+        self.cfg_file = "default.cfg"
+
+        # Options overwritten (or added) in the configuration, e.g. the fixed iteration count
+        self.options = {}
+
+        # Name of the history group with the linear solver iterations, None if not available
+        self.linsol_group = "LINSOL"
+
+        # Use the AD build of SU2_CFD
+        self.adjoint = False
+
+        self.timeout = 3600
+
+    def write_config(self):
+        """Copy of the configuration with the benchmark options, returns its name."""
+
+        options = dict(self.options)
+        options["WRT_PERFORMANCE"] = "YES"
+        options["CONV_FILENAME"] = "history_benchmark"
+        options["TABULAR_FORMAT"] = "CSV"
+        if self.linsol_group is not None:
+            options["HISTORY_OUTPUT"] = "(ITER, %s)" % self.linsol_group
+
+        with open(os.path.join(self.cfg_dir, self.cfg_file), 'r') as file_in:
+            lines = file_in.readlines()
+
+        bench_file = "%s_benchmark.cfg" % os.path.splitext(self.cfg_file)[0]
+        written = set()
+        with open(os.path.join(self.cfg_dir, bench_file), 'w') as file_out:
+            file_out.write('%% This file automatically generated by the benchmark script\n')
+            for line in lines:
+                key = line.strip().split("=")[0].strip()
+                if key in options:
+                    file_out.write("%s= %s\n" % (key, options[key]))
+                    written.add(key)
+                else:
+                    file_out.write(line)
+            for key in sorted(options):
+                if key not in written:
+                    file_out.write("%s= %s\n" % (key, options[key]))
+
+        return bench_file
+
+    def run(self, su2_exec, nRanks):
+        """Run the case, returns a dictionary with the measured metrics."""
+
+        print('==================== Start Benchmark: %s ====================' % self.tag)
+
+        bench_file = self.write_config()
+        logfilename = '%s.log' % os.path.splitext(bench_file)[0]
+
+        if nRanks > 1:
+            mpirun = "mpirun --allow-run-as-root" if os.geteuid() == 0 else "mpirun"
+            command = "%s -n %d %s %s > %s 2>&1" % (mpirun, nRanks, su2_exec, bench_file, logfilename)
+        else:
+            command = "%s %s > %s 2>&1" % (su2_exec, bench_file, logfilename)
+
+        result = {"ranks": nRanks, "passed": False}
+
+        workdir = os.getcwd()
+        os.chdir(self.cfg_dir)
+        for old_history in glob.glob("history_benchmark*.csv"):
+            os.remove(old_history)
+
+        # The resource usage of the child includes all its (waited for) descendants,
+        # ru_maxrss is then the peak resident size of the largest process, i.e. per rank.
+        start = time.time()
+        process = subprocess.Popen(command, shell=True)
+        timed_out = False
+        while True:
+            pid, status, usage = os.wait4(process.pid, os.WNOHANG)
+            if pid != 0: break
+            if time.time()-start > self.timeout:
+                process.kill()
+                pid, status, usage = os.wait4(process.pid, 0)
+                timed_out = True
+                break
+            time.sleep(0.1)
+        result["wall_time"] = time.time()-start
+        result["peak_rss_mb"] = usage.ru_maxrss/1024.0 if sys.platform != "darwin" else usage.ru_maxrss/1048576.0
+
+        with open(logfilename, 'r') as log:
+            output = log.read()
+
+        summary = {"preprocessing_time": "Preproc. Time (s):",
+                   "compute_time"      : "Compute Time (s):",
+                   "output_time"       : "Output Time (s):",
+                   "iterations"        : "Iteration count:",
+                   "mpoints_per_s"     : "Mpoints/s:",
+                   "mdofs_per_s"       : "MDOFs/s:",
+                   "mdofs_per_s_core"  : "MDOFs/s/core:"}
+
+        for key in summary:
+            match = re.search(re.escape(summary[key])+r'\s*([-+]?[0-9.]+(?:[eE][-+]?[0-9]+)?)', output)
+            result[key] = float(match.group(1)) if match else None
+
+        result["linear_iterations"] = self.linear_iterations()
+        os.chdir(workdir)
+
+        result["passed"] = (not timed_out) and (os.WEXITSTATUS(status) == 0) and \
+                           (result["compute_time"] is not None)
+
+        if timed_out:
+            print('ERROR: Execution timed out. timeout=%d' % self.timeout)
+        if not result["passed"]:
+            print('%s: FAILED, see %s' % (self.tag, os.path.join(self.cfg_dir, logfilename)))
+        else:
+            print('%s: completed in %.2f s' % (self.tag, result["wall_time"]))
+        print('execution command: %s' % command)
+
+        return result
+
+    def linear_iterations(self):
+        """Total number of linear solver iterations from the history file."""
+
+        if self.linsol_group is None: return None
+
+        history = sorted(glob.glob("history_benchmark*.csv"), key=os.path.getmtime)
+        if not history: return None
+
+        with open(history[-1], 'r') as csv:
+            header = [name.strip().strip('"') for name in csv.readline().split(',')]
+            columns = [i for i, name in enumerate(header) if name in ("Linear_Solver_Iterations", "LinSolIter")]
+            if not columns: return None
+            total = 0
+            for line in csv:
+                values = line.split(',')
+                if len(values) > columns[0]:
+                    try:
+                        total += int(float(values[columns[0]]))
+                    except ValueError:
+                        pass
+        return total
+
+
+def benchmark_cases():
+    """The fixed set of cases, the iteration counts must not be changed without updating the baseline."""
+
+    case_list = []
+
+    # Inviscid ONERA M6
+    oneram6 = BenchmarkCase('inv_oneram6')
+    oneram6.cfg_dir  = "euler/oneram6"
+    oneram6.cfg_file = "inv_ONERAM6.cfg"
+    oneram6.options  = {"ITER": 100, "CONV_RESIDUAL_MINVAL": -99}
+    case_list.append(oneram6)
+
+    # RANS flat plate
+    turb_flatplate = BenchmarkCase('turb_flatplate')
+    turb_flatplate.cfg_dir  = "rans/flatplate"
+    turb_flatplate.cfg_file = "turb_SA_flatplate.cfg"
+    turb_flatplate.options  = {"ITER": 200, "CONV_RESIDUAL_MINVAL": -99}
+    case_list.append(turb_flatplate)
+
+    # RANS NACA0012
+    turb_naca0012 = BenchmarkCase('turb_naca0012')
+    turb_naca0012.cfg_dir  = "rans/naca0012"
+    turb_naca0012.cfg_file = "turb_NACA0012_sa.cfg"
+    turb_naca0012.options  = {"ITER": 100, "CONV_RESIDUAL_MINVAL": -99}
+    case_list.append(turb_naca0012)
+
+    # DG-LES, unsteady cylinder with the WALE model
+    les_cylinder = BenchmarkCase('dg_les_cylinder')
+    les_cylinder.cfg_dir  = "hom_navierstokes/UnsteadyCylinder/nPoly4"
+    les_cylinder.cfg_file = "fem_unst_cylinder.cfg"
+    les_cylinder.options  = {"SOLVER": "FEM_LES", "KIND_SGS_MODEL": "WALE", "TIME_ITER": 20}
+    les_cylinder.linsol_group = None
+    case_list.append(les_cylinder)
+
+    # FEA, static 3D beam
+    statbeam3d = BenchmarkCase('fea_statbeam3d')
+    statbeam3d.cfg_dir  = "fea_fsi/StatBeam_3d"
+    statbeam3d.cfg_file = "configBeam_3d.cfg"
+    statbeam3d.options  = {"INNER_ITER": 1}
+    case_list.append(statbeam3d)
+
+    # Discrete adjoint, inviscid ONERA M6
+    discadj_oneram6 = BenchmarkCase('discadj_oneram6')
+    discadj_oneram6.cfg_dir  = "disc_adj_euler/oneram6"
+    discadj_oneram6.cfg_file = "inv_ONERAM6.cfg"
+    discadj_oneram6.options  = {"ITER": 20, "CONV_RESIDUAL_MINVAL": -99}
+    discadj_oneram6.linsol_group = None
+    discadj_oneram6.adjoint  = True
+    case_list.append(discadj_oneram6)
+
+    return case_list
+
+
+def find_exec(name):
+    """Absolute path of an executable (given with a path or in the PATH), None if not found."""
+    if os.path.dirname(name):
+        return os.path.abspath(name) if os.access(name, os.X_OK) else None
+    for path in os.environ.get("PATH", "").split(os.pathsep):
+        candidate = os.path.join(path, name)
+        if os.access(candidate, os.X_OK): return candidate
+    return None
+
+
+def compare(results, baseline, tol, mem_tol):
+    """Compare with the baseline, returns the list of regressions."""
+
+    # Metric, True if larger is better, relative tolerance.
+    metrics = [("preprocessing_time", False, tol),
+               ("compute_time", False, tol),
+               ("mdofs_per_s_core", True, tol),
+               ("peak_rss_mb", False, mem_tol),
+               ("linear_iterations", False, tol)]
+
+    regressions = []
+
+    print('==================================================================')
+    print('%-18s %-20s %14s %14s %9s' % ("case", "metric", "baseline", "current", "change"))
+
+    for tag in sorted(results["cases"]):
+        current = results["cases"][tag]
+        if tag not in baseline["cases"] or not current["passed"]: continue
+        reference = baseline["cases"][tag]
+        if reference["ranks"] != current["ranks"]:
+            print('%s: the baseline was measured with %d ranks, not compared.' % (tag, reference["ranks"]))
+            continue
+
+        for key, larger_better, rel_tol in metrics:
+            ref, cur = reference.get(key), current.get(key)
+            if ref is None or cur is None or ref == 0: continue
+            change = (cur-ref)/abs(ref)
+            worse = (-change if larger_better else change) > rel_tol
+            print('%-18s %-20s %14.4g %14.4g %+8.1f%%%s' % (tag, key, ref, cur, 100.0*change,
+                                                           "  <-- REGRESSION" if worse else ""))
+            if worse: regressions.append((tag, key))
+
+    return regressions
+
+
+def main():
+    '''Runs a fixed set of cases with a fixed number of iterations, records wall time
+       per phase, MDOFs/s per core, peak memory and linear iterations into a JSON file,
+       and compares them against a stored baseline with a tolerance. '''
+
+    parser = OptionParser()
+    parser.add_option("--exec", dest="su2_exec", default="SU2_CFD", help="SU2_CFD executable")
+    parser.add_option("--exec-ad", dest="su2_exec_ad", default="SU2_CFD_AD",
+                      help="SU2_CFD_AD executable, the adjoint case is skipped if not found")
+    parser.add_option("-n", "--ranks", dest="ranks", default=1, type="int", help="Number of MPI ranks")
+    parser.add_option("-o", "--output", dest="output", default="performance_results.json",
+                      help="JSON file where the results are written")
+    parser.add_option("-b", "--baseline", dest="baseline", default="performance_baseline.json",
+                      help="JSON file with the baseline results")
+    parser.add_option("--save-baseline", dest="save_baseline", action="store_true", default=False,
+                      help="Store the results as the new baseline")
+    parser.add_option("--tol", dest="tol", default=0.1, type="float",
+                      help="Relative tolerance for time, throughput and linear iterations")
+    parser.add_option("--mem-tol", dest="mem_tol", default=0.1, type="float",
+                      help="Relative tolerance for the peak memory")
+    parser.add_option("--cases", dest="cases", default="",
+                      help="Comma-separated subset of the cases to run")
+
+    (options, args) = parser.parse_args()
+
+    su2_exec = find_exec(options.su2_exec)
+    su2_exec_ad = find_exec(options.su2_exec_ad)
+    if su2_exec is None:
+        print("ERROR: %s not found." % options.su2_exec)
+        sys.exit(1)
+
+    version = None
+    try:
+        version = subprocess.check_output(["git", "rev-parse", "HEAD"], stderr=subprocess.STDOUT).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        pass
+
+    results = {"date": datetime.datetime.now().isoformat(),
+               "host": socket.gethostname(),
+               "commit": version,
+               "ranks": options.ranks,
+               "cases": {}}
+
+    selection = [tag for tag in options.cases.split(',') if tag]
+
+    for case in benchmark_cases():
+        if selection and case.tag not in selection: continue
+        if case.adjoint and su2_exec_ad is None:
+            print('%s: skipped, %s not found.' % (case.tag, options.su2_exec_ad))
+            continue
+        results["cases"][case.tag] = case.run(su2_exec_ad if case.adjoint else su2_exec, options.ranks)
+
+    with open(options.output, 'w') as out:
+        json.dump(results, out, indent=2, sort_keys=True)
+    print('Results written to %s' % options.output)
+
+    if options.save_baseline:
+        with open(options.baseline, 'w') as out:
+            json.dump(results, out, indent=2, sort_keys=True)
+        print('Baseline written to %s' % options.baseline)
+
+    regressions = []
+    if not options.save_baseline and os.path.isfile(options.baseline):
+        with open(options.baseline, 'r') as base:
+            regressions = compare(results, json.load(base), options.tol, options.mem_tol)
+    elif not options.save_baseline:
+        print('No baseline (%s), the results were not compared.' % options.baseline)
+
+    # Summary
+    print('==================================================================')
+    print('Summary of the performance benchmark')
+    print('python version:', sys.version)
+    failed = [tag for tag in results["cases"] if not results["cases"][tag]["passed"]]
+    for tag in sorted(results["cases"]):
+        if tag in failed:
+            print('* FAILED - %s' % tag)
+        elif any(reg[0] == tag for reg in regressions):
+            print('* SLOWER - %s (%s)' % (tag, ', '.join(reg[1] for reg in regressions if reg[0] == tag)))
+        else:
+            print('  passed - %s' % tag)
+
+    if failed or regressions:
+        sys.exit(1)
+    else:
+        sys.exit(0)
+    # done
+
+if __name__ == '__main__':
+    main()
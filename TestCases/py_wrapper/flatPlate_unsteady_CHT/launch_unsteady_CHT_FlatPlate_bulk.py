@@ -0,0 +1,162 @@
+#!/usr/bin/env python
+
+## \file launch_unsteady_CHT_FlatPlate_bulk.py
+#  \brief Same case as launch_unsteady_CHT_FlatPlate.py, with the bulk (NumPy) marker functions of the wrapper.
+#  \version 7.0.1 "Blackbird"
+#
+# The current SU2 release has been coordinated by the
+# SU2 International Developers Society <www.su2devsociety.org>
+# with selected contributions from the open-source community.
+#
+# The main research teams contributing to the current release are:
+#  - Prof. Juan J. Alonso's group at Stanford University.
+#  - Prof. Piero Colonna's group at Delft University of Technology.
+#  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+#  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+#  - Prof. Rafael Palacios' group at Imperial College London.
+#  - Prof. Vincent Terrapon's group at the University of Liege.
+#  - Prof. Edwin van der Weide's group at the University of Twente.
+#  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+#
+# Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+#                      Tim Albring, and the SU2 contributors.
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import sys
+from optparse import OptionParser	# use a parser for configuration
+import pysu2			            # imports the SU2 wrapped module
+import numpy
+from math import *
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+
+  # Command line options
+  parser=OptionParser()
+  parser.add_option("-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE")
+  parser.add_option("--parallel", action="store_true",
+                    help="Specify if we need to initialize MPI", dest="with_MPI", default=False)
+
+  (options, args) = parser.parse_args()
+
+  # Import mpi4py for parallel run
+  if options.with_MPI == True:
+    from mpi4py import MPI
+    comm = MPI.COMM_WORLD
+    rank = comm.Get_rank()
+  else:
+    comm = 0
+    rank = 0
+
+  # Initialize the driver of SU2, this includes solver preprocessing
+  SU2Driver = pysu2.CSinglezoneDriver(options.filename, 1, comm);
+
+  # The bulk functions are only wrapped when the wrapper is built with NumPy
+  if not hasattr(SU2Driver, 'SetMarkerTemperatures'):
+    print('ERROR : The wrapper was built without NumPy, the bulk marker functions are not available.')
+    sys.exit(1)
+
+  CHTMarkerID = None
+  CHTMarker = 'plate'       # Specified by the user
+
+  # Get all the tags with the CHT option
+  CHTMarkerList =  SU2Driver.GetAllCHTMarkersTag()
+
+  # Get all the markers defined on this rank and their associated indices.
+  allMarkerIDs = SU2Driver.GetAllBoundaryMarkers()
+
+  #Check if the specified marker has a CHT option and if it exists on this rank.
+  if CHTMarker in CHTMarkerList and CHTMarker in allMarkerIDs.keys():
+    CHTMarkerID = allMarkerIDs[CHTMarker]
+
+  # Number of vertices on the specified marker (per rank, physical + halo)
+  nVertex_CHTMarker = 0
+  if CHTMarkerID != None:
+    nVertex_CHTMarker = SU2Driver.GetNumberVertices(CHTMarkerID)
+
+  # Marker arrays, contiguous float64 as required by the wrapper
+  WallTemp = numpy.zeros(nVertex_CHTMarker)
+  Temp = numpy.zeros(nVertex_CHTMarker)
+  Coord = numpy.zeros((nVertex_CHTMarker, 2))
+
+  # The bulk getters must return the same values as the per-vertex ones
+  def CheckMarker():
+    if CHTMarkerID == None: return
+    SU2Driver.GetMarkerCoordinates(CHTMarkerID, Coord)
+    SU2Driver.GetMarkerTemperatures(CHTMarkerID, Temp)
+    for iVertex in range(nVertex_CHTMarker):
+      if (Coord[iVertex,0] != SU2Driver.GetVertexCoordX(CHTMarkerID, iVertex) or
+          Coord[iVertex,1] != SU2Driver.GetVertexCoordY(CHTMarkerID, iVertex) or
+          Temp[iVertex] != SU2Driver.GetVertexTemperature(CHTMarkerID, iVertex)):
+        print('ERROR : Bulk and per-vertex values differ on rank', rank, 'vertex', iVertex)
+        sys.exit(1)
+
+  # Retrieve some control parameters from the driver
+  deltaT = SU2Driver.GetUnsteady_TimeStep()
+  TimeIter = SU2Driver.GetTime_Iter()
+  nTimeIter = SU2Driver.GetnTimeIter()
+  time = TimeIter*deltaT
+
+  # Time loop is defined in Python so that we have acces to SU2 functionalities at each time step
+  if rank == 0:
+    print("\n------------------------------ Begin Solver -----------------------------\n")
+  sys.stdout.flush()
+  if options.with_MPI == True:
+    comm.Barrier()
+
+  while (TimeIter < nTimeIter):
+    # Time iteration preprocessing
+    SU2Driver.Preprocess(TimeIter)
+    # Same homogeneous unsteady wall temperature as the per-vertex version, set in one call
+    if CHTMarkerID != None:
+      WallTemp[:] = 293.0 + 57.0*sin(2*pi*time)
+      SU2Driver.SetMarkerTemperatures(CHTMarkerID, WallTemp)
+    # Tell the SU2 drive to update the boundary conditions
+    SU2Driver.BoundaryConditionsUpdate()
+    # Run one time iteration (e.g. dual-time)
+    SU2Driver.Run()
+    # Update the solver for the next time iteration
+    SU2Driver.Update()
+    # Monitor the solver and output solution to file if required
+    stopCalc = SU2Driver.Monitor(TimeIter)
+    SU2Driver.Output(TimeIter)
+    # Read the marker back
+    CheckMarker()
+    if (stopCalc == True):
+      break
+    # Update control parameters
+    TimeIter += 1
+    time += deltaT
+
+  # Postprocess the solver and exit cleanly
+  SU2Driver.Postprocessing()
+
+  if SU2Driver != None:
+    del SU2Driver
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()